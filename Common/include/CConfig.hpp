@@ -143,6 +143,7 @@ private:
   su2double Damp_Engine_Exhaust;  /*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,     /*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong;            /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_ParallelAgglomeration;  /*!< \brief Use the parallel (seed-priority based) multigrid agglomeration. */
   su2double Position_Plane;    /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd;          /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL;           /*!< \brief Fixed Cl mode derivate . */
@@ -576,6 +577,8 @@ private:
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool NewtonKrylov;                             /*!< \brief Use Jacobian-free products (Newton-Krylov) for the implicit flow equations. */
+  su2double NewtonKrylov_Epsilon;                /*!< \brief Relative step of the finite difference Jacobian-free products. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_AdjFlow;  /*!< \brief Relaxation coefficient of the linear solver adjoint mean flow. */
@@ -726,6 +729,7 @@ private:
   unsigned short Analytical_Surface;  /*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format (SU2 or SU2_BINARY). */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
@@ -1118,6 +1122,25 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  bool Output_Async;                  /*!< \brief Write the output files in the background (non-blocking MPI-IO). */
+  bool Restart_Compression;           /*!< \brief Write compressed binary restart files. */
+  string* Restart_Lossy_Fields;       /*!< \brief Fields of the restart files that are compressed with loss. */
+  unsigned short nRestart_Lossy_Fields; /*!< \brief Number of fields compressed with loss. */
+  su2double Restart_Lossy_Tol;        /*!< \brief Error bound of the lossy fields, relative to their maximum magnitude. */
+  unsigned long Restart_Keyframe_Freq; /*!< \brief Number of compressed unsteady restarts per keyframe (the others are deltas). */
+  string* Marker_Sampling;            /*!< \brief Markers whose output fields are sampled to the surface samples file. */
+  unsigned short nMarker_Sampling;    /*!< \brief Number of sampled markers. */
+  string* Sampling_Fields;            /*!< \brief Sampled output fields. */
+  unsigned short nSampling_Fields;    /*!< \brief Number of sampled fields. */
+  unsigned long Sampling_Freq;        /*!< \brief Sampling frequency (iterations). */
+  bool Sampling_Vertex_Data;          /*!< \brief Write the values of all the vertices, or only the averages and probes. */
+  su2double* Sampling_Probes;         /*!< \brief Coordinates of the surface probes (3 per probe). */
+  unsigned short nSampling_Probes;    /*!< \brief Number of coordinates of the surface probes. */
+  string Sampling_FileName;           /*!< \brief Name of the surface samples file. */
+  su2double* Probe_Points;            /*!< \brief Coordinates of the volume probes (3 per probe). */
+  unsigned short nProbe_Points;       /*!< \brief Number of coordinates of the volume probes. */
+  su2double* Probe_Lines;             /*!< \brief Lines of volume probes (start, end, and number of points). */
+  unsigned short nProbe_Lines;        /*!< \brief Number of values of the lines of probes. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1144,6 +1167,20 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool useVectorization;            /*!< \brief Use the vectorized (batched) versions of the convective schemes, if available. */
+  unsigned long residualTaskBlockSize; /*!< \brief Number of points per block of the task graph of the flow residual (0 disables it). */
+  su2double ParMETIS_Tolerance;     /*!< \brief Load imbalance tolerance of the ParMETIS partitioning. */
+  long ParMETIS_PointWeight,        /*!< \brief Weight of each point in the work estimate of the partitioning. */
+  ParMETIS_EdgeWeight,              /*!< \brief Weight of each edge of a point in the work estimate of the partitioning. */
+  ParMETIS_BoundaryWeight;          /*!< \brief Weight of each marker of a point in the work estimate of the partitioning. */
+  bool ParMETIS_BoundaryConstraint; /*!< \brief Balance the boundary points as a second constraint of the partitioning. */
+  unsigned long LoadImbalance_Freq; /*!< \brief Iterations between checks of the load imbalance of the residual computations (0 = off). */
+  su2double LoadImbalance_Threshold; /*!< \brief Load imbalance above which a warning is issued, or the grid is repartitioned. */
+  bool LoadRebalance;                /*!< \brief Repartition the grid at runtime when the load imbalance is above the threshold. */
+  bool WallDistance_Distributed;    /*!< \brief Send each rank only the wall elements that can be the nearest to its points. */
+  bool WallDistance_Incremental;    /*!< \brief Update the wall distance only where the points or the walls moved. */
+  unsigned short Kind_PointOrdering; /*!< \brief Renumbering of the points of each rank. */
+  bool SortEdges;                   /*!< \brief Sort the edges by their (lower, higher) point. */
 
   unsigned short Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   unsigned short Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -5293,6 +5330,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (SU2_DEF).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -6175,6 +6218,12 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void) const { return Damp_Correc_Prolong; }
 
+  /*!
+   * \brief Get whether the coarse grids are agglomerated with the parallel algorithm.
+   * \return <code>TRUE</code> if the parallel agglomeration is used.
+   */
+  bool GetMG_ParallelAgglomeration(void) const { return MG_ParallelAgglomeration; }
+
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -9301,6 +9350,123 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Get whether the output files are written in the background.
+   * \return <code>TRUE</code> if the writing of the restart and Paraview XML files does not block the solver.
+   */
+  bool GetOutput_Async() const { return Output_Async; }
+
+  /*!
+   * \brief Get whether the binary restart files are compressed.
+   * \return <code>TRUE</code> if the compressed format is written.
+   */
+  bool GetRestart_Compression() const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the number of restart fields compressed with loss.
+   * \return Number of fields.
+   */
+  unsigned short GetnRestart_Lossy_Fields() const { return nRestart_Lossy_Fields; }
+
+  /*!
+   * \brief Get the name of a restart field compressed with loss.
+   * \param[in] iField - Index of the field.
+   * \return Name of the field.
+   */
+  string GetRestart_Lossy_Field(unsigned short iField) const { return Restart_Lossy_Fields[iField]; }
+
+  /*!
+   * \brief Get the error bound of the restart fields compressed with loss.
+   * \return Error bound relative to the maximum magnitude of each field.
+   */
+  su2double GetRestart_Lossy_Tol() const { return Restart_Lossy_Tol; }
+
+  /*!
+   * \brief Get the frequency of the keyframes of the compressed restart files of time-domain problems.
+   * \return Number of restarts per keyframe, the others store the changes w.r.t. the last keyframe.
+   */
+  unsigned long GetRestart_Keyframe_Freq() const { return Restart_Keyframe_Freq; }
+
+  /*!
+   * \brief Get the number of markers sampled to the surface samples file.
+   * \return Number of markers.
+   */
+  unsigned short GetnMarker_Sampling() const { return nMarker_Sampling; }
+
+  /*!
+   * \brief Get the name of a sampled marker.
+   * \param[in] iMarker - Index of the sampled marker.
+   * \return Name of the marker.
+   */
+  string GetMarker_Sampling(unsigned short iMarker) const { return Marker_Sampling[iMarker]; }
+
+  /*!
+   * \brief Get the number of sampled output fields.
+   * \return Number of fields.
+   */
+  unsigned short GetnSampling_Fields() const { return nSampling_Fields; }
+
+  /*!
+   * \brief Get the name of a sampled output field.
+   * \param[in] iField - Index of the field.
+   * \return Name of the field (as in the volume output files).
+   */
+  string GetSampling_Field(unsigned short iField) const { return Sampling_Fields[iField]; }
+
+  /*!
+   * \brief Get the sampling frequency of the markers.
+   * \return Number of (time) iterations between samples.
+   */
+  unsigned long GetSampling_Freq() const { return Sampling_Freq; }
+
+  /*!
+   * \brief Get whether the values of all the sampled vertices are written.
+   * \return <code>FALSE</code> if only the marker averages and the probes are written.
+   */
+  bool GetSampling_Vertex_Data() const { return Sampling_Vertex_Data; }
+
+  /*!
+   * \brief Get the number of coordinates of the surface probes.
+   * \return Number of coordinates (3 per probe).
+   */
+  unsigned short GetnSampling_Probes() const { return nSampling_Probes; }
+
+  /*!
+   * \brief Get the coordinates of the surface probes.
+   * \return Coordinates, 3 per probe.
+   */
+  const su2double* GetSampling_Probes() const { return Sampling_Probes; }
+
+  /*!
+   * \brief Get the name of the surface samples file.
+   * \return Name of the file.
+   */
+  string GetSampling_FileName() const { return Sampling_FileName; }
+
+  /*!
+   * \brief Get the number of coordinates of the volume probes.
+   * \return Number of coordinates (3 per probe).
+   */
+  unsigned short GetnProbe_Points() const { return nProbe_Points; }
+
+  /*!
+   * \brief Get the coordinates of the volume probes.
+   * \return Coordinates, 3 per probe.
+   */
+  const su2double* GetProbe_Points() const { return Probe_Points; }
+
+  /*!
+   * \brief Get the number of values that define the lines of probes.
+   * \return Number of values (7 per line).
+   */
+  unsigned short GetnProbe_Lines() const { return nProbe_Lines; }
+
+  /*!
+   * \brief Get the lines of probes.
+   * \return Coordinates of the start and end, and number of points, of each line.
+   */
+  const su2double* GetProbe_Lines() const { return Probe_Lines; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -9338,9 +9504,91 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get whether the implicit flow equations are solved with Jacobian-free products (Newton-Krylov).
+   * \note The assembled (approximate) Jacobian is then only used to build the preconditioner.
+   */
+  bool GetNewtonKrylov(void) const { return NewtonKrylov; }
+
+  /*!
+   * \brief Get the relative step of the finite difference Jacobian-free products.
+   */
+  su2double GetNewtonKrylov_Epsilon(void) const { return NewtonKrylov_Epsilon; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get whether the vectorized (batched) versions of the convective schemes should be used.
+   */
+  bool GetUseVectorization(void) const { return useVectorization; }
+
+  /*!
+   * \brief Get the number of points per block of the task graph of the flow residual (0 if not used).
+   */
+  unsigned long GetResidualTaskBlockSize(void) const { return residualTaskBlockSize; }
+
+  /*!
+   * \brief Get the load imbalance tolerance of the ParMETIS partitioning.
+   */
+  su2double GetParMETIS_Tolerance(void) const { return ParMETIS_Tolerance; }
+
+  /*!
+   * \brief Get the weight of each point in the work estimate of the ParMETIS partitioning.
+   */
+  long GetParMETIS_PointWeight(void) const { return ParMETIS_PointWeight; }
+
+  /*!
+   * \brief Get the weight of each edge of a point in the work estimate of the ParMETIS partitioning.
+   */
+  long GetParMETIS_EdgeWeight(void) const { return ParMETIS_EdgeWeight; }
+
+  /*!
+   * \brief Get the weight of each marker of a point in the work estimate of the ParMETIS partitioning.
+   */
+  long GetParMETIS_BoundaryWeight(void) const { return ParMETIS_BoundaryWeight; }
+
+  /*!
+   * \brief Get whether the boundary points are balanced as a second constraint of the ParMETIS partitioning.
+   */
+  bool GetParMETIS_BoundaryConstraint(void) const { return ParMETIS_BoundaryConstraint; }
+
+  /*!
+   * \brief Get the number of iterations between checks of the load imbalance (0 means no checks).
+   */
+  unsigned long GetLoadImbalance_Freq(void) const { return LoadImbalance_Freq; }
+
+  /*!
+   * \brief Get the load imbalance (slowest rank over average, minus 1) above which a warning is issued,
+   *        or the grid is repartitioned.
+   */
+  su2double GetLoadImbalance_Threshold(void) const { return LoadImbalance_Threshold; }
+
+  /*!
+   * \brief Get whether the grid is repartitioned at runtime when the load imbalance is above the threshold.
+   */
+  bool GetLoadRebalance(void) const { return LoadRebalance; }
+
+  /*!
+   * \brief Get whether each rank only receives the wall elements that can be the nearest to its points.
+   */
+  bool GetWallDistance_Distributed(void) const { return WallDistance_Distributed; }
+
+  /*!
+   * \brief Get whether the wall distance is only updated where the points or the walls moved (deforming meshes).
+   */
+  bool GetWallDistance_Incremental(void) const { return WallDistance_Incremental; }
+
+  /*!
+   * \brief Get the kind of renumbering of the points of each rank (RCM or a space-filling curve).
+   */
+  unsigned short GetKind_PointOrdering(void) const { return Kind_PointOrdering; }
+
+  /*!
+   * \brief Get whether the edges are sorted by their (lower, higher) point.
+   */
+  bool GetSortEdges(void) const { return SortEdges; }
+
 };
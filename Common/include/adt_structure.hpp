@@ -207,8 +207,8 @@ protected:
 
   vector<CADTNodeClass> leaves; /*!< \brief Vector, which contains all the leaves of the ADT. */
 
-  vector<unsigned long> frontLeaves;    /*!< \brief Vector used in the tree traversal. */
-  vector<unsigned long> frontLeavesNew; /*!< \brief Vector used in the tree traversal. */
+  vector<vector<unsigned long> > FrontLeaves;    /*!< \brief Vectors used in the tree traversal (one per thread). */
+  vector<vector<unsigned long> > FrontLeavesNew; /*!< \brief Vectors used in the tree traversal (one per thread). */
 
 private:
   vector<su2double> coorMinLeaves; /*!< \brief Vector, which contains all the minimum coordinates
@@ -347,9 +347,9 @@ private:
   vector<int>           ranksOfElems;  /*!< \brief Vector, which contains the ranks
                                                     of the elements in the ADT. */
 
-  vector<CBBoxTargetClass> BBoxTargets; /*!< \brief Vector, used to store possible bounding
-                                                    box candidates during the nearest element
-                                                    search. */
+  vector<vector<CBBoxTargetClass> > BBoxTargets; /*!< \brief Vectors (one per thread), used to store possible
+                                                             bounding box candidates during the nearest
+                                                             element search. */
 public:
   /*!
    * \brief Constructor of the class.
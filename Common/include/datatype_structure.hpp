@@ -53,6 +53,20 @@
 
 typedef double passivedouble;
 
+/*--- This type is used to store the sparse matrices (e.g. Jacobians) of implicit solvers and their preconditioners.
+ * With mixed precision (-DUSE_MIXED_PRECISION) single precision halves their memory footprint and traffic, whereas
+ * the Krylov vectors of the linear solvers remain in double precision. Mixed precision is ignored by AD builds. ---*/
+
+#if defined(USE_MIXED_PRECISION) && (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+#undef USE_MIXED_PRECISION
+#endif
+
+#ifdef USE_MIXED_PRECISION
+typedef float su2mixedfloat;
+#else
+typedef passivedouble su2mixedfloat;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../mpi_structure.hpp"
+#include "../omp_structure.hpp"
 
 #ifdef HAVE_METIS
 #include "metis.h"
@@ -178,10 +179,20 @@ protected:
 
   CCompressedSparsePatternUL
   edgeColoring,                          /*!< \brief Edge coloring structure for thread-based parallelization. */
-  elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  elemColoring,                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  markerColoring;                        /*!< \brief Marker coloring structure for task-based boundary conditions. */
   unsigned long edgeColorGroupSize = 1;  /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize = 1;  /*!< \brief Size of the element groups within each color. */
 
+  /*--- Contiguous (structure-of-arrays) storage of the edge and point data used by the edge loops,
+   *    the CEdge and CPoint objects refer to these containers (see SetContiguousStorage). ---*/
+
+  su2matrix<unsigned long> edgeNodes;    /*!< \brief Nodes (i,j) of each edge. */
+  su2activematrix edgeNormals;           /*!< \brief Normal of the dual face associated with each edge. */
+  su2activematrix pointCoords;           /*!< \brief Coordinates of each point. */
+  su2activematrix pointVolumes;          /*!< \brief Volumes of each point (current, and n, n-1 for dual time). */
+  su2activematrix pointGridVel;          /*!< \brief Grid velocity of each point (only for dynamic grids). */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -224,6 +235,9 @@ public:
   unsigned short *bufS_P2PSend;          /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request *req_P2PSend;         /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv;         /*!< \brief Data structure for point-to-point recv requests. */
+  vector<SU2_MPI::Request>
+  persistentP2PSend[2][2],               /*!< \brief Persistent send requests, by data type (double, unsigned short) and direction (forward, reverse). */
+  persistentP2PRecv[2][2];               /*!< \brief Persistent recv requests, by data type (double, unsigned short) and direction (forward, reverse). */
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -276,7 +290,7 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void PreprocessP2PComms(CGeometry *geometry, CConfig *config);
+  virtual void PreprocessP2PComms(CGeometry *geometry, CConfig *config);
 
   /*!
    * \brief Routine to allocate buffers for point-to-point MPI communications. Also called to dynamically reallocate if not enough memory is found for comms during runtime.
@@ -305,6 +319,132 @@ public:
    */
   void PostP2PSends(CGeometry *geometry, CConfig *config, unsigned short commType, int val_iMessage, bool val_reverse);
 
+  /*!
+   * \brief Create the persistent requests (MPI_Send_init / MPI_Recv_init) for point-to-point comms of a
+   *        data type in one direction, if they do not exist yet. The messages do not depend on the quantity
+   *        being communicated (only on the buffers and on countPerPoint), therefore one set of requests is
+   *        used for all the quantities of the same type, it is rebuilt when the buffers are reallocated.
+   * \param[in] commType - Enumerated type for the data type of the messages.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void SetupPersistentP2PComms(unsigned short commType, bool val_reverse);
+
+  /*!
+   * \brief Free the persistent requests of point-to-point comms, none of them can be active.
+   */
+  void FreePersistentP2PComms();
+
+  /*!
+   * \brief Load the su2double send buffer of a point-to-point message, data is gathered from the send points
+   *        (or from the recv points in reverse mode, see PostP2PSends).
+   * \param[in] iMessage - Index of the message.
+   * \param[in] data - Data of all points, stored as data[iPoint*nCol+iCol].
+   * \param[in] nCol - Number of values per point, at most countPerPoint.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  template<class T>
+  void PackP2PBuffer(int iMessage, const T* data, unsigned long nCol, bool reverse = false) {
+    const int* nPointP2P = reverse? nPoint_P2PRecv : nPoint_P2PSend;
+    const unsigned long* localPoint = reverse? Local_Point_P2PRecv : Local_Point_P2PSend;
+    su2double* buf = reverse? bufD_P2PRecv : bufD_P2PSend;
+
+    for (auto iPos = nPointP2P[iMessage]; iPos < nPointP2P[iMessage+1]; ++iPos) {
+      const T* src = &data[localPoint[iPos]*nCol];
+      su2double* dst = &buf[iPos*countPerPoint];
+      SU2_OMP_SIMD
+      for (auto iCol = 0ul; iCol < nCol; ++iCol) dst[iCol] = src[iCol];
+    }
+  }
+
+  /*!
+   * \brief Store (or accumulate) the contents of the su2double recv buffer of a point-to-point message,
+   *        data is scattered to the recv points (or to the send points in reverse mode, see PostP2PRecvs).
+   * \param[in] iMessage - Index of the message.
+   * \param[in,out] data - Data of all points, stored as data[iPoint*nCol+iCol].
+   * \param[in] nCol - Number of values per point, at most countPerPoint.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] add - Add the received values to the data instead of overwriting it.
+   */
+  template<class T>
+  void UnpackP2PBuffer(int iMessage, T* data, unsigned long nCol, bool reverse = false, bool add = false) const {
+    const int* nPointP2P = reverse? nPoint_P2PSend : nPoint_P2PRecv;
+    const unsigned long* localPoint = reverse? Local_Point_P2PSend : Local_Point_P2PRecv;
+    const su2double* buf = reverse? bufD_P2PSend : bufD_P2PRecv;
+
+    for (auto iPos = nPointP2P[iMessage]; iPos < nPointP2P[iMessage+1]; ++iPos) {
+      const su2double* src = &buf[iPos*countPerPoint];
+      T* dst = &data[localPoint[iPos]*nCol];
+      if (add) {
+        SU2_OMP_SIMD
+        for (auto iCol = 0ul; iCol < nCol; ++iCol) dst[iCol] += FromP2PBuffer<T>(src[iCol]);
+      }
+      else {
+        SU2_OMP_SIMD
+        for (auto iCol = 0ul; iCol < nCol; ++iCol) dst[iCol] = FromP2PBuffer<T>(src[iCol]);
+      }
+    }
+  }
+
+  /*!
+   * \brief Convert the contents of the communication buffers, derivative information is only
+   *        preserved if the destination is active (see the specialization after the class).
+   */
+  template<class T>
+  static inline T FromP2PBuffer(const su2double& val) { return SU2_TYPE::GetValue(val); }
+
+  /*!
+   * \brief Exchange values of the points in the send/recv lists of the point-to-point comms, with
+   *        dedicated buffers, for quantities that do not have a communication type.
+   * \note In reverse mode the values of the recv (halo) points are sent to the ranks that own them, where
+   *       they are usually accumulated. Only one thread can call this routine.
+   * \param[in] nCol - Number of values per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] get - Functor returning the values of the points that are sent, get(iPoint, iCol).
+   * \param[in] set - Functor storing the values of the points that are received, set(iPoint, iCol, value).
+   */
+  template<class T, class GetFunc, class SetFunc>
+  void ExchangeHaloValues(unsigned short nCol, bool reverse, const GetFunc& get, const SetFunc& set) const {
+
+    static_assert(is_same<T, su2double>::value || is_same<T, unsigned long>::value, "Unsupported type.");
+    const auto type = is_same<T, unsigned long>::value? MPI_UNSIGNED_LONG : MPI_DOUBLE;
+
+    const int nSend = reverse? nP2PRecv : nP2PSend;
+    const int nRecv = reverse? nP2PSend : nP2PRecv;
+    const int* nPointSend = reverse? nPoint_P2PRecv : nPoint_P2PSend;
+    const int* nPointRecv = reverse? nPoint_P2PSend : nPoint_P2PRecv;
+    const int* sendTo = reverse? Neighbors_P2PRecv : Neighbors_P2PSend;
+    const int* recvFrom = reverse? Neighbors_P2PSend : Neighbors_P2PRecv;
+    const unsigned long* pointSend = reverse? Local_Point_P2PRecv : Local_Point_P2PSend;
+    const unsigned long* pointRecv = reverse? Local_Point_P2PSend : Local_Point_P2PRecv;
+
+    vector<T> bufSend(nCol*nPointSend[nSend]), bufRecv(nCol*nPointRecv[nRecv]);
+    vector<SU2_MPI::Request> req(nSend+nRecv);
+
+    for (int iRecv = 0; iRecv < nRecv; ++iRecv) {
+      const int count = nCol*(nPointRecv[iRecv+1]-nPointRecv[iRecv]);
+      SU2_MPI::Irecv(bufRecv.data()+nCol*nPointRecv[iRecv], count, type,
+                     recvFrom[iRecv], 0, MPI_COMM_WORLD, &req[iRecv]);
+    }
+
+    for (int iSend = 0; iSend < nSend; ++iSend) {
+      for (auto iPos = nPointSend[iSend]; iPos < nPointSend[iSend+1]; ++iPos)
+        for (auto iCol = 0u; iCol < nCol; ++iCol)
+          bufSend[iPos*nCol+iCol] = get(pointSend[iPos], iCol);
+
+      const int count = nCol*(nPointSend[iSend+1]-nPointSend[iSend]);
+      SU2_MPI::Isend(bufSend.data()+nCol*nPointSend[iSend], count, type,
+                     sendTo[iSend], 0, MPI_COMM_WORLD, &req[nRecv+iSend]);
+    }
+
+#ifdef HAVE_MPI
+    SU2_MPI::Waitall(nSend+nRecv, req.data(), MPI_STATUSES_IGNORE);
+#endif
+
+    for (auto iPos = 0; iPos < nPointRecv[nRecv]; ++iPos)
+      for (auto iCol = 0u; iCol < nCol; ++iCol)
+        set(pointRecv[iPos], iCol, bufRecv[iPos*nCol+iCol]);
+  }
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -598,11 +738,23 @@ public:
    */
   inline virtual void SetRCM_Ordering(CConfig *config) {}
 
+  /*!
+   * \brief Orders the points along a space-filling curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetSFC_Ordering(CConfig *config) {}
+
   /*!
    * \brief Connects elements  .
    */
   inline virtual void SetElement_Connectivity(void) {}
 
+  /*!
+   * \brief Sort the points surrounding each point, the edges (SetEdges) are then
+   *        sorted by their (lower, higher) point.
+   */
+  void SortPoint_Connectivity(void);
+
   /*!
    * \brief Sets the edges of an elemment.
    */
@@ -1675,5 +1827,63 @@ public:
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Get the marker coloring, the markers of a color do not have points in common and therefore
+   *        their boundary conditions can be computed concurrently. The colors are formed in marker order.
+   * \note This method computes the coloring if that has not been done yet. Communication markers
+   *       (send-receive and periodic) are not considered to have points.
+   * \param[in] config - Definition of the particular problem.
+   * \return Reference to the coloring.
+   */
+  const CCompressedSparsePatternUL& GetMarkerColoring(const CConfig *config);
+
+  /*!
+   * \brief Move the nodes and normals of the edges, and the coordinates, volumes, and grid velocities
+   *        of the points, to contiguous (structure-of-arrays) storage owned by the geometry.
+   * \note The CEdge and CPoint objects remain valid and refer to the new storage, therefore updates made
+   *       through them (e.g. by the grid movement) are seen by the accessors below. Called by SetEdges.
+   */
+  void SetContiguousStorage(void);
+
+  /*!
+   * \brief Get a node of an edge from the contiguous storage.
+   * \param[in] iEdge - Edge index.
+   * \param[in] iNode - Position of the node in the edge (0 or 1).
+   * \return Index of the point.
+   */
+  inline unsigned long GetEdgeNode(unsigned long iEdge, unsigned short iNode) const { return edgeNodes(iEdge,iNode); }
+
+  /*!
+   * \brief Get the normal of an edge from the contiguous storage.
+   * \param[in] iEdge - Edge index.
+   * \return Dimensional normal vector, the modulus is the area of the face.
+   */
+  inline su2double* GetEdgeNormal(unsigned long iEdge) { return edgeNormals[iEdge]; }
+
+  /*!
+   * \brief Get the coordinates of a point from the contiguous storage.
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the coordinates.
+   */
+  inline su2double* GetPointCoord(unsigned long iPoint) { return pointCoords[iPoint]; }
+
+  /*!
+   * \brief Get the (current) volume of a point from the contiguous storage.
+   * \param[in] iPoint - Point index.
+   * \return Volume or area of the control volume.
+   */
+  inline su2double GetPointVolume(unsigned long iPoint) const { return pointVolumes(iPoint,0); }
+
+  /*!
+   * \brief Get the grid velocity of a point from the contiguous storage.
+   * \note Only valid for dynamic grids.
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the grid velocity.
+   */
+  inline su2double* GetPointGridVel(unsigned long iPoint) { return pointGridVel[iPoint]; }
+
 };
 
+template<>
+inline su2double CGeometry::FromP2PBuffer<su2double>(const su2double& val) { return val; }
+
@@ -37,6 +37,36 @@
  */
 class CMultiGridGeometry final : public CGeometry {
 
+private:
+  bool parallelAgglomeration = false;            /*!< \brief The control volumes were built by SetParallelAgglomeration. */
+  vector<unsigned long> Parent_GlobalIndex;      /*!< \brief Global index of the parent of each fine point (including halos). */
+  vector<int> Parent_Rank;                       /*!< \brief Rank that owns the parent of each fine point (including halos). */
+  vector<int> Owner_Rank;                        /*!< \brief Rank that owns each coarse control volume. */
+  map<unsigned long, unsigned long> Global_to_Local_CV; /*!< \brief Local index of the coarse control volumes. */
+
+  /*!
+   * \brief Agglomerate the domain control volumes of the fine grid in rounds, and build the coarse grid.
+   *        In each round the undecided points that have the highest priority in their 2-neighborhood become
+   *        seeds, and take their compatible undecided neighbors (also those of other ranks). The priority only
+   *        depends on the kind of point, on the number of decided neighbors, and on the global index, therefore
+   *        the agglomeration does not depend on the number of ranks or threads, or on the numbering of the points.
+   *        A coarse control volume is owned by the rank of its seed, and each rank stores as children only the
+   *        fine points it owns, the contributions of other ranks are added with reverse communications.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetParallelAgglomeration(CGeometry *fine_grid, CConfig *config);
+
+  /*!
+   * \brief Send each fine edge that connects different agglomerates (counted once, by the owner of the end point
+   *        with the lowest global index) to the ranks that own the two agglomerates.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[out] edgeInfo - Received edges, global index and rank of the two parents, and global index of the
+   *              two fine points, the normal is oriented from the first to the second.
+   * \param[out] edgeNormal - Received normals (if not null).
+   */
+  void RouteFineEdges(CGeometry *fine_grid, vector<unsigned long>& edgeInfo, vector<su2double>* edgeNormal) const;
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -163,6 +193,14 @@ public:
    */
   void SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config) override;
 
+  /*!
+   * \brief Set up the point-to-point communications, with the parallel agglomeration the halo control
+   *        volumes are requested from the ranks that own them, instead of using SEND_RECEIVE markers.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessP2PComms(CGeometry *geometry, CConfig *config) override;
+
   /*!
    * \brief Find and store the closest neighbor to a vertex.
    * \param[in] config - Definition of the particular problem.
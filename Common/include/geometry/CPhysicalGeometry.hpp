@@ -104,6 +104,12 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  vector<su2double> WallDist_Coord;          /*!< \brief Coordinates of the points when the wall distance was last computed (WALL_DISTANCE_INCREMENTAL). */
+  vector<su2double> WallDist_Value;          /*!< \brief Wall distance of each point. */
+  vector<int> WallDist_Rank;                 /*!< \brief Rank of the nearest wall element of each point (-1 if there are no walls). */
+  vector<unsigned short> WallDist_Marker;    /*!< \brief Marker (on its rank) of the nearest wall element of each point. */
+  vector<unsigned long> WallDist_Elem;       /*!< \brief Index (on its rank and marker) of the nearest wall element of each point. */
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -126,8 +132,11 @@ public:
    * \param[in] val_format - Format of the file with the grid information.
    * \param[in] val_iZone - Domain to be read from the grid file.
    * \param[in] val_nZone - Total number of domains in the grid file.
+   * \param[in] val_mesh - Reader to load the grid from instead of the grid file (FVM only, not deleted), e.g.
+   *                       to repartition a grid at runtime (CPartitionedMeshReaderFVM), the coordinates are not rescaled.
    */
-  CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone);
+  CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone,
+                    CMeshReaderFVM *val_mesh = nullptr);
 
   /*!
    * \overload
@@ -312,6 +321,11 @@ public:
     return Global_to_Local_Marker[val_imarker];
   }
 
+  /*!
+   * \brief Get the tags of all the markers of the grid, in the global order (available on all ranks after partitioning).
+   */
+  inline const vector<string>& GetGlobal_Marker_Tags(void) const { return Marker_Tags; }
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -320,8 +334,10 @@ public:
    * \param[in] val_format - Format of the file with the grid information.
    * \param[in] val_iZone - Domain to be read from the grid file.
    * \param[in] val_nZone - Total number of domains in the grid file.
+   * \param[in] val_mesh - Reader to load the grid from, by default one is created for the grid file.
    */
-  void Read_Mesh_FVM(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+  void Read_Mesh_FVM(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone,
+                     CMeshReaderFVM *val_mesh = nullptr);
 
   /*!
    * \brief Reads for the FEM solver the geometry of the grid and adjust the boundary
@@ -383,6 +399,10 @@ public:
 
   /*!
    * \brief Computes the distance to the nearest no-slip wall for each grid node.
+   * \note The search is threaded. With WALL_DISTANCE_DISTRIBUTED each rank only receives the wall elements
+   *       that can be the nearest to its points, instead of all of them. With WALL_DISTANCE_INCREMENTAL,
+   *       subsequent calls (deforming meshes) only search again for the points that moved, or whose nearest
+   *       wall element moved, the other points are only compared with the wall elements that moved.
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeWall_Distance(CConfig *config) override;
@@ -404,6 +424,16 @@ public:
    */
   void SetRCM_Ordering(CConfig *config) override;
 
+  /*!
+   * \brief Set a renumbering of the points along a Hilbert or Morton space-filling curve,
+   *        points that are close in space are then close in memory.
+   * \note The domain points of each rank are sorted by their position along the curve, through
+   *       a regular grid of 2^(63/nDim) cells per dimension over their bounding box. The halo
+   *       points stay at the end, in the same order.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSFC_Ordering(CConfig *config) override;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -536,6 +566,18 @@ public:
    */
   void SetColorGrid_Parallel(CConfig *config) override;
 
+  /*!
+   * \overload
+   * \brief Set the domains for grid partitioning using ParMETIS, adaptively from a previous partition
+   *        (ParMETIS_V3_AdaptiveRepart) to balance measured times, when the grid is repartitioned at runtime.
+   * \note The work estimate of each point (see PARMETIS_*_WEIGHT) is scaled by the time measured on its previous
+   *       rank over the estimated work of that rank, i.e. the points of the slower ranks become heavier.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] previousColor - Previous rank of each point of this linear partition, empty for a new partition.
+   * \param[in] rankTime - Time measured on each rank with the previous partition.
+   */
+  void SetColorGrid_Parallel(CConfig *config, const vector<int>& previousColor, const vector<passivedouble>& rankTime);
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -787,4 +829,27 @@ public:
    */
   void Check_Periodicity(CConfig *config) override;
 
+private:
+  /*!
+   * \brief Renumber the points (coordinates, global indices, and connectivity of the elements).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Old index of each new point.
+   */
+  void SetPoint_Renumbering(CConfig *config, const vector<unsigned long>& Result);
+
+  /*!
+   * \brief Compute the distance to the nearest no-slip wall for some of the points (collective).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] points - Local points for which the distance is computed.
+   */
+  void ComputeWall_Distance(CConfig *config, const vector<unsigned long>& points);
+
+  /*!
+   * \brief Update the wall distance of the points that did not move, and whose nearest wall element did
+   *        not move, by comparing it with the distance to the wall elements that moved (collective).
+   * \param[in] config - Definition of the particular problem.
+   * \return The points that need a full search.
+   */
+  vector<unsigned long> UpdateWall_Distance(CConfig *config);
+
 };
@@ -39,6 +39,7 @@ private:
   su2double *Coord_CG;      /*!< \brief Center-of-gravity of the element. */
   unsigned long *Nodes;   /*!< \brief Vector to store the global nodes of an element. */
   su2double *Normal;        /*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+  bool ExternalStorage;     /*!< \brief Nodes and normal are owned by the geometry (see CGeometry::SetContiguousStorage). */
 
 public:
 
@@ -55,6 +56,14 @@ public:
    */
   ~CEdge(void) override;
 
+  /*!
+   * \brief Move the nodes and normal of the edge to storage owned by someone else.
+   * \note The current values are copied to the new location, the edge no longer releases this memory.
+   * \param[in] val_nodes - Location for the two nodes.
+   * \param[in] val_normal - Location for the normal (nDim).
+   */
+  void SetExternalStorage(unsigned long *val_nodes, su2double *val_normal);
+
   /*!
    * \brief Set the center of gravity of the edge.
    * \param[in] val_coord - Coordinates of all the nodes needed for computing the centre of gravity of an edge.
@@ -43,6 +43,7 @@ private:
   vector<unsigned long> Point;        /*!< \brief Points surrounding the central node of the control volume. */
   vector<long> Edge;                  /*!< \brief Edges that set up a control volume. */
   su2double *Volume;                  /*!< \brief Volume or Area of the control volume in 3D and 2D. */
+  unsigned short nVolume;             /*!< \brief Number of volumes stored (current, and n, n-1 for dual time). */
   su2double Periodic_Volume;          /*!< \brief Missing component of volume or area of a control volume on a periodic marker in 3D and 2D. */
   bool Domain,                        /*!< \brief Indicates if a point must be computed or belong to another boundary */
   Boundary,                           /*!< \brief To see if a point belong to the boundary (including MPI). */
@@ -74,6 +75,7 @@ private:
   su2double MaxLength;                /*!< \brief The maximum cell-center to cell-center length. */
   int *AD_InputIndex,                 /*!< \brief Indices of Coord variables in the adjoint vector. */
   *AD_OutputIndex;                    /*!< \brief Indices of Coord variables in the adjoint vector after having been updated. */
+  bool ExternalStorage;               /*!< \brief Coordinates, volumes and grid velocity are owned by the geometry (see CGeometry::SetContiguousStorage). */
 
 public:
 
@@ -109,6 +111,20 @@ public:
    */
   ~CPoint(void) override;
 
+  /*!
+   * \brief Move the coordinates, volumes, and grid velocity of the point to storage owned by someone else.
+   * \note The current values are copied to the new location, the point no longer releases this memory.
+   * \param[in] val_coord - Location for the coordinates (nDim).
+   * \param[in] val_volume - Location for the volumes (GetnVolume()).
+   * \param[in] val_gridvel - Location for the grid velocity (nDim), ignored if the point has no grid velocity.
+   */
+  void SetExternalStorage(su2double *val_coord, su2double *val_volume, su2double *val_gridvel);
+
+  /*!
+   * \brief Get the number of volumes stored by the point (1, or 3 for time-marching problems).
+   */
+  inline unsigned short GetnVolume(void) const { return nVolume; }
+
   /*!
    * \brief For parallel computation, its indicates if a point must be computed or not.
    * \param[in] val_domain - <code>TRUE</code> if the point belong to the domain; otherwise <code>FALSE</code>.
@@ -270,6 +286,11 @@ public:
    */
   void SetPoint(unsigned long val_point);
 
+  /*!
+   * \brief Sort the points that compose the control volume by index (before the edges are set).
+   */
+  void SortPoint(void);
+
   /*!
    * \brief Set the edges that compose the control volume.
    * \param[in] val_edge - Edge to be added.
@@ -62,6 +62,14 @@ protected:
   vector<string> markerNames;                                /*!< \brief String names for all markers in the mesh file. */
   vector<vector<unsigned long> > surfaceElementConnectivity; /*!< \brief Vector containing the surface element connectivity from the mesh file on a per-marker basis. Only the master node reads and stores this connectivity. */
   
+  /*!
+   * \brief Send the elements of a linear partition (of the elements) to the ranks that own their points.
+   * \note Each rank receives all elements that contain at least one of its points (there is element
+   *       redundancy across ranks), ordered by global index if the input is ordered on each rank.
+   * \param[in,out] connectivity - Elements read by this rank [global index, VTK type, nodes], released on exit.
+   */
+  void DistributeVolumeElements(vector<unsigned long>& connectivity);
+  
 public:
   
   /*!
@@ -79,6 +87,13 @@ public:
    */
   ~CMeshReaderFVM(void);
   
+  /*!
+   * \brief Get the number of nodes of an element.
+   * \param[in] vtkType - VTK type of the element.
+   * \return Number of nodes, 0 for unsupported types.
+   */
+  static unsigned short GetNodesPerElement(unsigned long vtkType);
+  
   /*!
    * \brief Get the physical dimension of the problem (2 or 3).
    * \returns Physical dimension of the problem.
@@ -0,0 +1,93 @@
+/*!
+ * \file CPartitionedMeshReaderFVM.hpp
+ * \brief Header file for the class CPartitionedMeshReaderFVM.
+ *        The implementations are in the <i>CPartitionedMeshReaderFVM.cpp</i> file.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+class CPhysicalGeometry;
+
+/*!
+ * \class CPartitionedMeshReaderFVM
+ * \brief "Reads" a grid that is already partitioned (in memory) into linear partitions for the
+ *        finite volume solver (FVM), to repartition it at runtime (LOAD_REBALANCE).
+ * \note Each rank sends its points, and the volume and surface elements whose first node it owns,
+ *       to the ranks of the linear partition (the master for the surface elements), the halos and
+ *       the send-receive markers are discarded. The rank that owned each point is also recorded,
+ *       it is the initial partition for the adaptive repartitioning.
+ * \author agent
+ */
+class CPartitionedMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  vector<int> previousOwner;  /*!< \brief Rank that owned each point of the linear partition in the partitioned grid. */
+
+  /*!
+   * \brief Send the coordinates of the points of this rank to the ranks of the linear partition.
+   * \param[in] geometry - Partitioned grid.
+   */
+  void SendPointCoordinates(const CPhysicalGeometry *geometry);
+
+  /*!
+   * \brief Send the volume elements whose first node is owned by this rank to the ranks that own their points.
+   * \param[in] geometry - Partitioned grid.
+   */
+  void SendVolumeElementConnectivity(const CPhysicalGeometry *geometry);
+
+  /*!
+   * \brief Gather the surface elements of the physical markers on the master (all ranks store the names).
+   * \param[in] geometry - Partitioned grid.
+   */
+  void GatherSurfaceElementConnectivity(const CPhysicalGeometry *geometry);
+
+public:
+
+  /*!
+   * \brief Constructor of the CPartitionedMeshReaderFVM class (collective).
+   * \param[in] val_config - config object for the current zone, its markers must be those of the partitioned grid.
+   * \param[in] val_iZone  - Current zone index.
+   * \param[in] val_nZone  - Total number of zones.
+   * \param[in] geometry   - Partitioned grid (without periodic points).
+   */
+  CPartitionedMeshReaderFVM(CConfig                 *val_config,
+                            unsigned short          val_iZone,
+                            unsigned short          val_nZone,
+                            const CPhysicalGeometry *geometry);
+
+  /*!
+   * \brief Destructor of the CPartitionedMeshReaderFVM class.
+   */
+  ~CPartitionedMeshReaderFVM(void);
+
+  /*!
+   * \brief Get the rank that owned each point of the linear partition in the partitioned grid.
+   */
+  inline const vector<int>& GetPreviousOwner() const { return previousOwner; }
+
+};
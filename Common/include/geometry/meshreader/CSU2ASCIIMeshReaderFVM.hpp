@@ -33,6 +33,10 @@
 /*!
  * \class CSU2ASCIIMeshReaderFVM
  * \brief Reads a native SU2 ASCII grid into linear partitions for the finite volume solver (FVM).
+ * \note The master scans the file once to read the metadata and to find the byte offsets of the
+ *       linear partitions of the points and elements. Each rank then reads only its byte ranges
+ *       and parses them with multiple threads. The elements are sent to the ranks that own their
+ *       points (as for CGNS meshes).
  * \author: T. Economon
  */
 class CSU2ASCIIMeshReaderFVM: public CMeshReaderFVM {
@@ -66,11 +70,37 @@ private:
   vector<su2double> CoordYVolumePoint; /*!< \brief Y-coordinates of the volume elements touching the actuator disk. */
   vector<su2double> CoordZVolumePoint; /*!< \brief Z-coordinates of the volume elements touching the actuator disk. */
   
+  vector<unsigned long> pointOffsets; /*!< \brief Byte offsets of the first line of each rank's linear partition of the points in the file, the last entry is the end of the section (size+1). */
+  vector<unsigned long> elemOffsets;  /*!< \brief Byte offsets of the first line of each rank's linear partition of the volume elements, the last entry is the end of the section (size+1). */
+  unsigned long markerOffset;         /*!< \brief Byte offset of the NMARK= line. */
+  
+
   /*!
-   * \brief Reads all SU2 ASCII mesh metadata and checks for errors.
+   * \brief Reads all SU2 ASCII mesh metadata, indexes the sections of the file, and checks for errors.
    */
   void ReadMetadata();
   
+  /*!
+   * \brief Finds the byte offsets of the linear partitions of a section of the file (points or elements).
+   * \note The file must be positioned at the start of the section, on exit it is positioned at its end.
+   * \param[in] nLines - Number of lines in the section.
+   * \param[out] offsets - Byte offset of the first line of each rank, and of the end of the section.
+   */
+  void IndexSection(unsigned long nLines, vector<unsigned long>& offsets);
+  
+  /*!
+   * \brief Reads a range of lines of an indexed section of the file.
+   * \param[in] offsets - Byte offsets of the linear partitions of the section (from IndexSection).
+   * \param[in] nLinesSection - Number of lines in the section.
+   * \param[in] firstLine - First line to read.
+   * \param[in] nLines - Number of lines to read.
+   * \param[out] buffer - Contents of the file, each line is null-terminated.
+   * \param[out] lines - Start of each line in the buffer.
+   */
+  void ReadLines(const vector<unsigned long>& offsets, unsigned long nLinesSection,
+                 unsigned long firstLine, unsigned long nLines,
+                 vector<char>& buffer, vector<const char*>& lines);
+  
   /*!
    * \brief Splits a single surface actuator disk boundary into two separate markers (repeated points).
    */
@@ -82,7 +112,7 @@ private:
   void ReadPointCoordinates();
   
   /*!
-   * \brief Reads the interior volume elements from one section of an SU2 zone into linear partitions across all ranks.
+   * \brief Reads a linear partition of the interior volume elements of an SU2 zone and sends them to the ranks that own their points.
    */
   void ReadVolumeElementConnectivity();
   
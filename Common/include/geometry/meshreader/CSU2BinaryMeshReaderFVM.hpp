@@ -0,0 +1,138 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+#include <cstdint>
+
+/*!
+ * \brief Layout of the native SU2 binary mesh format (one zone per file, native byte order).
+ * \note The file is made of:
+ *       - A header of HEADER_SIZE 64-bit unsigned integers, see HEADER_WORD.
+ *       - The coordinates, one record of nDim doubles per point, ordered by global index.
+ *       - The volume elements, one record of SU2_CONN_SIZE 64-bit unsigned integers per element,
+ *         [global index, VTK type, nodes (unused entries are 0)], ordered by global index.
+ *       - The marker table, one record per marker with the name (MARKER_NAME_SIZE characters,
+ *         null-padded), the number of elements, and the offset (in bytes) of its connectivity.
+ *       - The connectivity of the markers, same records as the volume elements (the index is 0).
+ *       All offsets are in bytes from the start of the file. The fixed record sizes allow each rank
+ *       to read only its slice of the points and elements.
+ */
+namespace SU2BinaryMesh {
+  enum : uint64_t {
+    MAGIC_NUMBER = 53553242,    /*!< \brief Hex codes of "SU2B" (as for the restarts), first word of the file. */
+    FORMAT_VERSION = 1,         /*!< \brief Version of the layout. */
+    HEADER_SIZE = 16,           /*!< \brief Number of words in the header (unused words are 0). */
+    MARKER_NAME_SIZE = 64,      /*!< \brief Fixed length of the marker names. */
+    MARKER_RECORD_SIZE = MARKER_NAME_SIZE + 2*sizeof(uint64_t) /*!< \brief Size in bytes of a marker table record. */
+  };
+  enum HEADER_WORD {
+    MAGIC = 0,             /*!< \brief Magic number. */
+    FORMAT = 1,            /*!< \brief Format version. */
+    NDIM = 2,              /*!< \brief Number of dimensions. */
+    NPOINT = 3,            /*!< \brief Number of points. */
+    NELEM = 4,             /*!< \brief Number of volume elements. */
+    NMARKER = 5,           /*!< \brief Number of markers. */
+    OFFSET_COORDS = 6,     /*!< \brief Offset of the coordinates. */
+    OFFSET_ELEMS = 7,      /*!< \brief Offset of the volume elements. */
+    OFFSET_MARKERS = 8     /*!< \brief Offset of the marker table. */
+  };
+}
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note Each rank reads only its slice of the points and of the elements, with MPI-IO in parallel
+ *       or from a memory mapping of the file in serial. The elements are then sent to the ranks
+ *       that own their points (as for CGNS meshes). The master reads the markers.
+ * \author agent
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  string meshFilename;        /*!< \brief Name of the SU2 binary mesh file being read. */
+  unsigned long fileSize = 0; /*!< \brief Size of the file in bytes. */
+  uint64_t header[SU2BinaryMesh::HEADER_SIZE]; /*!< \brief Header of the file. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle;        /*!< \brief MPI file handle. */
+#else
+  const char* mappedFile = nullptr; /*!< \brief Memory mapping of the file. */
+#endif
+
+  /*!
+   * \brief Open (or map) the mesh file, read the header, and perform some basic error checks.
+   */
+  void OpenFile();
+
+  /*!
+   * \brief Close (or unmap) the mesh file.
+   */
+  void CloseFile();
+
+  /*!
+   * \brief Read a contiguous range of bytes from the file.
+   * \param[in] offset - Position of the first byte.
+   * \param[in] sizeInBytes - Number of bytes to read.
+   * \param[out] data - Destination.
+   * \param[in] collective - If all ranks call this function (with their own ranges).
+   */
+  void ReadBytes(unsigned long offset, unsigned long sizeInBytes, void* data, bool collective) const;
+
+  /*!
+   * \brief Reads the grid points of this rank's linear partition.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and sends them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements, the master stores the connectivity, all ranks store the names.
+   */
+  void ReadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void);
+
+};
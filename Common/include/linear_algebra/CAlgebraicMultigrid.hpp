@@ -0,0 +1,253 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Smoothed aggregation algebraic multigrid hierarchy used by the
+ *        AMG preconditioner of CSysMatrix, the implementation is in
+ *        CAlgebraicMultigrid.cpp.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../include/mpi_structure.hpp"
+#include "../../include/omp_structure.hpp"
+
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \brief Hierarchy of coarse levels of a block sparse matrix, built by smoothed aggregation.
+ * \note The points of the finest level (the matrix of CSysMatrix) are grouped into aggregates
+ *       based on the strength of the connections (norms of the off-diagonal blocks), each aggregate
+ *       becomes a point of the next level with the same number of variables. The tentative
+ *       prolongation (piecewise constant per variable) is smoothed with one damped block-Jacobi
+ *       step if the matrix is symmetric (otherwise plain aggregation is used), and the coarse
+ *       operators are the Galerkin products R*A*P with R = P^T, therefore the V-cycle is symmetric
+ *       (CG can be used) if the matrix is. The aggregation does not cross MPI partitions, i.e. the
+ *       coarse levels are local to each rank, the halo exchanges are done by CSysMatrix when
+ *       smoothing the finest level. The coarsest level is solved directly.
+ * \author agent
+ */
+template<class ScalarType>
+class CAlgebraicMultigrid {
+public:
+  enum : unsigned long {NUM_SWEEPS = 2};      /*!< \brief Number of pre and post smoothing sweeps, on each level. */
+
+private:
+  enum : unsigned long {MAXNVAR = 8};         /*!< \brief Maximum number of variables, same as CSysMatrix. */
+  enum : unsigned long {MAX_LEVELS = 12};     /*!< \brief Maximum number of coarse levels. */
+  enum : unsigned long {COARSEST_SIZE = 32};  /*!< \brief Coarsening stops when a level has fewer points than this. */
+  enum : unsigned long {MAX_DENSE_SIZE = 2048}; /*!< \brief Largest coarsest level (points x variables) solved directly. */
+  enum : unsigned long {OMP_MAX_SIZE = 512};  /*!< \brief Max. chunk size used in parallel loops. */
+
+  /*!
+   * \brief Block sparse matrix in compressed row format, used for the coarse operators and the transfer
+   *        operators between levels. The number of columns may differ from the number of rows.
+   */
+  struct CBlockCSR {
+    unsigned long nRow = 0;              /*!< \brief Number of (block) rows. */
+    unsigned long nCol = 0;              /*!< \brief Number of (block) columns. */
+    unsigned long nVar = 0;              /*!< \brief Size of the blocks. */
+    vector<unsigned long> row_ptr;       /*!< \brief Pointers to the first element in each row. */
+    vector<unsigned long> col_ind;       /*!< \brief Column index of each block. */
+    vector<ScalarType> values;           /*!< \brief Entries of the blocks. */
+
+    /*!
+     * \brief Accumulate the product of a block row with a vector, y += row_i * x.
+     */
+    inline void RowProduct(unsigned long iRow, const ScalarType* x, ScalarType* y) const {
+      for (auto k = row_ptr[iRow]; k < row_ptr[iRow+1]; ++k) {
+        const ScalarType* block = &values[k*nVar*nVar];
+        const ScalarType* xj = &x[col_ind[k]*nVar];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            y[iVar] += block[iVar*nVar+jVar] * xj[jVar];
+      }
+    }
+  };
+
+  /*!
+   * \brief Read-only view of the matrix of a level, which is either the CSysMatrix (whose
+   *        columns may refer to halo points) or the Galerkin operator of a coarse level.
+   */
+  struct CMatrixView {
+    unsigned long nRow;                  /*!< \brief Number of rows (owned points). */
+    unsigned long nVar;                  /*!< \brief Size of the blocks. */
+    const unsigned long* row_ptr;        /*!< \brief Pointers to the first element in each row. */
+    const unsigned long* col_ind;        /*!< \brief Column index of each block, columns >= nRow are ignored. */
+    const ScalarType* values;            /*!< \brief Entries of the blocks. */
+    const ScalarType* invDiag;           /*!< \brief Inverse of the diagonal blocks. */
+  };
+
+  /*!
+   * \brief Coarse level of the hierarchy.
+   */
+  struct CLevel {
+    CBlockCSR A;                         /*!< \brief Galerkin operator. */
+    CBlockCSR P;                         /*!< \brief Prolongation from this level to the previous (finer) one. */
+    CBlockCSR R;                         /*!< \brief Restriction, R = P^T. */
+    vector<ScalarType> invDiag;          /*!< \brief Inverse of the diagonal blocks of A. */
+    ScalarType omega = 0.0;              /*!< \brief Relaxation factor for the Jacobi smoother. */
+    mutable vector<ScalarType> x, b, r;  /*!< \brief Solution, rhs, and residual (working memory). */
+  };
+
+  unsigned long nVar = 0;                /*!< \brief Number of variables. */
+  unsigned long nPointDomain = 0;        /*!< \brief Number of points of the finest level. */
+  ScalarType fineOmega = 0.0;            /*!< \brief Relaxation factor for the smoother of the finest level. */
+  vector<CLevel> levels;                 /*!< \brief Coarse levels, from finest to coarsest. */
+
+  bool denseCoarsest = false;            /*!< \brief If the coarsest level is solved directly. */
+  vector<ScalarType> coarseLU;           /*!< \brief LU factorization of the coarsest operator (dense). */
+  vector<unsigned long> coarsePivot;     /*!< \brief Row permutation of the LU factorization. */
+
+  mutable vector<ScalarType> fineResidual; /*!< \brief Residual of the finest level (working memory). */
+
+  /*--- Working memory for the setup phase. ---*/
+  vector<unsigned long> aggregate;       /*!< \brief Aggregate of each point of the level being coarsened. */
+  vector<unsigned long> aggregateSize;   /*!< \brief Number of points in each aggregate. */
+  vector<ScalarType> powerIter[2];       /*!< \brief Vectors for the power iterations. */
+  ScalarType spectralRadius = 1.0;       /*!< \brief Result of the power iterations. */
+  bool addLevel = false;                 /*!< \brief Result of the coarsening of a level. */
+  bool smoothProlongation = true;        /*!< \brief Smoothed (symmetric matrices) or plain aggregation. */
+
+  /*!
+   * \brief Create the next level of the hierarchy by coarsening a matrix.
+   * \param[in] mat - Matrix of the current level.
+   * \param[out] omega - Relaxation factor for the Jacobi smoother of the current level.
+   * \return True if a level was created.
+   */
+  bool Coarsen(const CMatrixView& mat, ScalarType& omega);
+
+  /*!
+   * \brief Group the points of a matrix into aggregates.
+   * \param[in] mat - Matrix being coarsened.
+   * \return Number of aggregates, "aggregate" is set for each point (~0ul if the point is not aggregated).
+   */
+  unsigned long Aggregate(const CMatrixView& mat);
+
+  /*!
+   * \brief Check if the owned part of a matrix is symmetric.
+   * \param[in] mat - Matrix of the finest level.
+   * \return True if the matrix is symmetric up to round-off.
+   */
+  bool IsSymmetric(const CMatrixView& mat) const;
+
+  /*!
+   * \brief Estimate the spectral radius of D^{-1}*A with a few power iterations.
+   * \param[in] mat - Matrix being coarsened.
+   * \return Estimate of the spectral radius.
+   */
+  ScalarType SpectralRadius(const CMatrixView& mat);
+
+  /*!
+   * \brief Factorize the operator of the coarsest level.
+   */
+  void FactorizeCoarsest();
+
+  /*!
+   * \brief Smooth the solution of a coarse level with damped block-Jacobi.
+   * \param[in] iLevel - Index of the level.
+   * \param[in] zeroGuess - If the initial solution is zero.
+   * \param[in] nSweeps - Number of sweeps.
+   */
+  void Smooth(unsigned long iLevel, bool zeroGuess, unsigned long nSweeps) const;
+
+  /*!
+   * \brief Compute the residual r = b - A*x of a coarse level.
+   * \param[in] iLevel - Index of the level.
+   */
+  void Residual(unsigned long iLevel) const;
+
+  /*!
+   * \brief Approximately solve A*x = b on a level (and recursively on the coarser ones).
+   * \param[in] iLevel - Index of the level, "x" is computed from "b".
+   */
+  void VCycle(unsigned long iLevel) const;
+
+public:
+  /*!
+   * \brief Build the hierarchy, the aggregates are recomputed since the matrix coefficients may have changed.
+   * \note This is called by CSysMatrix, all threads should call it.
+   * \param[in] nvar - Number of variables (size of the blocks).
+   * \param[in] npointdomain - Number of owned points (rows).
+   * \param[in] row_ptr - Pointers to the first element in each row.
+   * \param[in] col_ind - Column index of each block.
+   * \param[in] values - Entries of the blocks.
+   * \param[in] invDiag - Inverse of the diagonal blocks (the Jacobi preconditioner).
+   */
+  void Build(unsigned long nvar, unsigned long npointdomain, const unsigned long* row_ptr,
+             const unsigned long* col_ind, const ScalarType* values, const ScalarType* invDiag);
+
+  /*!
+   * \brief Get the number of levels, including the finest.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size()+1; }
+
+  /*!
+   * \brief Get the relaxation factor for the Jacobi smoother of the finest level.
+   */
+  inline ScalarType GetFineRelaxation() const { return fineOmega; }
+
+  /*!
+   * \brief Get the working memory where CSysMatrix stores the residual of the finest level.
+   */
+  inline ScalarType* GetFineResidual() const { return fineResidual.data(); }
+
+  /*!
+   * \brief Apply the coarse grid correction to the solution of the finest level, the residual
+   *        (A*x-b, see GetFineResidual) is restricted, one V-cycle is used on the coarse levels,
+   *        and the result is prolongated and subtracted from the solution.
+   * \note Only the owned points are corrected, the caller needs to update the halos.
+   * \param[in,out] sol - Solution of the finest level.
+   */
+  template<class OtherType>
+  void CoarseGridCorrection(OtherType* sol) const {
+
+    if (levels.empty()) return;
+
+    const auto& coarse = levels[0];
+    const auto chunk = computeStaticChunkSize(max(nPointDomain, coarse.A.nRow), omp_get_max_threads(), OMP_MAX_SIZE);
+
+    /*--- Restriction. ---*/
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iPoint = 0ul; iPoint < coarse.A.nRow; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.b[iPoint*nVar+iVar] = 0.0;
+      coarse.R.RowProduct(iPoint, fineResidual.data(), &coarse.b[iPoint*nVar]);
+    }
+
+    VCycle(0);
+
+    /*--- Prolongation and correction, minus sign as the residual is A*x-b. ---*/
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      ScalarType corr[MAXNVAR] = {0.0};
+      coarse.P.RowProduct(iPoint, coarse.x.data(), corr);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        sol[iPoint*nVar+iVar] -= corr[iVar];
+    }
+  }
+};
@@ -34,6 +34,8 @@
 #include "CSysVector.hpp"
 #include "CSysMatrix.hpp"
 
+#include <functional>
+
 /*!
  * \class CMatrixVectorProduct
  * \brief Abstract base class for defining matrix-vector products
@@ -64,13 +66,14 @@ CMatrixVectorProduct<ScalarType>::~CMatrixVectorProduct() {}
 /*!
  * \class CSysMatrixVectorProduct
  * \brief Specialization of matrix-vector product that uses CSysMatrix class
+ * \note The matrix may be of a different type than the vectors (mixed precision).
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CSysMatrixVectorProduct final : public CMatrixVectorProduct<ScalarType> {
 private:
-  const CSysMatrix<ScalarType>& matrix;  /*!< \brief pointer to matrix that defines the product. */
-  CGeometry* geometry;                   /*!< \brief geometry associated with the matrix. */
-  CConfig* config;                       /*!< \brief config of the problem. */
+  const CSysMatrix<MatrixScalar>& matrix;  /*!< \brief pointer to matrix that defines the product. */
+  CGeometry* geometry;                     /*!< \brief geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief config of the problem. */
 
 public:
   /*!
@@ -79,7 +82,7 @@ public:
    * \param[in] geometry_ref - geometry associated with the problem
    * \param[in] config_ref - config of the problem
    */
-  inline CSysMatrixVectorProduct(const CSysMatrix<ScalarType> & matrix_ref,
+  inline CSysMatrixVectorProduct(const CSysMatrix<MatrixScalar> & matrix_ref,
                                  CGeometry *geometry_ref, CConfig *config_ref) :
     matrix(matrix_ref),
     geometry(geometry_ref),
@@ -139,3 +142,35 @@ public:
     matrix.MatrixVectorProductTransposed(u, v, geometry, config);
   }
 };
+
+
+/*!
+ * \class CMatrixFreeVectorProduct
+ * \brief Specialization of matrix-vector product defined by a function, e.g. for matrix-free
+ *        (finite difference) products computed by the solvers.
+ * \note The function is called by all threads, like the other products.
+ */
+template<class ScalarType>
+class CMatrixFreeVectorProduct final : public CMatrixVectorProduct<ScalarType> {
+public:
+  using FunctionType = std::function<void(const CSysVector<ScalarType>&, CSysVector<ScalarType>&)>;
+
+private:
+  FunctionType function;  /*!< \brief Function that computes the product. */
+
+public:
+  /*!
+   * \brief constructor of the class
+   * \param[in] fun - function that computes v = A*u
+   */
+  inline explicit CMatrixFreeVectorProduct(FunctionType fun) : function(std::move(fun)) {}
+
+  /*!
+   * \brief operator that defines the matrix-free product
+   * \param[in] u - CSysVector that is being multiplied by the (implicit) matrix
+   * \param[out] v - CSysVector that is the result of the product
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    function(u, v);
+  }
+};
@@ -41,6 +41,8 @@
  *
  * See the remarks regarding the CMatrixVectorProduct class. The same
  * idea applies here to the preconditioning operation.
+ * The specializations based on CSysMatrix allow the matrix to be of a different
+ * (usually lower precision) type, "MatrixScalar", than the vectors, "ScalarType".
  */
 template<class ScalarType>
 class CPreconditioner {
@@ -68,13 +70,13 @@ CPreconditioner<ScalarType>::~CPreconditioner() {}
  * \class CJacobiPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CJacobiPreconditioner final : public CPreconditioner<ScalarType> {
 private:
-  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
-  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
-  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
-  bool transp;                           /*!< \brief If the transpose version of the preconditioner is required. */
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                     /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief Pointer to problem configuration. */
+  bool transp;                             /*!< \brief If the transpose version of the preconditioner is required. */
 
 public:
   /*!
@@ -84,7 +86,7 @@ public:
    * \param[in] config_ref - Config of the problem.
    * \param[in] transposed - If the transpose version of the preconditioner is required.
    */
-  inline CJacobiPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+  inline CJacobiPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref,
                                CGeometry *geometry_ref, CConfig *config_ref, bool transposed) :
     sparse_matrix(matrix_ref)
   {
@@ -122,13 +124,13 @@ public:
  * \class CILUPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CILUPreconditioner final : public CPreconditioner<ScalarType> {
 private:
-  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
-  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
-  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
-  bool transp;                           /*!< \brief If the transpose version of the preconditioner is required. */
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                     /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief Pointer to problem configuration. */
+  bool transp;                             /*!< \brief If the transpose version of the preconditioner is required. */
 
 public:
   /*!
@@ -138,7 +140,7 @@ public:
    * \param[in] config_ref - Config of the problem.
    * \param[in] transposed - If the transpose version of the preconditioner is required.
    */
-  inline CILUPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+  inline CILUPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref,
                             CGeometry *geometry_ref, CConfig *config_ref, bool transposed) :
     sparse_matrix(matrix_ref)
   {
@@ -176,12 +178,12 @@ public:
  * \class CLU_SGSPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CLU_SGSPreconditioner final : public CPreconditioner<ScalarType> {
 private:
-  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
-  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
-  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                     /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief Pointer to problem configuration. */
 
 public:
 
@@ -191,7 +193,7 @@ public:
    * \param[in] geometry_ref - Geometry associated with the problem.
    * \param[in] config_ref - Config of the problem.
    */
-  inline CLU_SGSPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+  inline CLU_SGSPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref,
                                CGeometry *geometry_ref, CConfig *config_ref) :
     sparse_matrix(matrix_ref)
   {
@@ -221,12 +223,12 @@ public:
  * \class CLineletPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CLineletPreconditioner final : public CPreconditioner<ScalarType> {
 private:
-  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
-  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
-  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                     /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief Pointer to problem configuration. */
 
 public:
   /*!
@@ -235,7 +237,7 @@ public:
    * \param[in] geometry_ref - Geometry associated with the problem.
    * \param[in] config_ref - Config of the problem.
    */
-  inline CLineletPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+  inline CLineletPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref,
                                 CGeometry *geometry_ref, CConfig *config_ref) :
     sparse_matrix(matrix_ref)
   {
@@ -268,18 +270,69 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses CSysMatrix class, one V-cycle of algebraic multigrid.
+ */
+template<class ScalarType, class MatrixScalar = ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                     /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                         /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CAMGPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref,
+                            CGeometry *geometry_ref, CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner();
+  }
+};
+
+
 /*!
  * \class CPastixPreconditioner
  * \brief Specialization of preconditioner that uses PaStiX to factorize a CSysMatrix.
  */
-template<class ScalarType>
+template<class ScalarType, class MatrixScalar = ScalarType>
 class CPastixPreconditioner final : public CPreconditioner<ScalarType> {
 private:
-  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to the matrix. */
-  CGeometry* geometry;                   /*!< \brief Geometry associated with the problem. */
-  CConfig* config;                       /*!< \brief Configuration of the problem. */
-  unsigned short kind_fact;              /*!< \brief The type of factorization desired. */
-  bool transp;                           /*!< \brief If the transpose version of the preconditioner is required. */
+  CSysMatrix<MatrixScalar>& sparse_matrix; /*!< \brief Pointer to the matrix. */
+  CGeometry* geometry;                     /*!< \brief Geometry associated with the problem. */
+  CConfig* config;                         /*!< \brief Configuration of the problem. */
+  unsigned short kind_fact;                /*!< \brief The type of factorization desired. */
+  bool transp;                             /*!< \brief If the transpose version of the preconditioner is required. */
 
 public:
   /*!
@@ -290,7 +343,7 @@ public:
    * \param[in] kind_factorization - Type of factorization required.
    * \param[in] transposed - If the transpose version of the preconditioner is required.
    */
-  inline CPastixPreconditioner(CSysMatrix<ScalarType> & matrix_ref, CGeometry *geometry_ref,
+  inline CPastixPreconditioner(CSysMatrix<MatrixScalar> & matrix_ref, CGeometry *geometry_ref,
                                CConfig *config_ref, unsigned short kind_factorization, bool transposed) :
     sparse_matrix(matrix_ref)
   {
@@ -31,6 +31,7 @@
 #include "../../include/mpi_structure.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -50,7 +51,7 @@ using namespace std;
  Lapack direct calls only seem to be created for Intel compilers, and it is not worthwhile
  making "getrf" and "getrs" compatible with AD since they are not used as often as "gemm".
 ---*/
-#if defined(__INTEL_COMPILER) && defined(MKL_DIRECT_CALL_SEQ) && !defined(CODI_REVERSE_TYPE)
+#if defined(__INTEL_COMPILER) && defined(MKL_DIRECT_CALL_SEQ) && !defined(CODI_REVERSE_TYPE) && !defined(USE_MIXED_PRECISION)
   #define USE_MKL_LAPACK
 #endif
 #else
@@ -64,6 +65,9 @@ class CGeometry;
 /*!
  * \class CSysMatrix
  * \brief Main class for defining block-compressed-row-storage sparse matrices.
+ * \note The operations that take CSysVectors (products and preconditioners) are templated on the type
+ *       of the vectors, which allows the matrix (and its factorizations) to be stored in a lower precision
+ *       than the Krylov vectors of the linear solvers, see su2mixedfloat.
  * \author A. Bueno, F. Palacios
  */
 template<class ScalarType>
@@ -132,6 +136,8 @@ private:
   mutable CPastixWrapper pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Coarse levels of the AMG preconditioner. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -197,6 +203,19 @@ private:
    */
   inline void MatrixVectorProductTransp(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+  /*!
+   * \brief Versions of the block matrix-vector products for vectors of a different type than the matrix.
+   * \note When the types are the same the non-template (possibly MKL-based) versions above are preferred.
+   */
+  template<class OtherType>
+  inline void MatrixVectorProduct(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+
+  template<class OtherType>
+  inline void MatrixVectorProductAdd(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+
+  template<class OtherType>
+  inline void MatrixVectorProductSub(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+
   /*!
    * \brief Calculates the matrix-matrix product
    */
@@ -205,7 +224,8 @@ private:
   /*!
    * \brief Subtract b from a and store the result in c.
    */
-  inline void VectorSubtraction(const ScalarType *a, const ScalarType *b, ScalarType *c) const {
+  template<class OtherType>
+  inline void VectorSubtraction(const OtherType *a, const OtherType *b, OtherType *c) const {
     for(unsigned long iVar = 0; iVar < nVar; iVar++)
       c[iVar] = a[iVar] - b[iVar];
   }
@@ -249,12 +269,14 @@ private:
 
   /*!
    * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i,i) subblock and rhs.
+   * \note The elimination is performed in the precision of the matrix.
    * \param[in] block_i - Index of the (i,i) diagonal block.
    * \param[in] rhs - Right-hand-side of the linear system.
    * \param[in] transposed - If true the transposed of the block is used (default = false).
    * \return Solution of the linear system (overwritten on rhs).
    */
-  inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed = false) const;
+  template<class OtherType>
+  inline void Gauss_Elimination(unsigned long block_i, OtherType* rhs, bool transposed = false) const;
 
   /*!
    * \brief Inverse diagonal block.
@@ -300,8 +322,9 @@ private:
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
-  inline void UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                           unsigned long col_ub, ScalarType *prod) const;
+  template<class OtherType>
+  inline void UpperProduct(const CSysVector<OtherType> & vec, unsigned long row_i,
+                           unsigned long col_ub, OtherType *prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the lower part of a sparse matrix by a vector.
@@ -310,8 +333,9 @@ private:
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
-  inline void LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                           unsigned long col_lb, ScalarType *prod) const;
+  template<class OtherType>
+  inline void LowerProduct(const CSysVector<OtherType> & vec, unsigned long row_i,
+                           unsigned long col_lb, OtherType *prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the diagonal part of a sparse matrix by a vector.
@@ -319,7 +343,19 @@ private:
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
-  inline void DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<class OtherType>
+  inline void DiagonalProduct(const CSysVector<OtherType> & vec, unsigned long row_i, OtherType *prod) const;
+
+  /*!
+   * \brief One damped block-Jacobi sweep on the finest level of the AMG preconditioner, prod += w*D^{-1}*(vec - A*prod).
+   * \param[in] vec - Right hand side.
+   * \param[in,out] prod - Solution being smoothed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class OtherType>
+  void AMGSmoothingSweep(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
+                         CGeometry *geometry, CConfig *config) const;
 
   /*!
    * \brief Performs the product of i-th row of a sparse matrix by a vector.
@@ -327,7 +363,8 @@ private:
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return Result of the product (stored at *prod_row_vector).
    */
-  void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<class OtherType>
+  void RowProduct(const CSysVector<OtherType> & vec, unsigned long row_i, OtherType *prod) const;
 
 public:
 
@@ -728,7 +765,8 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[out] prod - Result of the product.
    */
-  void MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void MatrixVectorProduct(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                            CGeometry *geometry, CConfig *config) const;
 
   /*!
@@ -753,7 +791,8 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void ComputeJacobiPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                    CGeometry *geometry, CConfig *config) const;
 
   /*!
@@ -769,7 +808,8 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void ComputeILUPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                 CGeometry *geometry, CConfig *config) const;
 
   /*!
@@ -777,7 +817,8 @@ public:
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
    * \param[out] prod - Result of the product A*vec.
    */
-  void ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void ComputeLU_SGSPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                    CGeometry *geometry, CConfig *config) const;
 
   /*!
@@ -793,17 +834,35 @@ public:
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
    * \param[out] prod - Result of the product A*vec.
    */
-  void ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void ComputeLineletPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                     CGeometry *geometry, CConfig *config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid (smoothed aggregation) preconditioner.
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner, i.e. apply one V-cycle of algebraic multigrid.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class OtherType>
+  void ComputeAMGPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
+                                CGeometry *geometry, CConfig *config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
    * \param[in] f - Right hand side (b).
    * \param[out] res - Residual (Ax-b).
    */
-  void ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
-                       CSysVector<ScalarType> & res) const;
+  template<class OtherType>
+  void ComputeResidual(const CSysVector<OtherType> & sol, const CSysVector<OtherType> & f,
+                       CSysVector<OtherType> & res) const;
 
   /*!
    * \brief Factorize matrix using PaStiX.
@@ -821,7 +880,8 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputePastixPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void ComputePastixPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                    CGeometry *geometry, CConfig *config) const;
 
 };
@@ -32,6 +32,8 @@
 
 #include "CSysMatrix.hpp"
 
+#include <type_traits>
+
 #if defined(_MSC_VER)
   #define FORCEINLINE __forceinline
 #elif defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
@@ -78,36 +80,89 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlockTransposed_ILUMatrix(unsigned l
   }
 }
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(const unsigned long n, const T *a, const T *b, T *c) {
+/*--- Block sizes known at compilation. ---*/
+template<unsigned long N>
+using BlockSize = std::integral_constant<unsigned long, N>;
+
+/*---
+ The small dense kernels below take the block size as a template type,
+ either a runtime "unsigned long" or a BlockSize<N>, in the latter case
+ the loop bounds are compile-time constants and the compiler can fully
+ unroll (and vectorize) the loops. BLOCK_SIZE_DISPATCH calls a kernel,
+ the expression in "...", with "blockSize" defined as the constant for
+ the common sizes and as the runtime size for the others. Since nVar is
+ fixed when the matrix is initialized the branch is always predicted.
+---*/
+#define BLOCK_SIZE_CASE(N, ...) case N: { const BlockSize<N> blockSize{}; __VA_ARGS__; break; }
+#define BLOCK_SIZE_DISPATCH(SIZE, ...) switch (SIZE) {                   \
+  BLOCK_SIZE_CASE(1, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(2, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(3, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(4, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(5, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(6, __VA_ARGS__)                                        \
+  BLOCK_SIZE_CASE(7, __VA_ARGS__)                                        \
+  default: { const unsigned long blockSize = SIZE; __VA_ARGS__; break; } \
+}
+
+template<bool alpha, bool beta, bool transp, class SizeType, class T, class U>
+FORCEINLINE void gemv_kernel(const SizeType n, const T *a, const U *b, U *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
-   This is still the traditional "row dot vector" method.
+   This is still the traditional "row dot vector" method. The matrix and
+   the vectors may be of different types (mixed precision), in which
+   case the operations are carried out in the type of the vectors.
+   Without transposition the dot products are accumulated in a local
+   variable, this is the same sequence of operations but the compiler
+   does not have to assume the output may alias the inputs.
   ---*/
   unsigned long i, j;
-  for (i = 0; i < n; i++) {
-    if (!beta) c[i] = 0.0;
-    for (j = 0; j < n; j++) {
-      if (alpha) c[transp? j:i] += a[i*n+j] * b[transp? i:j];
-      else       c[transp? j:i] -= a[i*n+j] * b[transp? i:j];
+  if (!transp) {
+    for (i = 0; i < n; i++) {
+      U sum = beta? c[i] : U(0.0);
+      for (j = 0; j < n; j++) {
+        if (alpha) sum += U(a[i*n+j]) * b[j];
+        else       sum -= U(a[i*n+j]) * b[j];
+      }
+      c[i] = sum;
+    }
+  }
+  else {
+    for (i = 0; i < n; i++) {
+      if (!beta) c[i] = 0.0;
+      for (j = 0; j < n; j++) {
+        if (alpha) c[j] += U(a[i*n+j]) * b[i];
+        else       c[j] -= U(a[i*n+j]) * b[i];
+      }
     }
   }
 }
 
-template<class T>
-FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c) {
+template<bool alpha, bool beta, bool transp, class T, class U>
+FORCEINLINE void gemv_impl(const unsigned long n, const T *a, const U *b, U *c) {
+  BLOCK_SIZE_DISPATCH(n, gemv_kernel<alpha,beta,transp>(blockSize, a, b, c))
+}
+
+template<class SizeType, class T>
+FORCEINLINE void gemm_kernel(const SizeType n, const T *a, const T *b, T *c) {
   /*--- Same deal as for GEMV but here only the type is templated. ---*/
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
-      c[i*n+j] = 0.0;
+      T sum = 0.0;
       for (k = 0; k < n; k++)
-        c[i*n+j] += a[i*n+k] * b[k*n+j];
+        sum += a[i*n+k] * b[k*n+j];
+      c[i*n+j] = sum;
     }
   }
 }
 
+template<class T>
+FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c) {
+  BLOCK_SIZE_DISPATCH(n, gemm_kernel(blockSize, a, b, c))
+}
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
@@ -119,19 +174,19 @@ MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
    Without MKL (default) picture copying the body of gemv_impl
    here and resolving the conditionals at compilation.
   ---*/
-  gemv_impl<ScalarType,true,false,false>(nVar, matrix, vector, product);
+  gemv_impl<true,false,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
-  gemv_impl<ScalarType,true,true,false>(nVar, matrix, vector, product);
+  gemv_impl<true,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
-  gemv_impl<ScalarType,false,true,false>(nVar, matrix, vector, product);
+  gemv_impl<false,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
-  gemv_impl<ScalarType,true,true,true>(nVar, matrix, vector, product);
+  gemv_impl<true,true,true>(nVar, matrix, vector, product);
 }
 
 template<class ScalarType>
@@ -165,44 +220,72 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *m
   MatrixMatrixProductKernel(MatrixMatrixProductJitter, const_cast<ScalarType*>(matrix_a),
                             const_cast<ScalarType*>(matrix_b), product );
 }
-#ifdef CODI_REVERSE_TYPE
-/*--- WHEN using MKL, AND compiling for AD, we need to specialize for su2double to avoid mixing incompatible types. ---*/
-#define MATVECPROD_SPECIALIZATION(NAME) template<> __MATVECPROD_SIGNATURE__(su2double,NAME)
-MATVECPROD_SPECIALIZATION( MatrixVectorProduct ) {
-  gemv_impl<su2double,true,false,false>(nVar, matrix, vector, product);
+/*--- WHEN using MKL, AND compiling for AD or with mixed precision, we need to specialize
+ *    for su2double or float to avoid mixing incompatible types with the dgemm kernels. ---*/
+#define MATVECPROD_SPECIALIZATION(TYPE,NAME) template<> __MATVECPROD_SIGNATURE__(TYPE,NAME)
+#define MATVECPROD_SPECIALIZATIONS(TYPE)                                                           \
+MATVECPROD_SPECIALIZATION( TYPE, MatrixVectorProduct ) {                                           \
+  gemv_impl<true,false,false>(nVar, matrix, vector, product);                                      \
+}                                                                                                  \
+MATVECPROD_SPECIALIZATION( TYPE, MatrixVectorProductAdd ) {                                        \
+  gemv_impl<true,true,false>(nVar, matrix, vector, product);                                       \
+}                                                                                                  \
+MATVECPROD_SPECIALIZATION( TYPE, MatrixVectorProductSub ) {                                        \
+  gemv_impl<false,true,false>(nVar, matrix, vector, product);                                      \
+}                                                                                                  \
+MATVECPROD_SPECIALIZATION( TYPE, MatrixVectorProductTransp ) {                                     \
+  gemv_impl<true,true,true>(nVar, matrix, vector, product);                                        \
+}                                                                                                  \
+template<>                                                                                         \
+FORCEINLINE void CSysMatrix<TYPE>::MatrixMatrixProduct(const TYPE *matrix_a, const TYPE *matrix_b, \
+                                                       TYPE *product) const {                      \
+  gemm_impl<TYPE>(nVar, matrix_a, matrix_b, product);                                              \
 }
 
-MATVECPROD_SPECIALIZATION( MatrixVectorProductAdd ) {
-  gemv_impl<su2double,true,true,false>(nVar, matrix, vector, product);
-}
+#ifdef CODI_REVERSE_TYPE
+MATVECPROD_SPECIALIZATIONS(su2double)
+#endif
+#ifdef USE_MIXED_PRECISION
+MATVECPROD_SPECIALIZATIONS(float)
+#endif
+#undef MATVECPROD_SPECIALIZATIONS
+#undef MATVECPROD_SPECIALIZATION
+#endif // USE_MKL
+
+#undef MATVECPROD_SIGNATURE
+#undef __MATVECPROD_SIGNATURE__
 
-MATVECPROD_SPECIALIZATION( MatrixVectorProductSub ) {
-  gemv_impl<su2double,false,true,false>(nVar, matrix, vector, product);
+#define MIXED_MATVECPROD_SIGNATURE(NAME) template<class ScalarType> template<class OtherType> \
+FORCEINLINE void CSysMatrix<ScalarType>::NAME(const ScalarType *matrix, const OtherType *vector, OtherType *product) const
+
+MIXED_MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
+  gemv_impl<true,false,false>(nVar, matrix, vector, product);
 }
 
-MATVECPROD_SPECIALIZATION( MatrixVectorProductTransp ) {
-  gemv_impl<su2double,true,true,true>(nVar, matrix, vector, product);
+MIXED_MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
+  gemv_impl<true,true,false>(nVar, matrix, vector, product);
 }
 
-template<>
-FORCEINLINE void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *matrix_a, const su2double *matrix_b, su2double *product) const {
-  gemm_impl<su2double>(nVar, matrix_a, matrix_b, product);
+MIXED_MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
+  gemv_impl<false,true,false>(nVar, matrix, vector, product);
 }
-#undef MATVECPROD_SPECIALIZATION
-#endif // CODI_REVERSE_TYPE
-#endif // USE_MKL
 
-#undef MATVECPROD_SIGNATURE
-#undef __MATVECPROD_SIGNATURE__
+#undef MIXED_MATVECPROD_SIGNATURE
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed) const {
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, OtherType* rhs, bool transposed) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
-  ScalarType block[MAXNVAR*MAXNVAR];
+  ScalarType block[MAXNVAR*MAXNVAR], vec[MAXNVAR];
   MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
 
-  Gauss_Elimination(block, rhs);
+  /*--- And the rhs, which may be of a different type. ---*/
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) vec[iVar] = rhs[iVar];
+
+  Gauss_Elimination(block, vec);
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) rhs[iVar] = vec[iVar];
 }
 
 template<class ScalarType>
@@ -226,8 +309,9 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                                                      unsigned long col_ub, ScalarType *prod) const {
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<OtherType> & vec, unsigned long row_i,
+                                                      unsigned long col_ub, OtherType *prod) const {
   unsigned long iVar, index, col_j;
 
   for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
@@ -240,8 +324,9 @@ FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarTyp
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
-                                                      unsigned long col_lb, ScalarType *prod) const {
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<OtherType> & vec, unsigned long row_i,
+                                                      unsigned long col_lb, OtherType *prod) const {
   unsigned long iVar, index, col_j;
 
   for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
@@ -254,8 +339,9 @@ FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarTyp
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec,
-                                                         unsigned long row_i, ScalarType *prod) const {
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<OtherType> & vec,
+                                                         unsigned long row_i, OtherType *prod) const {
 
   MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
 }
@@ -74,6 +74,8 @@ public:
 
 private:
 
+  enum { OMP_MAX_SIZE = 4096 };  /*!< \brief Maximum chunk size used in parallel for loops. */
+
   bool mesh_deform;    /*!< \brief Operate in mesh deformation mode, changes the source of solver options. */
   ScalarType Residual; /*!< \brief Residual at the end of a call to Solve. */
 
@@ -81,6 +83,7 @@ private:
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
   mutable bool smooth_ready; /*!< \brief Indicate if memory used by SMOOTHER is allocated. */
+  mutable bool pcg_ready;    /*!< \brief Indicate if memory used by pipelined CG is allocated. */
 
   mutable VectorType r;      /*!< \brief Residual in CG and BCGSTAB. */
   mutable VectorType A_x;    /*!< \brief Result of matrix-vector product in CG and BCGSTAB. */
@@ -93,6 +96,17 @@ private:
   mutable vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable VectorType u;      /*!< \brief Preconditioned residual in pipelined CG. */
+  mutable VectorType w;      /*!< \brief Pipelined CG "w" vector (w = A * u). */
+  mutable VectorType Mw;     /*!< \brief Preconditioned w in pipelined CG. */
+  mutable VectorType AMw;    /*!< \brief Product of the matrix by Mw in pipelined CG. */
+  mutable VectorType q;      /*!< \brief Pipelined CG "q" vector (q = M * s). */
+  mutable VectorType s;      /*!< \brief Pipelined CG "s" vector (s = A * p). */
+
+  mutable vector<ScalarType> dotLocal;   /*!< \brief Rank-local values of the dot products being reduced (shared by threads). */
+  mutable vector<ScalarType> dotGlobal;  /*!< \brief Result of the reduction of the dot products. */
+  mutable CBaseMPIWrapper::Request dotRequest; /*!< \brief Handle to the non-blocking reduction of the dot products. */
+
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
@@ -166,6 +180,36 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization, with all the projections (and the norm) obtained
+   *        from a single global reduction, the norm of the result is computed from Pythagoras' theorem.
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \note A second pass (another reduction) is performed if the norm of w[i+1] is reduced
+   *       by cancellation in the same way re-orthogonalization is triggered in ModGramSchmidt.
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
+
+  /*!
+   * \brief Compute the rank-local part of several dot products and start their reduction across ranks,
+   *        the reduction is non-blocking (for built-in types) to allow overlap with other operations.
+   * \note All threads must call this method, and then FinishDotProducts to obtain the results. The
+   *       vectors may be modified (e.g. by a matrix-vector product) in between.
+   * \param[in] n - Number of dot products.
+   * \param[in] a - First vector of each product.
+   * \param[in] b - Second vector of each product.
+   */
+  void StartDotProducts(unsigned long n, const VectorType* const* a, const VectorType* const* b) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartDotProducts.
+   * \param[out] res - The dot products, the same in all threads and ranks.
+   */
+  void FinishDotProducts(ScalarType* res) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -237,6 +281,23 @@ public:
                              const PrecondType & precond, ScalarType tol, unsigned long m,
                              ScalarType & residual, bool monitoring, CConfig *config) const;
 
+  /*! \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose), the dot products of each
+   *         iteration are reduced together and overlapped with the preconditioner and matrix-vector product.
+   * \note Mathematically equivalent to CG_LinSolver, at the cost of 5 more vectors and more vector updates.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedCG_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                      const PrecondType & precond, ScalarType tol, unsigned long m,
+                                      ScalarType & residual, bool monitoring, CConfig *config) const;
+
   /*!
    * \brief Flexible Generalized Minimal Residual method
    * \param[in] b - the right hand size vector
@@ -248,10 +309,12 @@ public:
    * \param[out] residual - final normalized residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] classical_gs - Use ClassicalGramSchmidt (fewer global reductions) instead of ModGramSchmidt.
    */
   unsigned long FGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
                                  const PrecondType & precond, ScalarType tol, unsigned long m,
-                                 ScalarType & residual, bool monitoring, CConfig *config) const;
+                                 ScalarType & residual, bool monitoring, CConfig *config,
+                                 bool classical_gs = false) const;
 
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
@@ -287,14 +350,19 @@ public:
 
   /*!
    * \brief Solve the linear system using a Krylov subspace method
+   * \note The matrix may be stored in lower precision than ScalarType (see su2mixedfloat), the Krylov
+   *       vectors are always of ScalarType and the preconditioner is applied in the precision of the matrix.
    * \param[in] Jacobian - Jacobian Matrix for the linear system
    * \param[in] LinSysRes - Linear system residual
    * \param[in,out] LinSysSol - Linear system solution
    * \param[in] geometry -  Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] product - Optional matrix-vector product (e.g. matrix-free) to use instead of the one defined
+   *            by Jacobian, the latter is then only used to build the preconditioner.
    */
-  unsigned long Solve(MatrixType & Jacobian, const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol,
-                      CGeometry *geometry, CConfig *config);
+  template<class MatrixScalar>
+  unsigned long Solve(CSysMatrix<MatrixScalar> & Jacobian, const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol,
+                      CGeometry *geometry, CConfig *config, const ProductType* product = nullptr);
 
   /*!
    * \brief Solve the adjoint linear system using a Krylov subspace method
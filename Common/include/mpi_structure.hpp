@@ -143,6 +143,18 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Start(Request* request);
+
+  static void Startall(int count, Request* array_of_requests);
+
+  static void Request_free(Request* request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -172,6 +184,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -385,6 +400,18 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Start(Request* request);
+
+  static void Startall(int count, Request* array_of_requests);
+
+  static void Request_free(Request* request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -412,6 +439,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
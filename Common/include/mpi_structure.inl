@@ -185,6 +185,28 @@ inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype,
   MPI_Irecv(buf,count,datatype,dest,tag,comm, request);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                   int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Start(Request *request) {
+  MPI_Start(request);
+}
+
+inline void CBaseMPIWrapper::Startall(int count, Request *array_of_requests) {
+  MPI_Startall(count,array_of_requests);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {
   MPI_Wait(request,status);
 }
@@ -231,6 +253,11 @@ inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request* request) {
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
@@ -562,6 +589,18 @@ inline void CBaseMPIWrapper::Isend(void *buf, int count, Datatype datatype, int
 inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype, int source,
                                int tag, Comm comm, Request* request) {}
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype, int dest,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype, int source,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Start(Request* request) {}
+
+inline void CBaseMPIWrapper::Startall(int count, Request* array_of_requests) {}
+
+inline void CBaseMPIWrapper::Request_free(Request* request) {}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {}
 
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {}
@@ -591,6 +630,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request* request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -110,6 +110,17 @@ inline void omp_destroy_lock(omp_lock_t*){}
 #define SU2_OMP_FOR_DYN(CHUNK) SU2_OMP(for schedule(dynamic,CHUNK))
 #define SU2_OMP_FOR_STAT(CHUNK) SU2_OMP(for schedule(static,CHUNK))
 
+/*--- Tasks are not available in OpenMP 2.0 (MSVC), the code then runs sequentially. ---*/
+#if defined(_MSC_VER)
+#define SU2_OMP_TASK
+#define SU2_OMP_TASK_(ARGS)
+#define SU2_OMP_TASKWAIT
+#else
+#define SU2_OMP_TASK SU2_OMP(task)
+#define SU2_OMP_TASK_(ARGS) SU2_OMP(task ARGS)
+#define SU2_OMP_TASKWAIT SU2_OMP(taskwait)
+#endif
+
 
 /*--- Convenience functions (e.g. to compute chunk sizes). ---*/
 
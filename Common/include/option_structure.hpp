@@ -1588,13 +1588,15 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 binary input format. */
 };
 static const MapType<string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 /*!
@@ -1619,7 +1621,10 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  MESH_BINARY             = 20, /*!< \brief SU2 binary mesh format. */
+  HDF5                    = 21, /*!< \brief HDF5 with an XDMF descriptor. */
+  SURFACE_HDF5            = 22  /*!< \brief Surface HDF5 with an XDMF descriptor. */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1640,6 +1645,8 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("CGNS", CGNS)
   MakePair("STL", STL)
   MakePair("STL_BINARY", STL_BINARY)
+  MakePair("HDF5", HDF5)
+  MakePair("SURFACE_HDF5", SURFACE_HDF5)
 };
 
 /*!
@@ -1820,6 +1827,8 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_CG = 11,        /*!< \brief Pipelined conjugate gradient, overlaps the global reductions with the mat-vec and preconditioner. */
+  CGS_FGMRES = 12,          /*!< \brief FGMRES with classical Gram-Schmidt, one global reduction per iteration. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1832,6 +1841,8 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_CONJUGATE_GRADIENT", PIPELINED_CG)
+  MakePair("CGS_FGMRES", CGS_FGMRES)
 };
 
 /*!
@@ -1891,6 +1902,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   PASTIX_ILU= 5,     /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P= 6,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P= 7,  /*!< \brief PaStiX LDLT as preconditioner. */
+  AMG = 8,           /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("JACOBI", JACOBI)
@@ -1900,6 +1912,7 @@ static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
+  MakePair("AMG", AMG)
 };
 
 /*!
@@ -2116,7 +2129,9 @@ enum MPI_QUANTITIES {
   SOLUTION_FEA_OLD     = 26,  /*!< \brief FEA solution old communication. */
   MESH_DISPLACEMENTS   = 27,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      = 28,  /*!< \brief Solution at time n. */
-  SOLUTION_TIME_N1     = 29   /*!< \brief Solution at time n-1. */
+  SOLUTION_TIME_N1     = 29,  /*!< \brief Solution at time n-1. */
+  EDDY_VISCOSITY       = 30,  /*!< \brief Eddy viscosity communication. */
+  RES_TRUNC_ERROR      = 31   /*!< \brief Truncation error (multigrid forcing term) communication. */
 };
 
 /*!
@@ -2133,6 +2148,22 @@ static const MapType<string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Renumbering of the points of each rank.
+ */
+enum ENUM_POINT_ORDERING {
+  NO_POINT_ORDERING = 0,  /*!< \brief Keep the order of the partitioning. */
+  RCM_ORDERING      = 1,  /*!< \brief Reverse Cuthill-McKee, low bandwidth of the matrices (for the ILU and LU-SGS preconditioners). */
+  HILBERT_ORDERING  = 2,  /*!< \brief Hilbert space-filling curve, locality of the data accessed by the edge loops. */
+  MORTON_ORDERING   = 3   /*!< \brief Morton (Z-order) space-filling curve. */
+};
+static const MapType<string, ENUM_POINT_ORDERING> Point_Ordering_Map = {
+  MakePair("NONE",    NO_POINT_ORDERING)
+  MakePair("RCM",     RCM_ORDERING)
+  MakePair("HILBERT", HILBERT_ORDERING)
+  MakePair("MORTON",  MORTON_ORDERING)
+};
+
 /*
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
@@ -0,0 +1,140 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Header file for the compression toolbox (restart files).
+ *        The implementations are in the <i>compression_toolbox.cpp</i> file.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "../datatype_structure.hpp"
+
+/*!
+ * \brief Layout of the compressed SU2 restart files (native byte order).
+ * \note The file is made of:
+ *       - The header, 5 ints {MAGIC_NUMBER, nVar, nPoint, nBlock, FILE_KIND}.
+ *       - The names of the fields, CGNS_STRING_SIZE characters each (as for the binary restarts).
+ *       - The absolute error bound of each field as a double, 0 for lossless fields.
+ *       - For DELTA files, the name of the keyframe file (KEYFRAME_NAME_SIZE characters, null-padded).
+ *       - The block index, one record of RECORD_SIZE 64-bit unsigned integers per block, see RECORD_WORD.
+ *       - The encoded blocks (see CompressionToolbox::EncodeBlock), contiguous and in the order of the index.
+ *       The blocks are consecutive ranges of at most BLOCK_SIZE points in global order, each written by one
+ *       rank, which allows the blocks to be read and decoded in parallel.
+ *       The blocks of DELTA files are encoded relative to the blocks of a KEYFRAME file (in the same directory)
+ *       with the same fields, error bounds, and blocks, i.e. the keyframe is needed to read a delta.
+ */
+namespace SU2CompressedRestart {
+  enum : int {
+    MAGIC_NUMBER = 535533         /*!< \brief Magic number of the binary restarts + 1. */
+  };
+  enum : unsigned long {
+    BLOCK_SIZE = 32768,           /*!< \brief Maximum number of points per block. */
+    RECORD_SIZE = 6,              /*!< \brief Number of words in a block index record. */
+    KEYFRAME_NAME_SIZE = 256      /*!< \brief Fixed length of the name of the keyframe. */
+  };
+  enum FILE_KIND : int {
+    KEYFRAME = 0,                 /*!< \brief The blocks are self-contained. */
+    DELTA = 1                     /*!< \brief The blocks are encoded relative to those of a keyframe. */
+  };
+  enum RECORD_WORD {
+    FIRST_POINT = 0,              /*!< \brief Global index of the first point of the block. */
+    NPOINT = 1,                   /*!< \brief Number of points in the block. */
+    OFFSET = 2,                   /*!< \brief Offset (in bytes) of the block from the start of the file. */
+    SIZE = 3,                     /*!< \brief Size of the encoded block in bytes. */
+    CHECKSUM = 4,                 /*!< \brief Checksum of the encoded block. */
+    REFERENCE = 5                 /*!< \brief Checksum of the keyframe block (DELTA files only, 0 otherwise). */
+  };
+}
+
+/*!
+ * \brief Compression of blocks of restart data (no dependencies on external libraries).
+ * \note A block of nPoint x nVar values (point-major, as in the data sorters) is encoded field by field:
+ *       - Lossless fields are stored bit-exact; lossy fields are quantized to integers such that the
+ *         absolute error is below the error bound of the field.
+ *       - Optionally, the values are stored relative to those of a reference block (e.g. a previous
+ *         solution), as the XOR of the bits of lossless fields, and the difference of the quantized
+ *         values of lossy fields. Regions where the solution does not change become runs of zeros.
+ *       - The bytes of the values are shuffled (all first bytes, then all second bytes, etc.), which
+ *         groups the exponents and high bytes that vary slowly across neighboring points.
+ *       - The shuffled bytes are compressed with a byte-oriented LZ77 codec (similar to LZ4 blocks).
+ */
+namespace CompressionToolbox {
+
+/*!
+ * \brief Compress a block of bytes with the LZ codec.
+ * \param[in] src - Data to compress.
+ * \param[in] srcSize - Number of bytes to compress.
+ * \param[out] dst - Compressed data (resized).
+ */
+void LZCompress(const unsigned char* src, size_t srcSize, std::vector<unsigned char>& dst);
+
+/*!
+ * \brief Decompress a block of bytes compressed with LZCompress.
+ * \param[in] src - Compressed data.
+ * \param[in] srcSize - Number of compressed bytes.
+ * \param[out] dst - Decompressed data.
+ * \param[in] dstSize - Expected number of decompressed bytes.
+ * \return False if the data is corrupted or does not have the expected size.
+ */
+bool LZDecompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
+
+/*!
+ * \brief Checksum (64-bit FNV-1a) of a block of bytes, to detect corrupted files.
+ * \param[in] src - Data.
+ * \param[in] size - Number of bytes.
+ * \return The checksum.
+ */
+uint64_t Checksum(const unsigned char* src, size_t size);
+
+/*!
+ * \brief Encode a block of restart data.
+ * \param[in] data - Values of the block, nPoint x nVar, point-major.
+ * \param[in] nPoint - Number of points in the block.
+ * \param[in] nVar - Number of fields.
+ * \param[in] errorBound - Per field absolute error bound, 0 for lossless fields.
+ * \param[out] block - Encoded block.
+ * \param[in] reference - Optional reference values (same layout as data).
+ */
+void EncodeBlock(const passivedouble* data, unsigned long nPoint, unsigned long nVar,
+                 const passivedouble* errorBound, std::vector<unsigned char>& block,
+                 const passivedouble* reference = nullptr);
+
+/*!
+ * \brief Decode a block of restart data encoded with EncodeBlock.
+ * \param[in] block - Encoded block.
+ * \param[in] blockSize - Size of the encoded block in bytes.
+ * \param[in] nPoint - Number of points in the block.
+ * \param[in] nVar - Number of fields.
+ * \param[in] errorBound - Per field absolute error bound used to encode.
+ * \param[out] data - Values of the block, nPoint x nVar, point-major.
+ * \param[in] reference - Reference values used to encode (decoded values if lossy), if any.
+ * \return False if the block is corrupted.
+ */
+bool DecodeBlock(const unsigned char* block, size_t blockSize, unsigned long nPoint, unsigned long nVar,
+                 const passivedouble* errorBound, passivedouble* data, const passivedouble* reference = nullptr);
+
+}
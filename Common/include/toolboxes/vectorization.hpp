@@ -0,0 +1,253 @@
+/*!
+ * \file vectorization.hpp
+ * \brief Implementation of a portable SIMD type, i.e. a short array of scalars
+ *        whose arithmetic operations the compiler can map to vector instructions.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../omp_structure.hpp"
+
+#include <cstddef>
+#include <cmath>
+
+/*!
+ * \namespace simd
+ * \brief Types and functions for explicit vectorization ("SIMD" programming).
+ * \note The types defined here do not use intrinsics, instead the operations are written
+ *       as fixed-size loops that the compiler maps to the vector instructions available for
+ *       the target architecture (e.g. -march=native). Code written with these types looks
+ *       like scalar code, but each operation is applied to N independent "lanes".
+ */
+namespace simd {
+
+/*!
+ * \brief Preferred (i.e. native) number of lanes for a scalar type.
+ */
+template<class Scalar_t>
+constexpr size_t preferredLen() { return 1; }
+
+template<>
+constexpr size_t preferredLen<double>() {
+#if defined(__AVX512F__)
+  return 8;
+#elif defined(__AVX__)
+  return 4;
+#else
+  return 2;
+#endif
+}
+
+template<>
+constexpr size_t preferredLen<float>() { return 2*preferredLen<double>(); }
+
+/*!
+ * \class Array
+ * \brief Short array of scalars with arithmetic operators, the length should be
+ *        a multiple of the native SIMD length for best performance.
+ * \note Comparison operators return an Array with 1 (true) or 0 (false) in each lane,
+ *       which is used with "select" to implement branches without branching.
+ */
+template<class Scalar_t, size_t N = preferredLen<Scalar_t>()>
+class Array {
+  static_assert(N > 0, "Invalid number of lanes.");
+
+public:
+  using Scalar = Scalar_t;
+  enum : size_t {Size = N};
+  enum : size_t {Align = Size*sizeof(Scalar)};
+
+private:
+  alignas(Align) Scalar x_[N];
+
+public:
+  /*--- Construction. ---*/
+
+  Array() = default;
+
+  /*!
+   * \brief Broadcast a scalar to all lanes.
+   */
+  Array(Scalar x) { bcast(x); }
+
+  /*!
+   * \brief Load from contiguous memory.
+   */
+  explicit Array(const Scalar* ptr) { load(ptr); }
+
+  /*!
+   * \brief Gather from a strided location, the lanes are at "ptr + k*stride".
+   */
+  Array(const Scalar* ptr, size_t stride) {
+    for (size_t k = 0; k < N; ++k) x_[k] = ptr[k*stride];
+  }
+
+  inline void bcast(Scalar x) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < N; ++k) x_[k] = x;
+  }
+
+  inline void load(const Scalar* ptr) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < N; ++k) x_[k] = ptr[k];
+  }
+
+  inline void store(Scalar* ptr) const {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < N; ++k) ptr[k] = x_[k];
+  }
+
+  /*--- Access. ---*/
+
+  inline Scalar& operator[] (size_t k) { return x_[k]; }
+  inline const Scalar& operator[] (size_t k) const { return x_[k]; }
+
+  /*--- Compound assignment operators. ---*/
+
+#define MAKE_COMPOUND(OP)                                   \
+  inline Array& operator OP (const Array& other) {          \
+    SU2_OMP_SIMD                                            \
+    for (size_t k = 0; k < N; ++k) x_[k] OP other.x_[k];    \
+    return *this;                                           \
+  }                                                         \
+  inline Array& operator OP (Scalar other) {                \
+    SU2_OMP_SIMD                                            \
+    for (size_t k = 0; k < N; ++k) x_[k] OP other;          \
+    return *this;                                           \
+  }
+
+  MAKE_COMPOUND(+=)
+  MAKE_COMPOUND(-=)
+  MAKE_COMPOUND(*=)
+  MAKE_COMPOUND(/=)
+#undef MAKE_COMPOUND
+
+  /*--- Unary minus. ---*/
+
+  inline Array operator- () const {
+    Array res;
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < N; ++k) res.x_[k] = -x_[k];
+    return res;
+  }
+};
+
+/*--- Binary arithmetic operators, with arrays and scalars on either side. ---*/
+
+#define MAKE_BINARY(OP, COMPOUND)                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (Array<S,N> a, const Array<S,N>& b) {             \
+  return a COMPOUND b;                                                          \
+}                                                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (Array<S,N> a, S b) { return a COMPOUND b; }      \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (S a, const Array<S,N>& b) {                      \
+  return Array<S,N>(a) COMPOUND b;                                              \
+}
+
+MAKE_BINARY(+, +=)
+MAKE_BINARY(-, -=)
+MAKE_BINARY(*, *=)
+MAKE_BINARY(/, /=)
+#undef MAKE_BINARY
+
+/*--- Comparisons, the result is 1 where the comparison is true and 0 otherwise. ---*/
+
+#define MAKE_COMPARISON(OP)                                                     \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (const Array<S,N>& a, const Array<S,N>& b) {      \
+  Array<S,N> res;                                                               \
+  SU2_OMP_SIMD                                                                  \
+  for (size_t k = 0; k < N; ++k) res[k] = S(a[k] OP b[k]);                      \
+  return res;                                                                   \
+}                                                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (const Array<S,N>& a, S b) {                      \
+  return a OP Array<S,N>(b);                                                    \
+}                                                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> operator OP (S a, const Array<S,N>& b) {                      \
+  return Array<S,N>(a) OP b;                                                    \
+}
+
+MAKE_COMPARISON(<)
+MAKE_COMPARISON(>)
+MAKE_COMPARISON(<=)
+MAKE_COMPARISON(>=)
+#undef MAKE_COMPARISON
+
+/*!
+ * \brief Lane-wise "mask ? a : b", the mask is the result of comparisons.
+ */
+template<class S, size_t N>
+inline Array<S,N> select(const Array<S,N>& mask, const Array<S,N>& a, const Array<S,N>& b) {
+  Array<S,N> res;
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < N; ++k) res[k] = (mask[k] != S(0))? a[k] : b[k];
+  return res;
+}
+
+/*!
+ * \brief Lane-wise logical "not" of a mask.
+ */
+template<class S, size_t N>
+inline Array<S,N> operator! (const Array<S,N>& mask) { return S(1) - mask; }
+
+/*--- Math functions. ---*/
+
+#define MAKE_UNARY_FUN(FUN, IMPL)                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> FUN (const Array<S,N>& a) {                                   \
+  Array<S,N> res;                                                               \
+  SU2_OMP_SIMD                                                                  \
+  for (size_t k = 0; k < N; ++k) res[k] = IMPL(a[k]);                           \
+  return res;                                                                   \
+}
+
+MAKE_UNARY_FUN(sqrt, std::sqrt)
+MAKE_UNARY_FUN(fabs, std::abs)
+MAKE_UNARY_FUN(abs, std::abs)
+#undef MAKE_UNARY_FUN
+
+#define MAKE_BINARY_FUN(FUN, IMPL)                                              \
+template<class S, size_t N>                                                     \
+inline Array<S,N> FUN (const Array<S,N>& a, const Array<S,N>& b) {              \
+  Array<S,N> res;                                                               \
+  SU2_OMP_SIMD                                                                  \
+  for (size_t k = 0; k < N; ++k) res[k] = IMPL;                                 \
+  return res;                                                                   \
+}                                                                               \
+template<class S, size_t N>                                                     \
+inline Array<S,N> FUN (const Array<S,N>& a, S b) { return FUN(a, Array<S,N>(b)); } \
+template<class S, size_t N>                                                     \
+inline Array<S,N> FUN (S a, const Array<S,N>& b) { return FUN(Array<S,N>(a), b); }
+
+MAKE_BINARY_FUN(max, (a[k] < b[k])? b[k] : a[k])
+MAKE_BINARY_FUN(min, (b[k] < a[k])? b[k] : a[k])
+MAKE_BINARY_FUN(pow, std::pow(a[k], b[k]))
+#undef MAKE_BINARY_FUN
+
+} // namespace simd
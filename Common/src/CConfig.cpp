@@ -34,6 +34,7 @@
 
 #include "../include/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 using namespace PrintingToolbox;
 
@@ -643,6 +644,10 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
       nZone = 1;
       break;
     }
+    case SU2_BINARY: {
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -753,6 +758,24 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is in the header of the file. ---*/
+
+      uint64_t header[SU2BinaryMesh::HEADER_SIZE] = {0};
+      ifstream mesh_file(val_mesh_filename.c_str(), ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+      mesh_file.close();
+
+      if (header[SU2BinaryMesh::MAGIC] != SU2BinaryMesh::MAGIC_NUMBER) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      nDim = header[SU2BinaryMesh::NDIM];
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -1014,6 +1037,12 @@ void CConfig::SetPointersNull(void) {
   HistoryOutput = NULL;
   VolumeOutput = NULL;
   VolumeOutputFiles = NULL;
+  Restart_Lossy_Fields = NULL;
+  Marker_Sampling = NULL;
+  Sampling_Fields = NULL;
+  Sampling_Probes = NULL;
+  Probe_Points = NULL;
+  Probe_Lines = NULL;
   ConvField = NULL;
 
   /*--- Variable initialization ---*/
@@ -1672,6 +1701,11 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Solve the implicit flow equations with Jacobian-free (finite difference) products of the residual,
+   *              the approximate Jacobian is only used as the preconditioner. */
+  addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
+  /* DESCRIPTION: Relative step of the finite differences of the Newton-Krylov products. */
+  addDoubleOption("NEWTON_KRYLOV_EPSILON", NewtonKrylov_Epsilon, 1E-8);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_ADJFLOW", Relaxation_Factor_AdjFlow, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1752,6 +1786,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_PARALLEL_AGGLOMERATION\n DESCRIPTION: Agglomerate the coarse grids with the thread-parallel, numbering independent algorithm. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_PARALLEL_AGGLOMERATION", MG_ParallelAgglomeration, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1924,6 +1960,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, SU2 (ASCII) or SU2_BINARY. \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2782,6 +2820,32 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Write the output files in the background (non-blocking MPI-IO) */
+  addBoolOption("OUTPUT_ASYNC", Output_Async, false);
+  /* DESCRIPTION: Compress the binary restart files */
+  addBoolOption("RESTART_COMPRESSION", Restart_Compression, false);
+  /* DESCRIPTION: Fields of the compressed restart files that are stored with loss (only for post-processing) */
+  addStringListOption("RESTART_LOSSY_FIELDS", nRestart_Lossy_Fields, Restart_Lossy_Fields);
+  /* DESCRIPTION: Error bound of the lossy fields, relative to the maximum magnitude of each field */
+  addDoubleOption("RESTART_LOSSY_TOL", Restart_Lossy_Tol, 1e-6);
+  /* DESCRIPTION: Number of compressed restarts of time-domain problems per keyframe, the others are deltas */
+  addUnsignedLongOption("RESTART_KEYFRAME_FREQ", Restart_Keyframe_Freq, 1);
+  /*!\brief MARKER_SAMPLING\n DESCRIPTION: Marker(s) whose fields are sampled to the surface samples file \ingroup Config*/
+  addStringListOption("MARKER_SAMPLING", nMarker_Sampling, Marker_Sampling);
+  /* DESCRIPTION: Output fields sampled on the markers (names as in the volume output files) */
+  addStringListOption("SAMPLING_FIELDS", nSampling_Fields, Sampling_Fields);
+  /* DESCRIPTION: Sampling frequency of the markers (iterations) */
+  addUnsignedLongOption("SAMPLING_FREQ", Sampling_Freq, 1);
+  /* DESCRIPTION: Write the values of all the sampled vertices, or only the marker averages and the probes */
+  addBoolOption("SAMPLING_VERTEX_DATA", Sampling_Vertex_Data, true);
+  /* DESCRIPTION: Coordinates of the surface probes (x, y, z of each probe) */
+  addDoubleListOption("SAMPLING_PROBES", nSampling_Probes, Sampling_Probes);
+  /* DESCRIPTION: Name of the surface samples file */
+  addStringOption("SAMPLING_FILENAME", Sampling_FileName, string("surface_samples"));
+  /* DESCRIPTION: Coordinates of the volume probes (x, y, z of each probe), reported in the history output */
+  addDoubleListOption("PROBE_POINTS", nProbe_Points, Probe_Points);
+  /* DESCRIPTION: Lines of volume probes (x0, y0, z0, x1, y1, z1, number of points of each line) */
+  addDoubleListOption("PROBE_LINES", nProbe_Lines, Probe_Lines);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2810,6 +2874,37 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Compute the convective fluxes of several edges at once using SIMD instructions (if the scheme supports it). */
+  addBoolOption("USE_VECTORIZATION", useVectorization, false);
+
+  /* DESCRIPTION: Points per block of the OpenMP task graph of the flow residual (0 uses the edge coloring loops). */
+  addUnsignedLongOption("RESIDUAL_TASK_BLOCK_SIZE", residualTaskBlockSize, 0);
+
+  /* DESCRIPTION: Load imbalance tolerance of the ParMETIS partitioning (0.05 means 5% above the average). */
+  addDoubleOption("PARMETIS_TOLERANCE", ParMETIS_Tolerance, 0.05);
+  /* DESCRIPTION: Weight of each point in the work estimate of the ParMETIS partitioning. */
+  addLongOption("PARMETIS_POINT_WEIGHT", ParMETIS_PointWeight, 1);
+  /* DESCRIPTION: Weight of each edge of a point in the work estimate of the ParMETIS partitioning. */
+  addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_EdgeWeight, 0);
+  /* DESCRIPTION: Weight of each marker of a point in the work estimate of the ParMETIS partitioning. */
+  addLongOption("PARMETIS_BOUNDARY_WEIGHT", ParMETIS_BoundaryWeight, 0);
+  /* DESCRIPTION: Balance the boundary points as a second constraint of the ParMETIS partitioning. */
+  addBoolOption("PARMETIS_BOUNDARY_CONSTRAINT", ParMETIS_BoundaryConstraint, false);
+  /* DESCRIPTION: Iterations between checks of the load imbalance of the residual computations (0 = no checks). */
+  addUnsignedLongOption("LOAD_IMBALANCE_FREQ", LoadImbalance_Freq, 0);
+  /* DESCRIPTION: Load imbalance (time of the slowest rank over the average, minus 1) above which a warning is issued. */
+  addDoubleOption("LOAD_IMBALANCE_THRESHOLD", LoadImbalance_Threshold, 0.1);
+  /* DESCRIPTION: Repartition the grid (adaptive ParMETIS repartitioning) when the load imbalance is above the threshold. */
+  addBoolOption("LOAD_REBALANCE", LoadRebalance, false);
+  /* DESCRIPTION: Send each rank only the wall elements that can be the nearest to its points, instead of all of them. */
+  addBoolOption("WALL_DISTANCE_DISTRIBUTED", WallDistance_Distributed, false);
+  /* DESCRIPTION: Update the wall distance after each mesh deformation, searching again only for the points that moved or whose nearest wall element moved. */
+  addBoolOption("WALL_DISTANCE_INCREMENTAL", WallDistance_Incremental, false);
+  /* DESCRIPTION: Renumbering of the points of each rank (NONE, RCM, HILBERT, MORTON). */
+  addEnumOption("POINT_ORDERING", Kind_PointOrdering, Point_Ordering_Map, RCM_ORDERING);
+  /* DESCRIPTION: Sort the edges by their (lower, higher) point, i.e. in the order of the points. */
+  addBoolOption("SORT_EDGES", SortEdges, false);
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -3177,6 +3272,16 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- Check if SU2 was build with HDF5 support, as that is required for HDF5 output. ---*/
+#ifndef HAVE_HDF5
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
+    if (VolumeOutputFiles[iVolumeFile] == HDF5 ||
+        VolumeOutputFiles[iVolumeFile] == SURFACE_HDF5) {
+      SU2_MPI::Error(string("HDF5 file requested in option OUTPUT_FILES but SU2 was built without HDF5 support.\n"), CURRENT_FUNCTION);
+    }
+  }
+#endif
+
   /*--- STL_BINARY output not implelemted yet, but already a value in option_structure.hpp---*/
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
     if (VolumeOutputFiles[iVolumeFile] == STL_BINARY){
@@ -3419,6 +3524,19 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   if ((ContinuousAdjoint && !MG_AdjointFlow) ||
       (TimeMarching == TIME_STEPPING)) { nMGLevels = 0; }
 
+  /*--- The parallel agglomeration builds control volumes that span several ranks, the boundaries
+   that pair vertices of the coarse grids (or that restrict data through the vertices) need the
+   original agglomeration. ---*/
+
+  if (MG_ParallelAgglomeration && (nMGLevels > 0) &&
+      ((nMarker_PerBound > 0) || (nMarker_NearFieldBound > 0) ||
+       (nMarker_ActDiskInlet > 0) || Inlet_From_File)) {
+    MG_ParallelAgglomeration = false;
+    if (rank == MASTER_NODE)
+      cout << "WARNING: MG_PARALLEL_AGGLOMERATION is not compatible with periodic, near-field, actuator disk,\n"
+              "         or inlet profile boundaries, the original agglomeration is used." << endl;
+  }
+
   if (Kind_Solver == EULER ||
       Kind_Solver == NAVIER_STOKES ||
       Kind_Solver == RANS ||
@@ -4920,9 +5038,59 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                    CURRENT_FUNCTION);
   }
 
+  if (NewtonKrylov) {
+    if ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))
+      SU2_MPI::Error(string("NEWTON_KRYLOV is only available for the compressible flow solvers (direct problem).\n") +
+                     string("Please select NEWTON_KRYLOV = NO."), CURRENT_FUNCTION);
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+      SU2_MPI::Error("NEWTON_KRYLOV requires TIME_DISCRE_FLOW = EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver == SMOOTHER) || (Kind_Linear_Solver == PASTIX_LU) || (Kind_Linear_Solver == PASTIX_LDLT))
+      SU2_MPI::Error("NEWTON_KRYLOV requires a Krylov LINEAR_SOLVER (e.g. FGMRES).", CURRENT_FUNCTION);
+    if (Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL))
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with low Mach preconditioning.", CURRENT_FUNCTION);
+    if (nMarker_PerBound > 0)
+      SU2_MPI::Error("NEWTON_KRYLOV is not yet compatible with periodic boundaries.", CURRENT_FUNCTION);
+    if (DirectDiff != NO_DERIVATIVE)
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with DIRECT_DIFF.", CURRENT_FUNCTION);
+  }
+
   /*--- 0 in the config file means "disable" which can be done using a very large group. ---*/
   if (edgeColorGroupSize==0) edgeColorGroupSize = 1<<30;
 
+  if ((ParMETIS_PointWeight < 0) || (ParMETIS_EdgeWeight < 0) || (ParMETIS_BoundaryWeight < 0) ||
+      (ParMETIS_PointWeight + ParMETIS_EdgeWeight == 0))
+    SU2_MPI::Error(string("The PARMETIS weights cannot be negative, and the point and edge weights cannot both be 0."),
+                   CURRENT_FUNCTION);
+
+  if (ParMETIS_Tolerance <= 0.0)
+    SU2_MPI::Error("PARMETIS_TOLERANCE must be positive.", CURRENT_FUNCTION);
+
+  if (LoadImbalance_Threshold < 0.0)
+    SU2_MPI::Error("LOAD_IMBALANCE_THRESHOLD cannot be negative.", CURRENT_FUNCTION);
+
+  /*--- The grid is repartitioned at runtime only for single zone steady or unsteady (no grid motion)
+   finite volume flow problems without multigrid, the solution is moved between partitions in memory. ---*/
+  if (LoadRebalance) {
+#ifndef HAVE_PARMETIS
+    SU2_MPI::Error("LOAD_REBALANCE requires ParMETIS (reconfigure with ParMETIS enabled).", CURRENT_FUNCTION);
+#endif
+    if (LoadImbalance_Freq == 0)
+      SU2_MPI::Error("LOAD_REBALANCE requires LOAD_IMBALANCE_FREQ > 0.", CURRENT_FUNCTION);
+
+    const bool flowSolver = (Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS) ||
+                            (Kind_Solver == INC_EULER) || (Kind_Solver == INC_NAVIER_STOKES) || (Kind_Solver == INC_RANS);
+    if (!flowSolver || Multizone_Problem || (nZone > 1) || (nMGLevels > 0) || (TimeMarching == HARMONIC_BALANCE) ||
+        GetGrid_Movement() || GetDynamic_Grid() || (GetnMarker_Periodic() > 0) || GetBoolTurbomachinery() ||
+        Fixed_CL_Mode || Fixed_CM_Mode || Weakly_Coupled_Heat || (Kind_Radiation != NO_RADIATION))
+      SU2_MPI::Error(string("LOAD_REBALANCE is only available for single zone finite volume flow problems\n") +
+                     string("(EULER, NAVIER_STOKES, RANS and the incompressible versions) without multigrid,\n") +
+                     string("grid movement, periodic or turbomachinery markers, fixed CL/CM, or coupled heat/radiation."),
+                     CURRENT_FUNCTION);
+  }
+
+  /*--- The incremental update of the wall distance would not update the derivatives of the distances. ---*/
+  if (DiscreteAdjoint || (DirectDiff != NO_DERIVATIVE)) WallDistance_Incremental = false;
+
 }
 
 void CConfig::SetMarkers(unsigned short val_software) {
@@ -6417,12 +6585,17 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           break;
         case EULER_IMPLICIT:
           cout << "Euler implicit method for the flow equations." << endl;
+          if (NewtonKrylov)
+            cout << "Newton-Krylov mode, Jacobian-free products with relative step " << NewtonKrylov_Epsilon << "." << endl;
           switch (Kind_Linear_Solver) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case CGS_FGMRES:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == CGS_FGMRES)
+                cout << "FGMRES with classical Gram-Schmidt is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6430,6 +6603,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6438,6 +6612,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An AMG"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -6480,6 +6655,16 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_CG:
+              cout << "A pipelined Conjugate Gradient method is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
+            case CGS_FGMRES:
+              cout << "FGMRES with classical Gram-Schmidt is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
           }
           break;
       }
@@ -7830,6 +8015,12 @@ CConfig::~CConfig(void) {
   if (VolumeOutput != NULL) delete [] VolumeOutput;
   if (Mesh_Box_Size != NULL) delete [] Mesh_Box_Size;
   if (VolumeOutputFiles != NULL) delete [] VolumeOutputFiles;
+  if (Restart_Lossy_Fields != NULL) delete [] Restart_Lossy_Fields;
+  if (Marker_Sampling != NULL) delete [] Marker_Sampling;
+  if (Sampling_Fields != NULL) delete [] Sampling_Fields;
+  if (Sampling_Probes != NULL) delete [] Sampling_Probes;
+  if (Probe_Points != NULL) delete [] Probe_Points;
+  if (Probe_Lines != NULL) delete [] Probe_Lines;
 
   if (ConvField != NULL) delete [] ConvField;
 
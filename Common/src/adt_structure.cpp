@@ -27,6 +27,7 @@
  */
 
 #include "../include/adt_structure.hpp"
+#include "../include/omp_structure.hpp"
 
 /* Define the tolerance to decide whether or not a point is inside an element. */
 const su2double tolInsideElem   =  1.e-10;
@@ -334,10 +335,13 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   /*--- Build the tree. ---*/
   BuildADT(nDim, localPointIDs.size(), coorPoints.data());
 
-  /*--- Reserve the memory for frontLeaves and frontLeavesNew,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
+  /*--- Reserve the memory for frontLeaves and frontLeavesNew, which are
+        needed during the tree search. One set per thread, such that the
+        searches are thread safe. ---*/
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+  for (auto& vec : FrontLeaves) vec.reserve(200);
+  for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
 void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
@@ -347,6 +351,10 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
 
   AD_BEGIN_PASSIVE
 
+  /* Vectors used in the tree traversal, of this thread. */
+  auto& frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  auto& frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the nearest node to the central node of the     ---*/
   /*---         root leaf. Note that the distance is the distance squared  ---*/
@@ -693,10 +701,14 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
   BuildADT(2*nDim, nElem, BBoxCoor.data());
 
   /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
-  BBoxTargets.reserve(200);
+        which are needed during the tree search. One set per thread, such
+        that the searches are thread safe. ---*/
+  FrontLeaves.resize(omp_get_max_threads());
+  FrontLeavesNew.resize(omp_get_max_threads());
+  BBoxTargets.resize(omp_get_max_threads());
+  for (auto& vec : FrontLeaves) vec.reserve(200);
+  for (auto& vec : FrontLeavesNew) vec.reserve(200);
+  for (auto& vec : BBoxTargets) vec.reserve(200);
 }
 
 bool CADTElemClass::DetermineContainingElement(const su2double *coor,
@@ -706,6 +718,10 @@ bool CADTElemClass::DetermineContainingElement(const su2double *coor,
                                                su2double       *parCoor,
                                                su2double       *weightsInterpol) {
 
+  /* Vectors used in the tree traversal, of this thread. */
+  auto& frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  auto& frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
      previous search. */
@@ -793,6 +809,11 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
 
   AD_BEGIN_PASSIVE
 
+  /* Vectors used in the tree traversal, of this thread. */
+  auto& frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  auto& frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+  auto& bBoxTargets    = BBoxTargets[omp_get_thread_num()];
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the distance (squared) to the quaranteed distance ---*/
   /*---         of the central bounding box of the root element.             ---*/
@@ -822,7 +843,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
      previous search. */
-  BBoxTargets.clear();
+  bBoxTargets.clear();
   frontLeaves.clear();
   frontLeaves.push_back(0);
 
@@ -861,7 +882,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
           /* Check if the possible minimum distance is less than or equal to
              the currently stored distance. If so, this bounding box is a
              candidate for the actual minimum distance and must be stored
-             in BBoxTargets. */
+             in bBoxTargets. */
           if(posDist2 <= dist) {
 
             /*--- Compute the guaranteed minimum distance for this bounding box. ---*/
@@ -874,9 +895,9 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
               guarDist2 += ds*ds;
             }
 
-            /* Store this bounding box in BBoxTargets and update the currently
+            /* Store this bounding box in bBoxTargets and update the currently
                stored value of the distance squared. */
-            BBoxTargets.push_back(CBBoxTargetClass(kk, posDist2, guarDist2));
+            bBoxTargets.push_back(CBBoxTargetClass(kk, posDist2, guarDist2));
             dist = min(dist, guarDist2);
           }
         }
@@ -939,23 +960,23 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
 
   /* Sort the bounding boxes in increasing order, such that the most likely
      candidates are checked first. */
-  sort(BBoxTargets.begin(), BBoxTargets.end());
+  sort(bBoxTargets.begin(), bBoxTargets.end());
 
   /* Loop over the candidate bounding boxes. */
-  for(unsigned long i=0; i<BBoxTargets.size(); ++i) {
+  for(unsigned long i=0; i<bBoxTargets.size(); ++i) {
 
     /* Break the loop if the possible minimum distance is larger than
        the currently stored value. In that case it does not make sense to
        check the remainder of the bounding boxes, as they are sorted in
        increasing order (based on the possible minimum distance.
        Make sure that at least one bounding box is checked. */
-    if(BBoxTargets[i].possibleMinDist2 > dist) break;
+    if(bBoxTargets[i].possibleMinDist2 > dist) break;
 
     /*--- Compute the distance squared to the element that corresponds to the
           current bounding box. If this distance is less than or equal to
           the current value, overwrite the return information of this function.
           The equal is necessary to avoid problems for extreme situations. ---*/
-    const unsigned long ii = BBoxTargets[i].boundingBoxID;
+    const unsigned long ii = bBoxTargets[i].boundingBoxID;
 
     su2double dist2Elem;
     Dist2ToElement(ii, coor, dist2Elem);
@@ -29,6 +29,12 @@
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/omp_structure.hpp"
 
+/*--- Persistent requests are not available in the AD wrapper of MPI (AMPI). ---*/
+
+#if defined HAVE_MPI && !defined CODI_REVERSE_TYPE && !defined CODI_FORWARD_TYPE
+#define PERSISTENT_P2P_COMMS
+#endif
+
 /*--- Cross product ---*/
 
 #define CROSS(dest,v1,v2) \
@@ -234,6 +240,8 @@ CGeometry::~CGeometry(void) {
   if (bufS_P2PRecv != NULL) delete [] bufS_P2PRecv;
   if (bufS_P2PSend != NULL) delete [] bufS_P2PSend;
 
+  FreePersistentP2PComms();
+
   if (req_P2PSend != NULL) delete [] req_P2PSend;
   if (req_P2PRecv != NULL) delete [] req_P2PRecv;
 
@@ -491,6 +499,10 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
 
   countPerPoint = val_countPerPoint;
 
+  /*--- The persistent requests refer to the old buffers. ---*/
+
+  FreePersistentP2PComms();
+
   /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
   if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
@@ -524,6 +536,20 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
                              unsigned short commType,
                              bool val_reverse) {
 
+#ifdef PERSISTENT_P2P_COMMS
+
+  /*--- Start the persistent recv's, the handles are copied to the generic
+   request array as that is what the callers wait on. ---*/
+
+  if (nP2PRecv > 0) {
+    SetupPersistentP2PComms(commType, val_reverse);
+    auto& requests = persistentP2PRecv[commType != COMM_TYPE_DOUBLE][val_reverse];
+    SU2_MPI::Startall(nP2PRecv, requests.data());
+    copy(requests.begin(), requests.end(), req_P2PRecv);
+  }
+
+#else
+
   /*--- Local variables ---*/
 
   int iMessage, iRecv, offset, nPointP2P, count, source, tag;
@@ -626,6 +652,8 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
 
   }
 
+#endif
+
 }
 
 void CGeometry::PostP2PSends(CGeometry *geometry,
@@ -634,6 +662,17 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
                              int val_iSend,
                              bool val_reverse) {
 
+#ifdef PERSISTENT_P2P_COMMS
+
+  /*--- Start the persistent send as soon as the buffer is loaded. ---*/
+
+  SetupPersistentP2PComms(commType, val_reverse);
+  auto& request = persistentP2PSend[commType != COMM_TYPE_DOUBLE][val_reverse][val_iSend];
+  SU2_MPI::Start(&request);
+  req_P2PSend[val_iSend] = request;
+
+#else
+
   /*--- Local variables ---*/
 
   int iMessage, offset, nPointP2P, count, dest, tag;
@@ -727,6 +766,78 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
   }
 
+#endif
+
+}
+
+void CGeometry::SetupPersistentP2PComms(unsigned short commType, bool val_reverse) {
+
+  if ((commType != COMM_TYPE_DOUBLE) && (commType != COMM_TYPE_UNSIGNED_SHORT))
+    SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+
+  auto& sendRequests = persistentP2PSend[commType != COMM_TYPE_DOUBLE][val_reverse];
+  auto& recvRequests = persistentP2PRecv[commType != COMM_TYPE_DOUBLE][val_reverse];
+
+  if (sendRequests.size() == size_t(nP2PSend) && recvRequests.size() == size_t(nP2PRecv)) return;
+
+  /*--- The messages are the same as those posted by PostP2PRecvs and PostP2PSends,
+   in reverse mode the roles of the send and recv data structures are swapped. ---*/
+
+  const int *nPointRecv = val_reverse? nPoint_P2PSend : nPoint_P2PRecv;
+  const int *nPointSend = val_reverse? nPoint_P2PRecv : nPoint_P2PSend;
+  const int *sources = val_reverse? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const int *dests = val_reverse? Neighbors_P2PRecv : Neighbors_P2PSend;
+
+  su2double *bufDRecv = val_reverse? bufD_P2PSend : bufD_P2PRecv;
+  su2double *bufDSend = val_reverse? bufD_P2PRecv : bufD_P2PSend;
+  unsigned short *bufSRecv = val_reverse? bufS_P2PSend : bufS_P2PRecv;
+  unsigned short *bufSSend = val_reverse? bufS_P2PRecv : bufS_P2PSend;
+
+  recvRequests.resize(nP2PRecv);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const int offset = countPerPoint*nPointRecv[iRecv];
+    const int count = countPerPoint*(nPointRecv[iRecv+1] - nPointRecv[iRecv]);
+    const int source = sources[iRecv];
+
+    if (commType == COMM_TYPE_DOUBLE)
+      SU2_MPI::Recv_init(&(bufDRecv[offset]), count, MPI_DOUBLE, source,
+                         source+1, MPI_COMM_WORLD, &(recvRequests[iRecv]));
+    else
+      SU2_MPI::Recv_init(&(bufSRecv[offset]), count, MPI_UNSIGNED_SHORT, source,
+                         source+1, MPI_COMM_WORLD, &(recvRequests[iRecv]));
+  }
+
+  sendRequests.resize(nP2PSend);
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const int offset = countPerPoint*nPointSend[iSend];
+    const int count = countPerPoint*(nPointSend[iSend+1] - nPointSend[iSend]);
+
+    if (commType == COMM_TYPE_DOUBLE)
+      SU2_MPI::Send_init(&(bufDSend[offset]), count, MPI_DOUBLE, dests[iSend],
+                         rank+1, MPI_COMM_WORLD, &(sendRequests[iSend]));
+    else
+      SU2_MPI::Send_init(&(bufSSend[offset]), count, MPI_UNSIGNED_SHORT, dests[iSend],
+                         rank+1, MPI_COMM_WORLD, &(sendRequests[iSend]));
+  }
+
+}
+
+void CGeometry::FreePersistentP2PComms() {
+
+  for (auto& requestsOfType : persistentP2PSend)
+    for (auto& requests : requestsOfType) {
+      for (auto& request : requests) SU2_MPI::Request_free(&request);
+      requests.clear();
+    }
+
+  for (auto& requestsOfType : persistentP2PRecv)
+    for (auto& requests : requestsOfType) {
+      for (auto& request : requests) SU2_MPI::Request_free(&request);
+      requests.clear();
+    }
+
 }
 
 void CGeometry::InitiateComms(CGeometry *geometry,
@@ -1552,6 +1663,16 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 
 }
 
+void CGeometry::SortPoint_Connectivity(void) {
+
+  /*--- The edges are numbered in the order of their lower point, and then in the order
+   in which the higher point appears in the neighbors of the lower point. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SortPoint();
+
+}
+
 void CGeometry::SetEdges(void) {
   unsigned long iPoint, jPoint;
   long iEdge;
@@ -1582,6 +1703,37 @@ void CGeometry::SetEdges(void) {
       iEdge = FindEdge(iPoint, jPoint);
       if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
     }
+
+  SetContiguousStorage();
+}
+
+void CGeometry::SetContiguousStorage(void) {
+
+  /*--- Allocate new containers first, objects that already refer to the
+   *    current storage copy their values before it is released. ---*/
+
+  su2matrix<unsigned long> newEdgeNodes(nEdge, 2);
+  su2activematrix newEdgeNormals(nEdge, nDim);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++)
+    edge[iEdge]->SetExternalStorage(newEdgeNodes[iEdge], newEdgeNormals[iEdge]);
+
+  const bool gridVel = (nPoint > 0) && (node[0]->GetGridVel() != nullptr);
+  const unsigned short nVolume = (nPoint > 0)? node[0]->GetnVolume() : 1;
+
+  su2activematrix newPointCoords(nPoint, nDim);
+  su2activematrix newPointVolumes(nPoint, nVolume);
+  su2activematrix newPointGridVel(gridVel? nPoint : 0, nDim);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetExternalStorage(newPointCoords[iPoint], newPointVolumes[iPoint],
+                                     gridVel? newPointGridVel[iPoint] : nullptr);
+
+  edgeNodes = move(newEdgeNodes);
+  edgeNormals = move(newEdgeNormals);
+  pointCoords = move(newPointCoords);
+  pointVolumes = move(newPointVolumes);
+  pointGridVel = move(newPointGridVel);
 }
 
 void CGeometry::SetFaces(void) {
@@ -4149,3 +4301,47 @@ void CGeometry::SetNaturalElementColoring()
   /*--- In parallel, set the group size to nElem to protect client code. ---*/
   if (omp_get_max_threads() > 1) elemColorGroupSize = nElem;
 }
+
+const CCompressedSparsePatternUL& CGeometry::GetMarkerColoring(const CConfig *config)
+{
+  /*--- Build if required. ---*/
+  if (markerColoring.empty() && (nMarker > 0)) {
+
+    /*--- Create a sparse pattern from the points of each marker. ---*/
+    vector<unsigned long> points;
+    su2vector<unsigned long> outerPtr(nMarker+1);
+    outerPtr(0) = 0;
+
+    for (unsigned short iMarker = 0; iMarker < nMarker; ++iMarker) {
+      const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+      if ((kindBC != SEND_RECEIVE) && (kindBC != PERIODIC_BOUNDARY)) {
+        for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; ++iVertex)
+          points.push_back(vertex[iMarker][iVertex]->GetNode());
+      }
+      outerPtr(iMarker+1) = points.size();
+    }
+
+    if (points.empty()) {
+      markerColoring = createNaturalColoring(nMarker);
+    }
+    else {
+      su2vector<unsigned long> innerIdx(points.size());
+      for (auto i = 0ul; i < points.size(); ++i) innerIdx(i) = points[i];
+
+      CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
+      markerColoring = colorSparsePattern(pattern);
+    }
+
+    /*--- If the coloring fails, one color per marker (i.e. sequential). ---*/
+    if (markerColoring.empty()) {
+      su2vector<unsigned long> colorPtr(nMarker+1), colorIdx(nMarker);
+      for (unsigned short iMarker = 0; iMarker < nMarker; ++iMarker) {
+        colorPtr(iMarker) = iMarker;
+        colorIdx(iMarker) = iMarker;
+      }
+      colorPtr(nMarker) = nMarker;
+      markerColoring = CCompressedSparsePatternUL(move(colorPtr), move(colorIdx));
+    }
+  }
+  return markerColoring;
+}
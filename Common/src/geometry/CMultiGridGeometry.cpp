@@ -29,6 +29,52 @@
 #include "../../include/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 
+#include <array>
+#include <numeric>
+
+namespace {
+
+/*--- Send the values in sendBuf[iRank] to each rank, the values received from all ranks are returned
+ in the order of the ranks, and nRecv is set to the number of values received from each rank. ---*/
+
+template<class T>
+vector<T> ExchangeWithRanks(const vector<vector<T> >& sendBuf, SU2_MPI::Datatype type, vector<int>& nRecv) {
+
+  const int size = SU2_MPI::GetSize();
+  vector<int> nSend(size), sendDisp(size, 0), recvDisp(size, 0);
+  nRecv.assign(size, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 1; iRank < size; iRank++) {
+    sendDisp[iRank] = sendDisp[iRank-1] + nSend[iRank-1];
+    recvDisp[iRank] = recvDisp[iRank-1] + nRecv[iRank-1];
+  }
+
+  vector<T> sendFlat, recvFlat(recvDisp[size-1] + nRecv[size-1]);
+  sendFlat.reserve(sendDisp[size-1] + nSend[size-1]);
+  for (const auto& buf : sendBuf) sendFlat.insert(sendFlat.end(), buf.begin(), buf.end());
+
+  SU2_MPI::Alltoallv(sendFlat.data(), nSend.data(), sendDisp.data(), type,
+                     recvFlat.data(), nRecv.data(), recvDisp.data(), type, MPI_COMM_WORLD);
+  return recvFlat;
+}
+
+/*--- Bijective mixing of the lower 57 bits of a global index, the result is used to break the ties
+ between seed candidates without favoring any direction of the (original) numbering. ---*/
+
+unsigned long MixGlobalIndex(unsigned long index) {
+  const unsigned long mask = (1ul << 57) - 1;
+  unsigned long h = index & mask;
+  h = ((h ^ (h >> 29)) * 0xbf58476d1ce4e5b9ul) & mask;
+  h = ((h ^ (h >> 27)) * 0x94d049bb133111ebul) & mask;
+  return h ^ (h >> 31);
+}
+
+}
+
 
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
 
@@ -86,544 +132,565 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   }
 
-  /*--- Create the coarse grid structure using as baseline the fine grid ---*/
+  /*--- The parallel agglomeration builds the aggregates in rounds of independent seeds, across the
+   partitions, otherwise the greedy (queue based) agglomeration is used, first on the boundaries and
+   then on the volume, and the halo control volumes copy the agglomeration of the donor rank. ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+  parallelAgglomeration = config->GetMG_ParallelAgglomeration();
 
-  nPointNode = fine_grid->GetnPoint();
-  node = new CPoint*[fine_grid->GetnPoint()];
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+  if (parallelAgglomeration) {
+    SetParallelAgglomeration(fine_grid, config);
+  }
+  else {
 
-    /*--- Create node structure ---*/
+    /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-    node[iPoint] = new CPoint(nDim, iPoint, config);
+    nPointNode = fine_grid->GetnPoint();
+    node = new CPoint*[fine_grid->GetnPoint()];
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
 
-    /*--- Set the indirect agglomeration to false ---*/
+      /*--- Create node structure ---*/
 
-    node[iPoint]->SetAgglomerate_Indirect(false);
-  }
+      node[iPoint] = new CPoint(nDim, iPoint, config);
+
+      /*--- Set the indirect agglomeration to false ---*/
 
-  Index_CoarseCV = 0;
+      node[iPoint]->SetAgglomerate_Indirect(false);
+    }
 
-  /*--- The first step is the boundary agglomeration. ---*/
+    CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
 
-  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+    Index_CoarseCV = 0;
 
-    for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
-      iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
+    /*--- The first step is the boundary agglomeration. ---*/
 
-      /*--- If the element has not being previously agglomerated and it belongs
-       to the physical domain, then the agglomeration is studied ---*/
+    for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
 
-      if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
-          (fine_grid->node[iPoint]->GetDomain()) &&
-          (GeometricalCheck(iPoint, fine_grid, config))) {
+      for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
+        iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
 
-        nChildren = 1;
+        /*--- If the element has not being previously agglomerated and it belongs
+         to the physical domain, then the agglomeration is studied ---*/
 
-        /*--- We set an index for the parent control volume ---*/
+        if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
+            (fine_grid->node[iPoint]->GetDomain()) &&
+            (GeometricalCheck(iPoint, fine_grid, config))) {
 
-        fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+          nChildren = 1;
 
-        /*--- We add the seed point (child) to the parent control volume ---*/
+          /*--- We set an index for the parent control volume ---*/
 
-        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-        agglomerate_seed = true; counter = 0; marker_seed = iMarker;
+          fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
 
-        /*--- For a particular point in the fine grid we save all the markers
-         that are in that point ---*/
+          /*--- We add the seed point (child) to the parent control volume ---*/
 
-        for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-          if (fine_grid->node[iPoint]->GetVertex(jMarker) != -1) {
-            copy_marker[counter] = jMarker;
-            counter++;
-          }
+          node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+          agglomerate_seed = true; counter = 0; marker_seed = iMarker;
 
-        /*--- To aglomerate a vertex it must have only one physical bc!!
-         This can be improved. If there is only a marker, it is a good
-         candidate for agglomeration ---*/
+          /*--- For a particular point in the fine grid we save all the markers
+           that are in that point ---*/
 
-        if (counter == 1) agglomerate_seed = true;
+          for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
+            if (fine_grid->node[iPoint]->GetVertex(jMarker) != -1) {
+              copy_marker[counter] = jMarker;
+              counter++;
+            }
 
-        /*--- If there are two markers, we will aglomerate if one of the
-         marker is SEND_RECEIVE ---*/
+          /*--- To aglomerate a vertex it must have only one physical bc!!
+           This can be improved. If there is only a marker, it is a good
+           candidate for agglomeration ---*/
 
-        if (counter == 2) {
-          if ((config->GetMarker_All_KindBC(copy_marker[0]) == SEND_RECEIVE) ||
-              (config->GetMarker_All_KindBC(copy_marker[1]) == SEND_RECEIVE)) agglomerate_seed = true;
-          else agglomerate_seed = false;
-        }
+          if (counter == 1) agglomerate_seed = true;
 
-        /*--- If there are more than 2 markers, the aglomeration will be discarted ---*/
+          /*--- If there are two markers, we will aglomerate if one of the
+           marker is SEND_RECEIVE ---*/
 
-        if (counter > 2) agglomerate_seed = false;
+          if (counter == 2) {
+            if ((config->GetMarker_All_KindBC(copy_marker[0]) == SEND_RECEIVE) ||
+                (config->GetMarker_All_KindBC(copy_marker[1]) == SEND_RECEIVE)) agglomerate_seed = true;
+            else agglomerate_seed = false;
+          }
 
-        /*--- If the seed can be agglomerated, we try to agglomerate more points ---*/
+          /*--- If there are more than 2 markers, the aglomeration will be discarted ---*/
 
-        if (agglomerate_seed) {
+          if (counter > 2) agglomerate_seed = false;
 
-          /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+          /*--- If the seed can be agglomerated, we try to agglomerate more points ---*/
 
-          for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
+          if (agglomerate_seed) {
 
-            CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+            /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-            /*--- The new point can be agglomerated ---*/
+            for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+              CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
 
-              /*--- We set the value of the parent ---*/
+              /*--- The new point can be agglomerated ---*/
 
-              fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+              if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
 
-              /*--- We set the value of the child ---*/
+                /*--- We set the value of the parent ---*/
 
-              node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-              nChildren++;
-            }
+                fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-          }
+                /*--- We set the value of the child ---*/
+
+                node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+                nChildren++;
+              }
 
-          Suitable_Indirect_Neighbors.clear();
+            }
+
+            Suitable_Indirect_Neighbors.clear();
 
-          if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
-            SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+            if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
+              SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
-          /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+            /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
 
-          for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
+            for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
 
-            CVPoint = Suitable_Indirect_Neighbors[iNode];
+              CVPoint = Suitable_Indirect_Neighbors[iNode];
 
-            /*--- The new point can be agglomerated ---*/
+              /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+              if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
 
-              /*--- We set the value of the parent ---*/
+                /*--- We set the value of the parent ---*/
 
-              fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+                fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-              /*--- We set the indirect agglomeration information ---*/
+                /*--- We set the indirect agglomeration information ---*/
 
-              if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
-                node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
+                if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
+                  node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
 
-              /*--- We set the value of the child ---*/
+                /*--- We set the value of the child ---*/
 
-              node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-              nChildren++;
+                node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+                nChildren++;
+              }
             }
-          }
 
 
-        }
+          }
 
-        /*--- Update the number of child of the control volume ---*/
+          /*--- Update the number of child of the control volume ---*/
 
-        node[Index_CoarseCV]->SetnChildren_CV(nChildren);
-        Index_CoarseCV++;
+          node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+          Index_CoarseCV++;
+        }
       }
     }
-  }
-
-  /*--- Agglomerate all the nodes that have more than one physical boundary condition,
-   Maybe here we can add the posibility of merging the vertex that have the same number,
-   and kind  of markers---*/
 
-  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++)
-    for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
-      iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
-      if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
-          (fine_grid->node[iPoint]->GetDomain())) {
-        fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
-        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-        node[Index_CoarseCV]->SetnChildren_CV(1);
-        Index_CoarseCV++;
+    /*--- Agglomerate all the nodes that have more than one physical boundary condition,
+     Maybe here we can add the posibility of merging the vertex that have the same number,
+     and kind  of markers---*/
+
+    for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++)
+      for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
+        iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
+        if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
+            (fine_grid->node[iPoint]->GetDomain())) {
+          fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+          node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+          node[Index_CoarseCV]->SetnChildren_CV(1);
+          Index_CoarseCV++;
+        }
       }
-    }
 
-  /*--- Update the queue with the results from the boundary agglomeration ---*/
+    /*--- Update the queue with the results from the boundary agglomeration ---*/
 
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
 
-    /*--- The CV has been agglomerated, remove form the list ---*/
+      /*--- The CV has been agglomerated, remove form the list ---*/
 
-    if (fine_grid->node[iPoint]->GetAgglomerate() == true) {
+      if (fine_grid->node[iPoint]->GetAgglomerate() == true) {
 
-      MGQueue_InnerCV.RemoveCV(iPoint);
+        MGQueue_InnerCV.RemoveCV(iPoint);
 
-    }
+      }
 
-    else {
+      else {
 
-      /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
+        /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
 
-      priority = 0;
-      for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
-        jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
-        if (fine_grid->node[jPoint]->GetAgglomerate() == true) priority++;
+        priority = 0;
+        for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
+          jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+          if (fine_grid->node[jPoint]->GetAgglomerate() == true) priority++;
+        }
+        MGQueue_InnerCV.MoveCV(iPoint, priority);
       }
-      MGQueue_InnerCV.MoveCV(iPoint, priority);
     }
-  }
 
-  /*--- Agglomerate the domain nodes ---*/
+    /*--- Agglomerate the domain nodes ---*/
 
-  iteration = 0;
-  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
+    iteration = 0;
+    while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
 
-    iPoint = MGQueue_InnerCV.NextCV();
-    iteration ++;
+      iPoint = MGQueue_InnerCV.NextCV();
+      iteration ++;
 
-    /*--- If the element has not being previously agglomerated, belongs to the physical domain,
-     and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
+      /*--- If the element has not being previously agglomerated, belongs to the physical domain,
+       and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
 
-    if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
-        (fine_grid->node[iPoint]->GetDomain()) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
+      if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
+          (fine_grid->node[iPoint]->GetDomain()) &&
+          (GeometricalCheck(iPoint, fine_grid, config))) {
 
-      nChildren = 1;
+        nChildren = 1;
 
-      /*--- We set an index for the parent control volume ---*/
+        /*--- We set an index for the parent control volume ---*/
 
-      fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+        fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
 
-      /*--- We add the seed point (child) to the parent control volume ---*/
+        /*--- We add the seed point (child) to the parent control volume ---*/
 
-      node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
 
-      /*--- Update the queue with the seed point (remove the seed and
-       increase the priority of the neighbors) ---*/
+        /*--- Update the queue with the seed point (remove the seed and
+         increase the priority of the neighbors) ---*/
 
-      MGQueue_InnerCV.Update(iPoint, fine_grid);
+        MGQueue_InnerCV.Update(iPoint, fine_grid);
 
-      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+        /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-      for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
+        for (iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode ++) {
 
-        CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+          CVPoint = fine_grid->node[iPoint]->GetPoint(iNode);
 
-        /*--- Determine if the CVPoint can be agglomerated ---*/
+          /*--- Determine if the CVPoint can be agglomerated ---*/
 
-        if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
-            (fine_grid->node[CVPoint]->GetDomain()) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
+          if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
+              (fine_grid->node[CVPoint]->GetDomain()) &&
+              (GeometricalCheck(CVPoint, fine_grid, config))) {
 
-          /*--- We set the value of the parent ---*/
+            /*--- We set the value of the parent ---*/
 
-          fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+            fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-          /*--- We set the value of the child ---*/
+            /*--- We set the value of the child ---*/
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+            node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+            nChildren++;
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of the neighbors) ---*/
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
 
-        }
+          }
 
-      }
+        }
 
-      /*--- Subrotuine to identify the indirect neighbors ---*/
+        /*--- Subrotuine to identify the indirect neighbors ---*/
 
-      Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
-        SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+        Suitable_Indirect_Neighbors.clear();
+        if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
+          SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
-      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+        /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
 
-      for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
+        for (iNode = 0; iNode < Suitable_Indirect_Neighbors.size(); iNode ++) {
 
-        CVPoint = Suitable_Indirect_Neighbors[iNode];
+          CVPoint = Suitable_Indirect_Neighbors[iNode];
 
-        /*--- The new point can be agglomerated ---*/
+          /*--- The new point can be agglomerated ---*/
 
-        if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
-            (fine_grid->node[CVPoint]->GetDomain())) {
+          if ((fine_grid->node[CVPoint]->GetAgglomerate() == false) &&
+              (fine_grid->node[CVPoint]->GetDomain())) {
 
-          /*--- We set the value of the parent ---*/
+            /*--- We set the value of the parent ---*/
 
-          fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
+            fine_grid->node[CVPoint]->SetParent_CV(Index_CoarseCV);
 
-          /*--- We set the indirect agglomeration information ---*/
+            /*--- We set the indirect agglomeration information ---*/
 
-          if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
-            node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
+            if (fine_grid->node[CVPoint]->GetAgglomerate_Indirect())
+              node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
 
-          /*--- We set the value of the child ---*/
+            /*--- We set the value of the child ---*/
 
-          node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
-          nChildren++;
+            node[Index_CoarseCV]->SetChildren_CV(nChildren, CVPoint);
+            nChildren++;
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of the neighbors) ---*/
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
 
+          }
         }
-      }
 
-      /*--- Update the number of control of childrens ---*/
+        /*--- Update the number of control of childrens ---*/
 
-      node[Index_CoarseCV]->SetnChildren_CV(nChildren);
-      Index_CoarseCV++;
-    }
-    else {
+        node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+        Index_CoarseCV++;
+      }
+      else {
 
-      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
-       move the point to the lowest priority ---*/
+        /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
+         move the point to the lowest priority ---*/
 
-      MGQueue_InnerCV.MoveCV(iPoint, -1);
-    }
+        MGQueue_InnerCV.MoveCV(iPoint, -1);
+      }
 
-  }
+    }
 
-  /*--- Add all the elements that have not being agglomerated, in the previous stage ---*/
+    /*--- Add all the elements that have not being agglomerated, in the previous stage ---*/
 
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
-    if ((fine_grid->node[iPoint]->GetAgglomerate() == false) && (fine_grid->node[iPoint]->GetDomain())) {
+    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+      if ((fine_grid->node[iPoint]->GetAgglomerate() == false) && (fine_grid->node[iPoint]->GetDomain())) {
 
-      nChildren = 1;
-      fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
-      if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
-        node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
-      node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
-      node[Index_CoarseCV]->SetnChildren_CV(nChildren);
-      Index_CoarseCV++;
+        nChildren = 1;
+        fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
+        if (fine_grid->node[iPoint]->GetAgglomerate_Indirect())
+          node[Index_CoarseCV]->SetAgglomerate_Indirect(true);
+        node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
+        node[Index_CoarseCV]->SetnChildren_CV(nChildren);
+        Index_CoarseCV++;
 
+      }
     }
-  }
 
-  nPointDomain = Index_CoarseCV;
+    nPointDomain = Index_CoarseCV;
 
-  /*--- Check that there are no hanging nodes ---*/
+    /*--- Check that there are no hanging nodes ---*/
 
-  unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
-  unsigned short iChildren;
+    unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
+    unsigned short iChildren;
 
-  /*--- Find the point surrounding a point ---*/
+    /*--- Find the point surrounding a point ---*/
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
-      for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
-        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
-        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
+      for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
+        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+        for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
+          iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+          iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+          if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        }
       }
     }
-  }
 
-  /*--- Detect isolated points and merge them with its correct neighbor ---*/
+    /*--- Detect isolated points and merge them with its correct neighbor ---*/
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
+    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
 
-    if (node[iCoarsePoint]->GetnPoint() == 1) {
+      if (node[iCoarsePoint]->GetnPoint() == 1) {
 
-      /*--- Find the neighbor of the isolated point. This neighbor is the right control volume ---*/
+        /*--- Find the neighbor of the isolated point. This neighbor is the right control volume ---*/
 
-      iCoarsePoint_Complete = node[iCoarsePoint]->GetPoint(0);
+        iCoarsePoint_Complete = node[iCoarsePoint]->GetPoint(0);
 
-      /*--- Add the children to the connected control volume (and modify it parent indexing).
-       Identify the child CV from the finest grid and added to the correct control volume.
-       Set the parent CV of iFinePoint. Instead of using the original
-       (iCoarsePoint) one use the new one (iCoarsePoint_Complete) ---*/
+        /*--- Add the children to the connected control volume (and modify it parent indexing).
+         Identify the child CV from the finest grid and added to the correct control volume.
+         Set the parent CV of iFinePoint. Instead of using the original
+         (iCoarsePoint) one use the new one (iCoarsePoint_Complete) ---*/
 
-      nChildren = node[iCoarsePoint_Complete]->GetnChildren_CV();
+        nChildren = node[iCoarsePoint_Complete]->GetnChildren_CV();
 
-      for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
-        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
-        node[iCoarsePoint_Complete]->SetChildren_CV(nChildren, iFinePoint);
-        nChildren++;
-        fine_grid->node[iFinePoint]->SetParent_CV(iCoarsePoint_Complete);
-      }
+        for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
+          iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+          node[iCoarsePoint_Complete]->SetChildren_CV(nChildren, iFinePoint);
+          nChildren++;
+          fine_grid->node[iFinePoint]->SetParent_CV(iCoarsePoint_Complete);
+        }
 
-      /*--- Update the number of children control volumes ---*/
+        /*--- Update the number of children control volumes ---*/
 
-      node[iCoarsePoint_Complete]->SetnChildren_CV(nChildren);
-      node[iCoarsePoint]->SetnChildren_CV(0);
+        node[iCoarsePoint_Complete]->SetnChildren_CV(nChildren);
+        node[iCoarsePoint]->SetnChildren_CV(0);
 
+      }
     }
-  }
 
-  //  unsigned long iPointFree = nPointDomain-1;
-  //  iCoarsePoint = 0;
-  //
-  //  do {
-  //
-  //    if (node[iCoarsePoint]->GetnChildren_CV() == 0) {
-  //
-  //      while (node[iPointFree]->GetnChildren_CV() == 0) {
-  //        Index_CoarseCV--;
-  //        iPointFree--;
-  //      }
-  //
-  //      nChildren = node[iPointFree]->GetnChildren_CV();
-  //      for (iChildren = 0; iChildren <  nChildren; iChildren ++) {
-  //        iFinePoint = node[iPointFree]->GetChildren_CV(iChildren);
-  //        node[iCoarsePoint]->SetChildren_CV(iChildren, iFinePoint);
-  //        fine_grid->node[iFinePoint]->SetParent_CV(iCoarsePoint);
-  //      }
-  //      node[iCoarsePoint]->SetnChildren_CV(nChildren);
-  //      node[iPointFree]->SetnChildren_CV(0);
-  //
-  //      Index_CoarseCV--;
-  //      iPointFree--;
-  //
-  //    }
-  //
-  //    iCoarsePoint++;
-  //
-  //  } while ((iCoarsePoint-1) < Index_CoarseCV);
-  //
-  //  nPointDomain = Index_CoarseCV;
-
-  /*--- Reset the point surrounding a point ---*/
-
-  for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-    node[iCoarsePoint]->ResetPoint();
-  }
+    //  unsigned long iPointFree = nPointDomain-1;
+    //  iCoarsePoint = 0;
+    //
+    //  do {
+    //
+    //    if (node[iCoarsePoint]->GetnChildren_CV() == 0) {
+    //
+    //      while (node[iPointFree]->GetnChildren_CV() == 0) {
+    //        Index_CoarseCV--;
+    //        iPointFree--;
+    //      }
+    //
+    //      nChildren = node[iPointFree]->GetnChildren_CV();
+    //      for (iChildren = 0; iChildren <  nChildren; iChildren ++) {
+    //        iFinePoint = node[iPointFree]->GetChildren_CV(iChildren);
+    //        node[iCoarsePoint]->SetChildren_CV(iChildren, iFinePoint);
+    //        fine_grid->node[iFinePoint]->SetParent_CV(iCoarsePoint);
+    //      }
+    //      node[iCoarsePoint]->SetnChildren_CV(nChildren);
+    //      node[iPointFree]->SetnChildren_CV(0);
+    //
+    //      Index_CoarseCV--;
+    //      iPointFree--;
+    //
+    //    }
+    //
+    //    iCoarsePoint++;
+    //
+    //  } while ((iCoarsePoint-1) < Index_CoarseCV);
+    //
+    //  nPointDomain = Index_CoarseCV;
+
+    /*--- Reset the point surrounding a point ---*/
+
+    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
+      node[iCoarsePoint]->ResetPoint();
+    }
 
-  /*--- Dealing with MPI parallelization, the objective is that the received nodes must be agglomerated
-   in the same way as the donor nodes. Send the node agglomeration information of the donor
-   (parent and children), Sending only occurs with MPI ---*/
+    /*--- Dealing with MPI parallelization, the objective is that the received nodes must be agglomerated
+     in the same way as the donor nodes. Send the node agglomeration information of the donor
+     (parent and children), Sending only occurs with MPI ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+          (config->GetMarker_All_SendRecv(iMarker) > 0)) {
 
-      MarkerS = iMarker;  MarkerR = iMarker+1;
+        MarkerS = iMarker;  MarkerR = iMarker+1;
 
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
+  #ifdef HAVE_MPI
+        send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+        receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+  #endif
 
-      nVertexS = fine_grid->nVertex[MarkerS];   nVertexR = fine_grid->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;               nBufferR_Vector = nVertexR;
+        nVertexS = fine_grid->nVertex[MarkerS];   nVertexR = fine_grid->nVertex[MarkerR];
+        nBufferS_Vector = nVertexS;               nBufferR_Vector = nVertexR;
 
-      /*--- Allocate Receive and send buffers  ---*/
+        /*--- Allocate Receive and send buffers  ---*/
 
-      Buffer_Receive_Children = new unsigned long [nBufferR_Vector];
-      Buffer_Send_Children = new unsigned long [nBufferS_Vector];
+        Buffer_Receive_Children = new unsigned long [nBufferR_Vector];
+        Buffer_Send_Children = new unsigned long [nBufferS_Vector];
 
-      Buffer_Receive_Parent = new unsigned long [nBufferR_Vector];
-      Buffer_Send_Parent = new unsigned long [nBufferS_Vector];
+        Buffer_Receive_Parent = new unsigned long [nBufferR_Vector];
+        Buffer_Send_Parent = new unsigned long [nBufferS_Vector];
 
-      /*--- Copy the information that should be sended ---*/
+        /*--- Copy the information that should be sended ---*/
 
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Children[iVertex] = iPoint;
-        Buffer_Send_Parent[iVertex] = fine_grid->node[iPoint]->GetParent_CV();
-      }
+        for (iVertex = 0; iVertex < nVertexS; iVertex++) {
+          iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+          Buffer_Send_Children[iVertex] = iPoint;
+          Buffer_Send_Parent[iVertex] = fine_grid->node[iPoint]->GetParent_CV();
+        }
 
-#ifdef HAVE_MPI
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Children, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,0,
-                   Buffer_Receive_Children, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_Parent, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,1,
-                   Buffer_Receive_Parent, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,1, MPI_COMM_WORLD, &status);
-#else
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Children[iVertex] = Buffer_Send_Children[iVertex];
-        Buffer_Receive_Parent[iVertex] = Buffer_Send_Parent[iVertex];
-      }
-#endif
+  #ifdef HAVE_MPI
+        /*--- Send/Receive information using Sendrecv ---*/
+        SU2_MPI::Sendrecv(Buffer_Send_Children, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,0,
+                     Buffer_Receive_Children, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,0, MPI_COMM_WORLD, &status);
+        SU2_MPI::Sendrecv(Buffer_Send_Parent, nBufferS_Vector, MPI_UNSIGNED_LONG, send_to,1,
+                     Buffer_Receive_Parent, nBufferR_Vector, MPI_UNSIGNED_LONG, receive_from,1, MPI_COMM_WORLD, &status);
+  #else
+        /*--- Receive information without MPI ---*/
+        for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+          Buffer_Receive_Children[iVertex] = Buffer_Send_Children[iVertex];
+          Buffer_Receive_Parent[iVertex] = Buffer_Send_Parent[iVertex];
+        }
+  #endif
 
-      /*--- Deallocate send buffer ---*/
+        /*--- Deallocate send buffer ---*/
 
-      delete [] Buffer_Send_Children;
-      delete [] Buffer_Send_Parent;
+        delete [] Buffer_Send_Children;
+        delete [] Buffer_Send_Parent;
 
-      /*--- Create a list of the parent nodes without repeated parents ---*/
+        /*--- Create a list of the parent nodes without repeated parents ---*/
 
-      Aux_Parent.clear();
-      for (iVertex = 0; iVertex < nVertexR; iVertex++)
-        Aux_Parent.push_back (Buffer_Receive_Parent[iVertex]);
+        Aux_Parent.clear();
+        for (iVertex = 0; iVertex < nVertexR; iVertex++)
+          Aux_Parent.push_back (Buffer_Receive_Parent[iVertex]);
 
-      sort(Aux_Parent.begin(), Aux_Parent.end());
-      it = unique(Aux_Parent.begin(), Aux_Parent.end());
-      Aux_Parent.resize(it - Aux_Parent.begin());
+        sort(Aux_Parent.begin(), Aux_Parent.end());
+        it = unique(Aux_Parent.begin(), Aux_Parent.end());
+        Aux_Parent.resize(it - Aux_Parent.begin());
 
-      /*--- Allocate some structures ---*/
+        /*--- Allocate some structures ---*/
 
-      Parent_Remote = new unsigned long[nVertexR];
-      Children_Remote = new unsigned long[nVertexR];
-      Parent_Local = new unsigned long[nVertexR];
-      Children_Local = new unsigned long[nVertexR];
+        Parent_Remote = new unsigned long[nVertexR];
+        Children_Remote = new unsigned long[nVertexR];
+        Parent_Local = new unsigned long[nVertexR];
+        Children_Local = new unsigned long[nVertexR];
 
-      /*--- Create the local vector and remote for the parents and the children ---*/
+        /*--- Create the local vector and remote for the parents and the children ---*/
 
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
-        Parent_Remote[iVertex] = Buffer_Receive_Parent[iVertex];
+          Parent_Remote[iVertex] = Buffer_Receive_Parent[iVertex];
 
-        /*--- We use the same sorting as in the donor domain ---*/
+          /*--- We use the same sorting as in the donor domain ---*/
 
-        for (jVertex = 0; jVertex < Aux_Parent.size(); jVertex++) {
-          if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
-            Parent_Local[iVertex] = jVertex + Index_CoarseCV;
-            break;
+          for (jVertex = 0; jVertex < Aux_Parent.size(); jVertex++) {
+            if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
+              Parent_Local[iVertex] = jVertex + Index_CoarseCV;
+              break;
+            }
           }
-        }
 
-        Children_Remote[iVertex] = Buffer_Receive_Children[iVertex];
-        Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
+          Children_Remote[iVertex] = Buffer_Receive_Children[iVertex];
+          Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
 
-      }
+        }
 
-      Index_CoarseCV += Aux_Parent.size();
+        Index_CoarseCV += Aux_Parent.size();
 
-      nChildren_MPI = new unsigned short [Index_CoarseCV];
-      for (iParent = 0; iParent < Index_CoarseCV; iParent++)
-        nChildren_MPI[iParent] = 0;
+        nChildren_MPI = new unsigned short [Index_CoarseCV];
+        for (iParent = 0; iParent < Index_CoarseCV; iParent++)
+          nChildren_MPI[iParent] = 0;
 
-      /*--- Create the final structure ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        /*--- Create the final structure ---*/
+        for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
-        /*--- Be careful, it is possible that a node change the agglomeration configuration, the priority
-         is always, when receive the information ---*/
+          /*--- Be careful, it is possible that a node change the agglomeration configuration, the priority
+           is always, when receive the information ---*/
 
-        fine_grid->node[Children_Local[iVertex]]->SetParent_CV(Parent_Local[iVertex]);
-        node[Parent_Local[iVertex]]->SetChildren_CV(nChildren_MPI[Parent_Local[iVertex]], Children_Local[iVertex]);
-        nChildren_MPI[Parent_Local[iVertex]]++;
-        node[Parent_Local[iVertex]]->SetnChildren_CV(nChildren_MPI[Parent_Local[iVertex]]);
-        node[Parent_Local[iVertex]]->SetDomain(false);
+          fine_grid->node[Children_Local[iVertex]]->SetParent_CV(Parent_Local[iVertex]);
+          node[Parent_Local[iVertex]]->SetChildren_CV(nChildren_MPI[Parent_Local[iVertex]], Children_Local[iVertex]);
+          nChildren_MPI[Parent_Local[iVertex]]++;
+          node[Parent_Local[iVertex]]->SetnChildren_CV(nChildren_MPI[Parent_Local[iVertex]]);
+          node[Parent_Local[iVertex]]->SetDomain(false);
 
-      }
+        }
 
-      /*--- Deallocate auxiliar structures ---*/
+        /*--- Deallocate auxiliar structures ---*/
 
-      delete[] nChildren_MPI;
-      delete[] Parent_Remote;
-      delete[] Children_Remote;
-      delete[] Parent_Local;
-      delete[] Children_Local;
+        delete[] nChildren_MPI;
+        delete[] Parent_Remote;
+        delete[] Children_Remote;
+        delete[] Parent_Local;
+        delete[] Children_Local;
 
-      /*--- Deallocate receive buffer ---*/
+        /*--- Deallocate receive buffer ---*/
 
-      delete [] Buffer_Receive_Children;
-      delete [] Buffer_Receive_Parent;
+        delete [] Buffer_Receive_Children;
+        delete [] Buffer_Receive_Parent;
+
+      }
 
     }
 
-  }
+    /*--- Update the number of points after the MPI agglomeration ---*/
 
-  /*--- Update the number of points after the MPI agglomeration ---*/
+    nPoint = Index_CoarseCV;
 
-  nPoint = Index_CoarseCV;
+  }
 
   /*--- Console output with the summary of the agglomeration ---*/
 
   Local_nPointCoarse = nPoint;
   Local_nPointFine = fine_grid->GetnPoint();
 
+  /*--- With the parallel agglomeration the halo CVs are not counted, so that the agglomeration
+   rate (and therefore the CFL and the number of levels) does not depend on the number of ranks. ---*/
+
+  if (parallelAgglomeration) {
+    Local_nPointCoarse = nPointDomain;
+    Local_nPointFine = fine_grid->GetnPointDomain();
+  }
+
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
@@ -927,14 +994,416 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
 
 }
 
+void CMultiGridGeometry::SetParallelAgglomeration(CGeometry *fine_grid, CConfig *config) {
+
+  const unsigned long nPointFine = fine_grid->GetnPoint();
+  const unsigned long nPointDomainFine = fine_grid->GetnPointDomain();
+
+  /*--- Seed of the agglomerate of a fine point: global index (ULONG_MAX if the point is not decided),
+   rank, and local index of the seed, its physical marker plus one, and its priority. ---*/
+
+  enum {SEED_GLOBAL, SEED_RANK, SEED_INDEX, SEED_MARKER, SEED_PRIORITY, SEED_SIZE};
+  using SeedInfo = array<unsigned long, SEED_SIZE>;
+  const SeedInfo noSeed = {{ULONG_MAX, 0, 0, 0, 0}};
+
+  auto exchangeSeeds = [fine_grid](vector<SeedInfo>& seeds) {
+    fine_grid->ExchangeHaloValues<unsigned long>(SEED_SIZE, false,
+      [&seeds](unsigned long iPoint, unsigned short iCol) { return seeds[iPoint][iCol]; },
+      [&seeds](unsigned long iPoint, unsigned short iCol, unsigned long val) { seeds[iPoint][iCol] = val; });
+  };
+
+  auto exchangeValues = [fine_grid](vector<unsigned long>& values) {
+    fine_grid->ExchangeHaloValues<unsigned long>(1, false,
+      [&values](unsigned long iPoint, unsigned short) { return values[iPoint]; },
+      [&values](unsigned long iPoint, unsigned short, unsigned long val) { values[iPoint] = val; });
+  };
+
+  /*--- Physical marker of each point plus one (SEND_RECEIVE markers are ignored). The points with more than
+   one physical marker, or that fail the geometrical check, are fixed as single point agglomerates. A seed
+   can only take points of its own marker, or volume points, therefore boundary points are never taken
+   by volume seeds. ---*/
+
+  vector<unsigned long> marker(nPointFine, 0), fixed(nPointFine, 0), indirect(nPointFine, 0);
+  vector<SeedInfo> parent(nPointFine, noSeed);
+
+  auto compatible = [&marker](const SeedInfo& seed, unsigned long iPoint) {
+    return (marker[iPoint] == 0) || (marker[iPoint] == seed[SEED_MARKER]);
+  };
+
+  SU2_OMP_PARALLEL_(for schedule(static,512))
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+    unsigned short nPhysical = 0;
+    for (unsigned short iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+      if ((fine_grid->node[iPoint]->GetVertex(iMarker) != -1) &&
+          (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE)) {
+        marker[iPoint] = iMarker+1;
+        nPhysical++;
+      }
+    }
+    indirect[iPoint] = fine_grid->node[iPoint]->GetAgglomerate_Indirect();
+
+    if ((nPhysical > 1) || !GeometricalCheck(iPoint, fine_grid, config)) {
+      fixed[iPoint] = true;
+      parent[iPoint] = {{fine_grid->node[iPoint]->GetGlobalIndex(), static_cast<unsigned long>(rank),
+                         iPoint, marker[iPoint], 0}};
+    }
+  }
+
+  fine_grid->ExchangeHaloValues<unsigned long>(3, false,
+    [&](unsigned long iPoint, unsigned short iCol) {
+      return (iCol == 0)? marker[iPoint] : (iCol == 1)? fixed[iPoint] : indirect[iPoint]; },
+    [&](unsigned long iPoint, unsigned short iCol, unsigned long val) {
+      ((iCol == 0)? marker : (iCol == 1)? fixed : indirect)[iPoint] = val; });
+
+  exchangeSeeds(parent);
+
+  unsigned long anyIndirect = 0, Global_anyIndirect = 0;
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++)
+    anyIndirect = max(anyIndirect, indirect[iPoint]);
+
+  SU2_MPI::Allreduce(&anyIndirect, &Global_anyIndirect, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+  /*--- Rounds of seed selection and agglomeration, until all domain points (of all ranks) are decided.
+   Each rank decides the parent of the points it owns, from the values of its neighbors (halos included). ---*/
+
+  vector<unsigned long> priority(nPointFine, 0), maxPriority(nPointFine, 0);
+  vector<char> undecided(nPointFine), seed(nPointFine);
+  vector<SeedInfo> first(nPointFine, noSeed), second(nPointFine, noSeed), third(nPointFine, noSeed);
+
+  while (true) {
+
+    unsigned long nUndecided = 0, Global_nUndecided = 0;
+    for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+      undecided[iPoint] = (parent[iPoint][SEED_GLOBAL] == ULONG_MAX);
+      if (iPoint < nPointDomainFine) nUndecided += undecided[iPoint];
+    }
+
+    SU2_MPI::Allreduce(&nUndecided, &Global_nUndecided, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    if (Global_nUndecided == 0) break;
+
+    /*--- Priority of the undecided points, boundary points first, then the points with more decided
+     neighbors (which makes the agglomeration advance as a front), then the mixed global index. ---*/
+
+    SU2_OMP_PARALLEL_(for schedule(static,512))
+    for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+      if (!undecided[iPoint]) continue;
+      unsigned long nDecided = 0;
+      for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++)
+        nDecided += !undecided[fine_grid->node[iPoint]->GetPoint(iNode)];
+
+      priority[iPoint] = ((marker[iPoint] != 0)? (1ul << 63) : 0) | (min(nDecided, 63ul) << 57) |
+                         MixGlobalIndex(fine_grid->node[iPoint]->GetGlobalIndex());
+    }
+
+    exchangeValues(priority);
+
+    /*--- Highest priority of the undecided points in the 1-neighborhood of each undecided point. ---*/
+
+    SU2_OMP_PARALLEL_(for schedule(static,512))
+    for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+      if (!undecided[iPoint]) continue;
+      maxPriority[iPoint] = priority[iPoint];
+      for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++) {
+        const auto jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+        if (undecided[jPoint]) maxPriority[iPoint] = max(maxPriority[iPoint], priority[jPoint]);
+      }
+    }
+
+    exchangeValues(maxPriority);
+
+    /*--- The seeds have the highest priority in their 2-neighborhood (priorities are unique), therefore
+     they are at least 3 edges apart and each undecided point is adjacent to at most one seed. ---*/
+
+    SU2_OMP_PARALLEL_(for schedule(static,512))
+    for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+      if (!undecided[iPoint]) continue;
+      bool isSeed = (priority[iPoint] == maxPriority[iPoint]);
+      for (unsigned short iNode = 0; isSeed && (iNode < fine_grid->node[iPoint]->GetnPoint()); iNode++) {
+        const auto jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+        if (undecided[jPoint]) isSeed = (priority[iPoint] == maxPriority[jPoint]);
+      }
+      if (isSeed) {
+        parent[iPoint] = {{fine_grid->node[iPoint]->GetGlobalIndex(), static_cast<unsigned long>(rank),
+                           iPoint, marker[iPoint], priority[iPoint]}};
+      }
+    }
+
+    exchangeSeeds(parent);
+
+    for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++)
+      seed[iPoint] = undecided[iPoint] && (parent[iPoint][SEED_GLOBAL] != ULONG_MAX);
+
+    /*--- The undecided points join the adjacent seed if they are compatible. The undecided neighbors of
+     seeds that allow indirect agglomeration are also the origins of the second neighbors. ---*/
+
+    SU2_OMP_PARALLEL_(for schedule(static,512))
+    for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+      if (!undecided[iPoint] || seed[iPoint]) continue;
+      first[iPoint] = noSeed;
+      for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++) {
+        const auto jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+        if (!seed[jPoint]) continue;
+        if (compatible(parent[jPoint], iPoint)) parent[iPoint] = parent[jPoint];
+        if (indirect[jPoint]) first[iPoint] = parent[jPoint];
+      }
+    }
+
+    /*--- Indirect agglomeration, the points (not adjacent to the seed) that are reached from two of its
+     first neighbors are its second neighbors, and the points (neither first nor second) that are reached
+     from two of its second neighbors are its third neighbors. When several seeds qualify, the one with
+     the highest priority is used. ---*/
+
+    if (Global_anyIndirect) {
+
+      auto reachedTwice = [&](unsigned long iPoint, const vector<SeedInfo>& origin,
+                              const vector<SeedInfo>& exclude, SeedInfo& result) {
+        result = noSeed;
+        const auto nNode = fine_grid->node[iPoint]->GetnPoint();
+        for (unsigned short iNode = 0; iNode < nNode; iNode++) {
+          const auto& candidate = origin[fine_grid->node[iPoint]->GetPoint(iNode)];
+          const auto globalSeed = candidate[SEED_GLOBAL];
+          if ((globalSeed == ULONG_MAX) || (globalSeed == first[iPoint][SEED_GLOBAL]) ||
+              (globalSeed == exclude[iPoint][SEED_GLOBAL])) continue;
+          if ((result[SEED_GLOBAL] != ULONG_MAX) && (candidate[SEED_PRIORITY] <= result[SEED_PRIORITY])) continue;
+
+          unsigned short nOrigin = 0;
+          for (unsigned short jNode = 0; jNode < nNode; jNode++)
+            nOrigin += (origin[fine_grid->node[iPoint]->GetPoint(jNode)][SEED_GLOBAL] == globalSeed);
+          if (nOrigin > 1) result = candidate;
+        }
+      };
+
+      exchangeSeeds(first);
+
+      SU2_OMP_PARALLEL_(for schedule(static,512))
+      for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+        if (!undecided[iPoint] || seed[iPoint]) continue;
+        reachedTwice(iPoint, first, first, second[iPoint]);
+      }
+
+      exchangeSeeds(second);
+
+      SU2_OMP_PARALLEL_(for schedule(static,512))
+      for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+        if (!undecided[iPoint] || seed[iPoint]) continue;
+        reachedTwice(iPoint, second, second, third[iPoint]);
+
+        if (parent[iPoint][SEED_GLOBAL] != ULONG_MAX) continue;
+        if ((second[iPoint][SEED_GLOBAL] != ULONG_MAX) && compatible(second[iPoint], iPoint))
+          parent[iPoint] = second[iPoint];
+        else if ((third[iPoint][SEED_GLOBAL] != ULONG_MAX) && compatible(third[iPoint], iPoint))
+          parent[iPoint] = third[iPoint];
+      }
+
+      for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+        first[iPoint] = noSeed;
+        second[iPoint] = noSeed;
+      }
+    }
+
+    exchangeSeeds(parent);
+  }
+
+  /*--- Size of the agglomerates, each point is counted by the rank of its seed, which replies with the total. ---*/
+
+  vector<vector<unsigned long> > sendBuf(size);
+  vector<int> nRecv, nReply;
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++)
+    sendBuf[parent[iPoint][SEED_RANK]].push_back(parent[iPoint][SEED_INDEX]);
+
+  auto recvBuf = ExchangeWithRanks(sendBuf, MPI_UNSIGNED_LONG, nRecv);
+
+  vector<unsigned long> nChildren(nPointFine, 0);
+  for (auto iSeed : recvBuf) nChildren[iSeed]++;
+
+  for (int iRank = 0, iPos = 0; iRank < size; iRank++) {
+    sendBuf[iRank].clear();
+    for (int iRecv = 0; iRecv < nRecv[iRank]; iRecv++, iPos++)
+      sendBuf[iRank].push_back(nChildren[recvBuf[iPos]]);
+  }
+
+  recvBuf = ExchangeWithRanks(sendBuf, MPI_UNSIGNED_LONG, nReply);
+
+  vector<int> replyPos(size, 0);
+  for (int iRank = 1; iRank < size; iRank++) replyPos[iRank] = replyPos[iRank-1] + nReply[iRank-1];
+
+  vector<unsigned long> agglomerateSize(nPointFine, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++)
+    agglomerateSize[iPoint] = recvBuf[replyPos[parent[iPoint][SEED_RANK]]++];
+
+  exchangeValues(agglomerateSize);
+
+  /*--- Merge the single point agglomerates (that are not fixed) with the smallest compatible neighbor
+   agglomerate, ties are broken with the global index of the seeds. ---*/
+
+  auto newParent = parent;
+
+  SU2_OMP_PARALLEL_(for schedule(static,512))
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+    if (fixed[iPoint] || (agglomerateSize[iPoint] != 1)) continue;
+
+    unsigned long bestSize = ULONG_MAX;
+    for (unsigned short iNode = 0; iNode < fine_grid->node[iPoint]->GetnPoint(); iNode++) {
+      const auto jPoint = fine_grid->node[iPoint]->GetPoint(iNode);
+      const auto jSize = agglomerateSize[jPoint];
+      if ((jSize < 2) || !compatible(parent[jPoint], iPoint)) continue;
+
+      if ((jSize < bestSize) || ((jSize == bestSize) &&
+          (MixGlobalIndex(parent[jPoint][SEED_GLOBAL]) > MixGlobalIndex(newParent[iPoint][SEED_GLOBAL])))) {
+        newParent[iPoint] = parent[jPoint];
+        bestSize = jSize;
+      }
+    }
+  }
+
+  parent.swap(newParent);
+  exchangeSeeds(parent);
+
+  Parent_GlobalIndex.resize(nPointFine);
+  Parent_Rank.resize(nPointFine);
+  for (unsigned long iPoint = 0; iPoint < nPointFine; iPoint++) {
+    Parent_GlobalIndex[iPoint] = parent[iPoint][SEED_GLOBAL];
+    Parent_Rank[iPoint] = parent[iPoint][SEED_RANK];
+  }
+
+  /*--- The coarse control volumes owned by this rank are the seeds it owns, in the order of the fine
+   points, their global index is the one of the seed so that the next levels also do not depend on the
+   numbering of the points. The parents on other ranks, and the neighbors of the owned control volumes,
+   are halo control volumes. ---*/
+
+  vector<unsigned long> coarseGlobalIndex, coarseIndex(nPointFine, ULONG_MAX);
+
+  auto localCV = [&](unsigned long globalIndex, int iRank) {
+    auto it = Global_to_Local_CV.find(globalIndex);
+    if (it != Global_to_Local_CV.end()) return it->second;
+    const auto iCoarsePoint = coarseGlobalIndex.size();
+    Global_to_Local_CV[globalIndex] = iCoarsePoint;
+    coarseGlobalIndex.push_back(globalIndex);
+    Owner_Rank.push_back(iRank);
+    return iCoarsePoint;
+  };
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++)
+    if (parent[iPoint][SEED_GLOBAL] == fine_grid->node[iPoint]->GetGlobalIndex())
+      coarseIndex[iPoint] = localCV(parent[iPoint][SEED_GLOBAL], rank);
+
+  nPointDomain = coarseGlobalIndex.size();
+
+  vector<unsigned long> fineParent(nPointDomainFine);
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+    if (parent[iPoint][SEED_RANK] == static_cast<unsigned long>(rank))
+      fineParent[iPoint] = coarseIndex[parent[iPoint][SEED_INDEX]];
+    else
+      fineParent[iPoint] = localCV(parent[iPoint][SEED_GLOBAL], parent[iPoint][SEED_RANK]);
+  }
+
+  /*--- The owned control volumes allow indirect agglomeration if any of their children does. ---*/
+
+  for (auto& buf : sendBuf) buf.clear();
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++)
+    if (indirect[iPoint]) sendBuf[parent[iPoint][SEED_RANK]].push_back(parent[iPoint][SEED_INDEX]);
+
+  recvBuf = ExchangeWithRanks(sendBuf, MPI_UNSIGNED_LONG, nRecv);
+
+  vector<char> coarseIndirect(nPointDomain, false);
+  for (auto iSeed : recvBuf) coarseIndirect[coarseIndex[iSeed]] = true;
+
+  /*--- Connectivity, from the fine edges between different agglomerates. ---*/
+
+  vector<unsigned long> edgeInfo;
+  RouteFineEdges(fine_grid, edgeInfo, nullptr);
+
+  vector<pair<unsigned long, unsigned long> > coarseEdges(edgeInfo.size()/6);
+  for (auto iEdge = 0ul; iEdge < coarseEdges.size(); iEdge++) {
+    const auto* info = &edgeInfo[6*iEdge];
+    coarseEdges[iEdge].first = localCV(info[0], info[1]);
+    coarseEdges[iEdge].second = localCV(info[2], info[3]);
+  }
+
+  /*--- Create the coarse grid structure. ---*/
+
+  nPoint = coarseGlobalIndex.size();
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+
+  for (unsigned long iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
+    node[iCoarsePoint] = new CPoint(nDim, coarseGlobalIndex[iCoarsePoint], config);
+    node[iCoarsePoint]->SetAgglomerate_Indirect((iCoarsePoint < nPointDomain) && coarseIndirect[iCoarsePoint]);
+    node[iCoarsePoint]->SetDomain(iCoarsePoint < nPointDomain);
+    node[iCoarsePoint]->SetnChildren_CV(0);
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomainFine; iPoint++) {
+    const auto iCoarsePoint = fineParent[iPoint];
+    const auto iChildren = node[iCoarsePoint]->GetnChildren_CV();
+    fine_grid->node[iPoint]->SetParent_CV(iCoarsePoint);
+    node[iCoarsePoint]->SetChildren_CV(iChildren, iPoint);
+    node[iCoarsePoint]->SetnChildren_CV(iChildren+1);
+  }
+
+  for (const auto& coarseEdge : coarseEdges) {
+    node[coarseEdge.first]->SetPoint(coarseEdge.second);
+    node[coarseEdge.second]->SetPoint(coarseEdge.first);
+  }
+
+}
+
+void CMultiGridGeometry::RouteFineEdges(CGeometry *fine_grid, vector<unsigned long>& edgeInfo,
+                                        vector<su2double>* edgeNormal) const {
+
+  vector<vector<unsigned long> > sendInfo(size);
+  vector<vector<su2double> > sendNormal(size);
+  su2double Normal[3] = {0.0};
+
+  for (unsigned long iEdge = 0; iEdge < fine_grid->GetnEdge(); iEdge++) {
+
+    /*--- Orient the edge from the point with the lowest global index. ---*/
+
+    auto iPoint = fine_grid->edge[iEdge]->GetNode(0);
+    auto jPoint = fine_grid->edge[iEdge]->GetNode(1);
+    su2double sign = 1.0;
+
+    if (fine_grid->node[jPoint]->GetGlobalIndex() < fine_grid->node[iPoint]->GetGlobalIndex()) {
+      swap(iPoint, jPoint);
+      sign = -1.0;
+    }
+
+    if (!fine_grid->node[iPoint]->GetDomain() ||
+        (Parent_GlobalIndex[iPoint] == Parent_GlobalIndex[jPoint])) continue;
+
+    const unsigned long info[] = {Parent_GlobalIndex[iPoint], static_cast<unsigned long>(Parent_Rank[iPoint]),
+                                  Parent_GlobalIndex[jPoint], static_cast<unsigned long>(Parent_Rank[jPoint]),
+                                  fine_grid->node[iPoint]->GetGlobalIndex(), fine_grid->node[jPoint]->GetGlobalIndex()};
+
+    if (edgeNormal != nullptr) {
+      fine_grid->edge[iEdge]->GetNormal(Normal);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) Normal[iDim] *= sign;
+    }
+
+    for (auto iRank : {Parent_Rank[iPoint], Parent_Rank[jPoint]}) {
+      sendInfo[iRank].insert(sendInfo[iRank].end(), info, info+6);
+      if (edgeNormal != nullptr)
+        sendNormal[iRank].insert(sendNormal[iRank].end(), Normal, Normal+nDim);
+      if (Parent_Rank[iPoint] == Parent_Rank[jPoint]) break;
+    }
+  }
+
+  vector<int> nRecv;
+  edgeInfo = ExchangeWithRanks(sendInfo, MPI_UNSIGNED_LONG, nRecv);
+  if (edgeNormal != nullptr) *edgeNormal = ExchangeWithRanks(sendNormal, MPI_DOUBLE, nRecv);
+
+}
+
 void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
 
   unsigned long iFinePoint, iFinePoint_Neighbor, iParent, iCoarsePoint;
   unsigned short iChildren, iNode;
 
-  /*--- Set the point surrounding a point ---*/
+  /*--- Set the point surrounding a point, with the parallel agglomeration this was done
+   with the (routed) fine edges when the coarse grid was created. ---*/
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+  for (iCoarsePoint = 0; !parallelAgglomeration && (iCoarsePoint < nPoint); iCoarsePoint ++) {
     for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
       iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
@@ -960,6 +1429,72 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
   nMarker = fine_grid->GetnMarker();
   unsigned short nMarker_Max = config->GetnMarker_Max();
 
+  vertex = new CVertex**[nMarker];
+  nVertex = new unsigned long [nMarker];
+
+  Tag_to_Marker = new string [nMarker_Max];
+  for (iMarker_Tag = 0; iMarker_Tag < nMarker_Max; iMarker_Tag++)
+    Tag_to_Marker[iMarker_Tag] = fine_grid->GetMarker_Tag(iMarker_Tag);
+
+  /*--- With the parallel agglomeration the children of a control volume may be on other ranks,
+   their markers are sent to the owner of the parent, which creates the vertices. The halo control
+   volumes have no vertices, and the SEND_RECEIVE markers are replaced by the P2P communications. ---*/
+
+  if (parallelAgglomeration) {
+
+    vector<vector<unsigned long> > sendBuf(size);
+    for (iFinePoint = 0; iFinePoint < fine_grid->GetnPointDomain(); iFinePoint++) {
+      for (iMarker = 0; iMarker < nMarker; iMarker++) {
+        const auto FineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
+        if ((FineVertex == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) continue;
+        const unsigned long info[] = {Parent_GlobalIndex[iFinePoint], iMarker,
+                                      static_cast<unsigned long>(fine_grid->vertex[iMarker][FineVertex]->GetRotation_Type())};
+        sendBuf[Parent_Rank[iFinePoint]].insert(sendBuf[Parent_Rank[iFinePoint]].end(), info, info+3);
+      }
+    }
+
+    vector<int> nRecv;
+    const auto recvBuf = ExchangeWithRanks(sendBuf, MPI_UNSIGNED_LONG, nRecv);
+
+    /*--- Vertices in the order of the coarse control volumes, as for the original agglomeration. ---*/
+
+    vector<vector<pair<unsigned short, unsigned short> > > pointMarkers(nPointDomain);
+    for (auto iPos = 0ul; iPos < recvBuf.size(); iPos += 3) {
+      iCoarsePoint = Global_to_Local_CV.at(recvBuf[iPos]);
+      pointMarkers[iCoarsePoint].emplace_back(recvBuf[iPos+1], recvBuf[iPos+2]);
+    }
+
+    for (iMarker = 0; iMarker < nMarker; iMarker++) nVertex[iMarker] = 0;
+
+    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint++) {
+      if (pointMarkers[iCoarsePoint].empty()) continue;
+      node[iCoarsePoint]->SetBoundary(nMarker);
+      for (const auto& pointMarker : pointMarkers[iCoarsePoint])
+        if (node[iCoarsePoint]->GetVertex(pointMarker.first) == -1) {
+          node[iCoarsePoint]->SetVertex(nVertex[pointMarker.first], pointMarker.first);
+          nVertex[pointMarker.first]++;
+        }
+    }
+
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      vertex[iMarker] = new CVertex* [nVertex[iMarker]+1];
+      nVertex[iMarker] = 0;
+    }
+
+    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint++) {
+      for (const auto& pointMarker : pointMarkers[iCoarsePoint]) {
+        iMarker = pointMarker.first;
+        iVertex = node[iCoarsePoint]->GetVertex(iMarker);
+        if (iVertex != nVertex[iMarker]) continue;
+        vertex[iMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
+        vertex[iMarker][iVertex]->SetRotation_Type(pointMarker.second);
+        nVertex[iMarker]++;
+      }
+    }
+
+    return;
+  }
+
   /*--- If any children node belong to the boundary then the entire control
    volume will belong to the boundary ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
@@ -971,13 +1506,6 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
       }
     }
 
-  vertex = new CVertex**[nMarker];
-  nVertex = new unsigned long [nMarker];
-
-  Tag_to_Marker = new string [nMarker_Max];
-  for (iMarker_Tag = 0; iMarker_Tag < nMarker_Max; iMarker_Tag++)
-    Tag_to_Marker[iMarker_Tag] = fine_grid->GetMarker_Tag(iMarker_Tag);
-
   /*--- Compute the number of vertices to do the dimensionalization ---*/
   for (iMarker = 0; iMarker < nMarker; iMarker++) nVertex[iMarker] = 0;
 
@@ -1117,13 +1645,52 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
     node[iCoarsePoint]->SetVolume(Coarse_Volume);
   }
 
+  /*--- With the parallel agglomeration the halos have the contribution of the local children,
+   the owners add them to their own and then send back the total. ---*/
+
+  if (parallelAgglomeration) {
+    ExchangeHaloValues<su2double>(1, true,
+      [this](unsigned long iPoint, unsigned short) { return node[iPoint]->GetVolume(); },
+      [this](unsigned long iPoint, unsigned short, su2double val) { node[iPoint]->AddVolume(val); });
+    ExchangeHaloValues<su2double>(1, false,
+      [this](unsigned long iPoint, unsigned short) { return node[iPoint]->GetVolume(); },
+      [this](unsigned long iPoint, unsigned short, su2double val) { node[iPoint]->SetVolume(val); });
+  }
+
   /*--- Update or not the values of faces at the edge ---*/
   if (action != ALLOCATE) {
     for (iEdge=0; iEdge < nEdge; iEdge++)
       edge[iEdge]->SetZeroValues();
   }
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
+  /*--- The fine edges between agglomerates are routed to the ranks of the two parents, and
+   added in the order of their global indices so that the result does not depend on the partitions. ---*/
+
+  if (parallelAgglomeration) {
+
+    vector<unsigned long> edgeInfo;
+    vector<su2double> edgeNormal;
+    RouteFineEdges(fine_grid, edgeInfo, &edgeNormal);
+
+    const auto nFineEdge = edgeInfo.size()/6;
+    vector<unsigned long> order(nFineEdge);
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&edgeInfo](unsigned long a, unsigned long b) {
+      return make_pair(edgeInfo[6*a+4], edgeInfo[6*a+5]) < make_pair(edgeInfo[6*b+4], edgeInfo[6*b+5]);
+    });
+
+    for (auto iFineEdge : order) {
+      const auto iPoint = Global_to_Local_CV.at(edgeInfo[6*iFineEdge]);
+      const auto jPoint = Global_to_Local_CV.at(edgeInfo[6*iFineEdge+2]);
+      CoarseEdge = FindEdge(iPoint, jPoint);
+
+      const su2double sign = (edge[CoarseEdge]->GetNode(0) == iPoint)? 1.0 : -1.0;
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = sign*edgeNormal[nDim*iFineEdge+iDim];
+      edge[CoarseEdge]->AddNormal(Normal);
+    }
+  }
+
+  for (iCoarsePoint = 0; !parallelAgglomeration && (iCoarsePoint < nPoint); iCoarsePoint ++)
     for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
       iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
 
@@ -1177,7 +1744,47 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
         vertex[iMarker][iVertex]->SetZeroValues();
   }
 
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
+  /*--- With the parallel agglomeration the normals of the fine vertices are sent to the owner of
+   the parent, which adds them in the order of the global indices of the fine points. ---*/
+
+  if (parallelAgglomeration) {
+
+    vector<vector<unsigned long> > sendInfo(size);
+    vector<vector<su2double> > sendNormal(size);
+
+    for (iFinePoint = 0; iFinePoint < fine_grid->GetnPointDomain(); iFinePoint++) {
+      for (iMarker = 0; iMarker < nMarker; iMarker++) {
+        const auto iFineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
+        if ((iFineVertex == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) continue;
+        const auto iRank = Parent_Rank[iFinePoint];
+        const unsigned long info[] = {Parent_GlobalIndex[iFinePoint], iMarker,
+                                      fine_grid->node[iFinePoint]->GetGlobalIndex()};
+        sendInfo[iRank].insert(sendInfo[iRank].end(), info, info+3);
+        fine_grid->vertex[iMarker][iFineVertex]->GetNormal(Normal);
+        sendNormal[iRank].insert(sendNormal[iRank].end(), Normal, Normal+nDim);
+      }
+    }
+
+    vector<int> nRecv;
+    const auto recvInfo = ExchangeWithRanks(sendInfo, MPI_UNSIGNED_LONG, nRecv);
+    const auto recvNormal = ExchangeWithRanks(sendNormal, MPI_DOUBLE, nRecv);
+
+    const auto nFineVertex = recvInfo.size()/3;
+    vector<unsigned long> order(nFineVertex);
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&recvInfo](unsigned long a, unsigned long b) {
+      return make_pair(recvInfo[3*a+2], recvInfo[3*a+1]) < make_pair(recvInfo[3*b+2], recvInfo[3*b+1]);
+    });
+
+    for (auto iFineVertex : order) {
+      iCoarsePoint = Global_to_Local_CV.at(recvInfo[3*iFineVertex]);
+      iMarker = recvInfo[3*iFineVertex+1];
+      iVertex = node[iCoarsePoint]->GetVertex(iMarker);
+      vertex[iMarker][iVertex]->AddNormal(&recvNormal[nDim*iFineVertex]);
+    }
+  }
+
+  for (iMarker = 0; !parallelAgglomeration && (iMarker < nMarker); iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
       iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
       for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
@@ -1224,6 +1831,17 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
       node[Point_Coarse]->SetCoord(iDim, Coordinates[iDim]);
   }
   delete[] Coordinates;
+
+  /*--- Add the contributions of the children on other ranks, see SetControlVolume. ---*/
+
+  if (parallelAgglomeration) {
+    ExchangeHaloValues<su2double>(nDim, true,
+      [this](unsigned long iPoint, unsigned short iDim) { return node[iPoint]->GetCoord(iDim); },
+      [this](unsigned long iPoint, unsigned short iDim, su2double val) { node[iPoint]->AddCoord(iDim, val); });
+    ExchangeHaloValues<su2double>(nDim, false,
+      [this](unsigned long iPoint, unsigned short iDim) { return node[iPoint]->GetCoord(iDim); },
+      [this](unsigned long iPoint, unsigned short iDim, su2double val) { node[iPoint]->SetCoord(iDim, val); });
+  }
 }
 
 void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned short val_marker){
@@ -1341,6 +1959,95 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       node[Point_Coarse]->SetGridVel(iDim, Grid_Vel[iDim]);
   }
+
+  /*--- Add the contributions of the children on other ranks, see SetControlVolume. ---*/
+
+  if (parallelAgglomeration) {
+    ExchangeHaloValues<su2double>(nDim, true,
+      [this](unsigned long iPoint, unsigned short iDim) { return node[iPoint]->GetGridVel()[iDim]; },
+      [this](unsigned long iPoint, unsigned short iDim, su2double val) {
+        node[iPoint]->SetGridVel(iDim, node[iPoint]->GetGridVel()[iDim] + val); });
+    ExchangeHaloValues<su2double>(nDim, false,
+      [this](unsigned long iPoint, unsigned short iDim) { return node[iPoint]->GetGridVel()[iDim]; },
+      [this](unsigned long iPoint, unsigned short iDim, su2double val) { node[iPoint]->SetGridVel(iDim, val); });
+  }
+}
+
+void CMultiGridGeometry::PreprocessP2PComms(CGeometry *geometry, CConfig *config) {
+
+  if (!parallelAgglomeration) {
+    CGeometry::PreprocessP2PComms(geometry, config);
+    return;
+  }
+
+  /*--- The halo control volumes are received from the ranks that own them, in the order of the
+   local indices, the owners receive the requested global indices and send them in the same order. ---*/
+
+  vector<vector<unsigned long> > haloPoints(size), sendBuf(size);
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    haloPoints[Owner_Rank[iPoint]].push_back(iPoint);
+    sendBuf[Owner_Rank[iPoint]].push_back(node[iPoint]->GetGlobalIndex());
+  }
+
+  vector<int> nRecv;
+  const auto recvBuf = ExchangeWithRanks(sendBuf, MPI_UNSIGNED_LONG, nRecv);
+
+  /*--- The routines of the comms assume the same neighbors for sends and recvs (as the halo layers of the
+   partitions are symmetric), a rank that only sends to, or only receives from, another has an empty message. ---*/
+
+  vector<char> isNeighbor(size, false);
+  for (int iRank = 0; iRank < size; iRank++)
+    isNeighbor[iRank] = (nRecv[iRank] > 0) || !haloPoints[iRank].empty();
+
+  nP2PSend = count(isNeighbor.begin(), isNeighbor.end(), true);
+  nP2PRecv = nP2PSend;
+
+  nPoint_P2PSend = new int[nP2PSend+1]; nPoint_P2PSend[0] = 0;
+  nPoint_P2PRecv = new int[nP2PRecv+1]; nPoint_P2PRecv[0] = 0;
+
+  Neighbors_P2PSend = new int[nP2PSend];
+  Neighbors_P2PRecv = new int[nP2PRecv];
+
+  Local_Point_P2PSend = new unsigned long[recvBuf.size()];
+  Local_Point_P2PRecv = new unsigned long[nPoint-nPointDomain];
+
+  P2PSend2Neighbor.clear();
+  P2PRecv2Neighbor.clear();
+
+  int iSend = 0, iRecv = 0;
+  unsigned long iPos = 0, jPos = 0;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+
+    if (!isNeighbor[iRank]) continue;
+
+    Neighbors_P2PSend[iSend] = iRank;
+    P2PSend2Neighbor[iRank] = iSend;
+    for (int iPoint = 0; iPoint < nRecv[iRank]; iPoint++, iPos++)
+      Local_Point_P2PSend[iPos] = Global_to_Local_CV.at(recvBuf[iPos]);
+    nPoint_P2PSend[++iSend] = iPos;
+
+    Neighbors_P2PRecv[iRecv] = iRank;
+    P2PRecv2Neighbor[iRank] = iRecv;
+    for (auto iPoint : haloPoints[iRank]) Local_Point_P2PRecv[jPos++] = iPoint;
+    nPoint_P2PRecv[++iRecv] = jPos;
+  }
+
+  /*--- The buffers are allocated in the first communication, see CGeometry::PreprocessP2PComms. ---*/
+
+  bufD_P2PSend = NULL;
+  bufD_P2PRecv = NULL;
+
+  bufS_P2PSend = NULL;
+  bufS_P2PRecv = NULL;
+
+  if (nP2PSend > 0) {
+    req_P2PSend   = new SU2_MPI::Request[nP2PSend];
+  }
+  if (nP2PRecv > 0) {
+    req_P2PRecv   = new SU2_MPI::Request[nP2PRecv];
+  }
+
 }
 
 
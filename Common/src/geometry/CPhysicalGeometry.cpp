@@ -30,6 +30,7 @@
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
@@ -47,6 +48,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <iterator>
+#include <numeric>
+#include <array>
+#include <limits>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -102,7 +106,8 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {
 
 }
 
-CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone) : CGeometry() {
+CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone,
+                                     CMeshReaderFVM *val_mesh) : CGeometry() {
 
   size = SU2_MPI::GetSize();
   rank = SU2_MPI::GetRank();
@@ -191,10 +196,13 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
         break;
     }
   }
+  else if (val_mesh != nullptr) {
+    Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone, val_mesh);
+  }
   else {
 
     switch (val_format) {
-      case SU2: case CGNS_GRID: case RECTANGLE: case BOX:
+      case SU2: case SU2_BINARY: case CGNS_GRID: case RECTANGLE: case BOX:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -207,9 +215,10 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
 
   assert((nDim == 2) || (nDim == 3));
 
-  /*--- Loop over the points element to re-scale the mesh, and plot it (only SU2_CFD) ---*/
+  /*--- Loop over the points element to re-scale the mesh, and plot it (only SU2_CFD),
+   a grid loaded from a reader other than the file was already re-scaled. ---*/
 
-  if (config->GetKind_SU2() == SU2_CFD) {
+  if ((config->GetKind_SU2() == SU2_CFD) && (val_mesh == nullptr)) {
 
     NewCoord = new su2double [nDim];
 
@@ -3943,7 +3952,8 @@ void CPhysicalGeometry::SetBoundaries(CConfig *config) {
 void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
                                       string         val_mesh_filename,
                                       unsigned short val_iZone,
-                                      unsigned short val_nZone) {
+                                      unsigned short val_nZone,
+                                      CMeshReaderFVM *val_mesh) {
 
   /*--- Initialize counters for local/global points & elements ---*/
 
@@ -3965,11 +3975,14 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
 
   unsigned short val_format = config->GetMesh_FileFormat();
 
-  CMeshReaderFVM *MeshFVM = NULL;
-  switch (val_format) {
+  CMeshReaderFVM *MeshFVM = val_mesh;
+  if (MeshFVM == NULL) switch (val_format) {
     case SU2:
       MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
       break;
@@ -4029,9 +4042,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
   PrepareAdjacency(config);
 
   /*--- Now that we have loaded all information from the mesh,
-   delete the mesh reader object. ---*/
+   delete the mesh reader object (unless it was given). ---*/
 
-  if (MeshFVM != NULL) delete MeshFVM;
+  if ((MeshFVM != NULL) && (MeshFVM != val_mesh)) delete MeshFVM;
 
 }
 
@@ -5078,132 +5091,525 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
 }
 
-void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
+namespace {
 
-  /*--------------------------------------------------------------------------*/
-  /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
-  /*---         subelements of the local boundaries that must be taken     ---*/
-  /*---         into account in the wall distance computation.             ---*/
-  /*--------------------------------------------------------------------------*/
+/*!
+ * \brief Wall elements and the coordinates of their nodes (one copy per element), the format in
+ *        which the wall elements are exchanged between ranks to compute the wall distance.
+ */
+struct CWallElements {
+  enum : unsigned short {RANK, MARKER, ELEM, VTK_TYPE, NNODE, NINFO};
 
-  /* Initialize an array for the mesh points, which eventually contains the
-     mapping from the local nodes to the number used in the connectivity of the
-     local boundary faces. However, in a first pass it is an indicator whether
-     or not a mesh point is on a local wall boundary. */
-  vector<unsigned long> meshToSurface(nPoint, 0);
+  vector<unsigned long> info;  /*!< \brief NINFO values per element. */
+  vector<su2double> coord;     /*!< \brief Coordinates of the nodes of the elements. */
 
-  /* Define the vectors for the connectivity of the local linear subelements,
-     the element ID's, the element type and marker ID's. */
-  vector<unsigned long> surfaceConn;
-  vector<unsigned long> elemIDs;
-  vector<unsigned short> VTK_TypeElem;
-  vector<unsigned short> markerIDs;
+  unsigned long size() const { return info.size()/NINFO; }
 
-  /* Loop over the boundary markers. */
+  /*!
+   * \brief Append a boundary element of a geometry.
+   */
+  void Append(const CGeometry* geometry, int rank, unsigned short iMarker, unsigned long iElem) {
+    const auto elem = geometry->bound[iMarker][iElem];
+    const unsigned long elemInfo[] = {static_cast<unsigned long>(rank), iMarker, iElem,
+                                      elem->GetVTK_Type(), elem->GetnNodes()};
+    info.insert(info.end(), elemInfo, elemInfo+NINFO);
 
-  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+      const su2double* x = geometry->node[elem->GetNode(iNode)]->GetCoord();
+      coord.insert(coord.end(), x, x+geometry->GetnDim());
+    }
+  }
 
+  /*!
+   * \brief Build a local ADT of the elements, the element ID of each element is its position in the list.
+   */
+  CADTElemClass* NewADT(unsigned short nDim) const {
+    vector<su2double> coordADT(coord);
+    vector<unsigned long> conn(coord.size()/nDim), elemID(size());
+    vector<unsigned short> vtkType(size()), marker(size());
 
-    /* Check for a viscous wall. */
-    if( config->GetViscous_Wall(iMarker)) {
+    iota(conn.begin(), conn.end(), 0ul);
+    iota(elemID.begin(), elemID.end(), 0ul);
+    for (unsigned long iElem = 0; iElem < size(); iElem++) {
+      vtkType[iElem] = info[iElem*NINFO+VTK_TYPE];
+      marker[iElem] = info[iElem*NINFO+MARKER];
+    }
+    return new CADTElemClass(nDim, coordADT, conn, vtkType, marker, elemID, false);
+  }
+};
 
-      /* Loop over the surface elements of this marker. */
-      for(unsigned long iElem=0; iElem < nElem_Bound[iMarker]; iElem++) {
+/*!
+ * \brief Displacements of the data of each rank in a buffer, given the counts.
+ */
+vector<int> Displacements(const vector<int>& counts) {
+  vector<int> displ(counts.size(), 0);
+  for (size_t i = 1; i < counts.size(); i++) displ[i] = displ[i-1] + counts[i-1];
+  return displ;
+}
 
-        /* Set the flag of the mesh points on this surface to true. */
-        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-          unsigned long iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          meshToSurface[iPoint] = 1;
-        }
-        /* Determine the necessary data from the corresponding standard face,
-          such as the number of linear subfaces, the number of DOFs per
-          linear subface and the corresponding local connectivity. */
-        const unsigned short VTK_Type      = bound[iMarker][iElem]->GetVTK_Type();
-        const unsigned short nDOFsPerElem  = bound[iMarker][iElem]->GetnNodes();
+/*!
+ * \brief Viscous wall elements of a geometry, optionally only those with some node that moved.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] moved - Whether each point moved (empty to get all the elements).
+ */
+CWallElements LocalWallElements(const CGeometry* geometry, CConfig* config, const vector<bool>& moved) {
+
+  CWallElements local;
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+      bool append = moved.empty();
+      for (unsigned short iNode = 0; !append && iNode < geometry->bound[iMarker][iElem]->GetnNodes(); iNode++)
+        append = moved[geometry->bound[iMarker][iElem]->GetNode(iNode)];
+
+      if (append) local.Append(geometry, SU2_MPI::GetRank(), iMarker, iElem);
+    }
+  }
+  return local;
+}
+
+/*!
+ * \brief Gather the wall elements of all ranks on all ranks (collective).
+ */
+CWallElements GatherWallElements(const CWallElements& local) {
+
+#ifndef HAVE_MPI
+  return local;
+#else
+  if (SU2_MPI::GetSize() == SINGLE_NODE) return local;
+
+  const int size = SU2_MPI::GetSize();
+  int nInfo = local.info.size(), nCoord = local.coord.size();
+  vector<int> nInfoRank(size), nCoordRank(size);
+
+  SU2_MPI::Allgather(&nInfo, 1, MPI_INT, nInfoRank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&nCoord, 1, MPI_INT, nCoordRank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  auto infoDispl = Displacements(nInfoRank), coordDispl = Displacements(nCoordRank);
 
-          /* Loop over the nodes of element and store the required data. */
+  CWallElements all;
+  all.info.resize(infoDispl.back() + nInfoRank.back());
+  all.coord.resize(coordDispl.back() + nCoordRank.back());
 
-        markerIDs.push_back(iMarker);
-        VTK_TypeElem.push_back(VTK_Type);
-        elemIDs.push_back(iElem);
+  SU2_MPI::Allgatherv(const_cast<unsigned long*>(local.info.data()), nInfo, MPI_UNSIGNED_LONG, all.info.data(),
+                      nInfoRank.data(), infoDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgatherv(const_cast<su2double*>(local.coord.data()), nCoord, MPI_DOUBLE, all.coord.data(),
+                      nCoordRank.data(), coordDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+  return all;
+#endif
+}
+
+/*!
+ * \brief Send to each rank the wall elements that may be the nearest to some of its points (collective).
+ * \note The distance from any point in the bounding box of the points of a rank to the walls is at most the
+ *       distance from a wall node to the farthest corner of the box, the minimum over the wall nodes of this
+ *       distance is the search radius of the rank. The rank only needs the elements whose bounding box is
+ *       within that radius of its box. The selection is not differentiated, i.e. it uses passive data.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] local - Wall elements of this rank.
+ * \param[in] points - Points of this rank for which the wall distance is needed.
+ * \return The wall elements received by this rank.
+ */
+CWallElements ExchangeWallElements(const CGeometry* geometry, const CWallElements& local,
+                                   const vector<unsigned long>& points) {
+
+  if (SU2_MPI::GetSize() == SINGLE_NODE) return local;
+
+  const int size = SU2_MPI::GetSize();
+  const unsigned short nDim = geometry->GetnDim();
+  const auto big = numeric_limits<passivedouble>::max();
+
+  /*--- Bounding box of the points of each rank, empty boxes (no points) have min > max. ---*/
+
+  vector<passivedouble> box(2*nDim), allBoxes(2*nDim*size);
+  fill(box.begin(), box.begin()+nDim, big);
+  fill(box.begin()+nDim, box.end(), -big);
 
-        for (unsigned short iNode = 0; iNode < nDOFsPerElem; iNode++)
-          surfaceConn.push_back(bound[iMarker][iElem]->GetNode(iNode));
+  for (auto iPoint : points) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const passivedouble x = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+      box[iDim] = min(box[iDim], x);
+      box[nDim+iDim] = max(box[nDim+iDim], x);
+    }
+  }
+  CBaseMPIWrapper::Allgather(box.data(), 2*nDim, MPI_DOUBLE, allBoxes.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  /*--- Search radius (squared) of each rank. ---*/
+
+  vector<passivedouble> localRadius2(size, big), radius2(size);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    const passivedouble* rankBox = &allBoxes[2*nDim*iRank];
+    if (rankBox[0] > rankBox[nDim]) continue;
+
+    for (unsigned long iNode = 0; iNode < local.coord.size()/nDim; iNode++) {
+      passivedouble dist2 = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble x = SU2_TYPE::GetValue(local.coord[iNode*nDim+iDim]);
+        const passivedouble ds = max(fabs(x-rankBox[iDim]), fabs(x-rankBox[nDim+iDim]));
+        dist2 += ds*ds;
       }
+      localRadius2[iRank] = min(localRadius2[iRank], dist2);
     }
   }
+  CBaseMPIWrapper::Allreduce(localRadius2.data(), radius2.data(), size, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 
+  /*--- Pack the elements within the search radius of each rank (with a margin for round-off). ---*/
 
-  /*--- Create the coordinates of the local points on the viscous surfaces and
-        create the final version of the mapping from all volume points to the
-        points on the viscous surfaces. ---*/
-  vector<su2double> surfaceCoor;
-  unsigned long nVertex_SolidWall = 0;
+  const auto nElem = local.size();
+  vector<unsigned long> coordStart(nElem+1, 0);
+  for (unsigned long iElem = 0; iElem < nElem; iElem++)
+    coordStart[iElem+1] = coordStart[iElem] + nDim*local.info[iElem*CWallElements::NINFO+CWallElements::NNODE];
 
-  for(unsigned long i=0; i<nPoint; ++i) {
-    if( meshToSurface[i] ) {
-      meshToSurface[i] = nVertex_SolidWall++;
+  vector<vector<unsigned long> > sendElems(size);
+  vector<passivedouble> elemBox(2*nDim);
 
-      for(unsigned short k=0; k<nDim; ++k)
-        surfaceCoor.push_back(node[i]->GetCoord(k));
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    fill(elemBox.begin(), elemBox.begin()+nDim, big);
+    fill(elemBox.begin()+nDim, elemBox.end(), -big);
+
+    for (auto i = coordStart[iElem]; i < coordStart[iElem+1]; i++) {
+      const unsigned short iDim = i % nDim;
+      const passivedouble x = SU2_TYPE::GetValue(local.coord[i]);
+      elemBox[iDim] = min(elemBox[iDim], x);
+      elemBox[nDim+iDim] = max(elemBox[nDim+iDim], x);
+    }
+
+    for (int iRank = 0; iRank < size; iRank++) {
+      const passivedouble* rankBox = &allBoxes[2*nDim*iRank];
+      if (rankBox[0] > rankBox[nDim]) continue;
+
+      passivedouble dist2 = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble ds = max(0.0, max(elemBox[iDim]-rankBox[nDim+iDim], rankBox[iDim]-elemBox[nDim+iDim]));
+        dist2 += ds*ds;
+      }
+      if (dist2 <= 1.01*radius2[iRank]) sendElems[iRank].push_back(iElem);
     }
   }
 
-  /*--- Change the surface connectivity, such that it corresponds to
-        the entries in surfaceCoor rather than in meshPoints. ---*/
-  for(unsigned long i=0; i<surfaceConn.size(); ++i)
-    surfaceConn[i] = meshToSurface[surfaceConn[i]];
+  CWallElements send;
+  vector<int> nInfoSend(size), nCoordSend(size), nInfoRecv(size), nCoordRecv(size);
 
-  /*--------------------------------------------------------------------------*/
-  /*--- Step 2: Build the ADT, which is an ADT of bounding boxes of the    ---*/
-  /*---         surface elements. A nearest point search does not give     ---*/
-  /*---         accurate results, especially not for the integration       ---*/
-  /*---         points of the elements close to a wall boundary.           ---*/
-  /*--------------------------------------------------------------------------*/
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (auto iElem : sendElems[iRank]) {
+      send.info.insert(send.info.end(), local.info.begin() + iElem*CWallElements::NINFO,
+                       local.info.begin() + (iElem+1)*CWallElements::NINFO);
+      send.coord.insert(send.coord.end(), local.coord.begin() + coordStart[iElem],
+                        local.coord.begin() + coordStart[iElem+1]);
+    }
+    nInfoSend[iRank] = send.info.size();
+    nCoordSend[iRank] = send.coord.size();
+  }
+  for (int iRank = size-1; iRank > 0; iRank--) {
+    nInfoSend[iRank] -= nInfoSend[iRank-1];
+    nCoordSend[iRank] -= nCoordSend[iRank-1];
+  }
+
+  /*--- Exchange the elements. ---*/
 
-  /* Build the ADT. */
-  CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+  SU2_MPI::Alltoall(nInfoSend.data(), 1, MPI_INT, nInfoRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  SU2_MPI::Alltoall(nCoordSend.data(), 1, MPI_INT, nCoordRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
 
-  /* Release the memory of the vectors used to build the ADT. To make sure
-     that all the memory is deleted, the swap function is used. */
-  vector<unsigned short>().swap(markerIDs);
-  vector<unsigned short>().swap(VTK_TypeElem);
-  vector<unsigned long>().swap(elemIDs);
-  vector<unsigned long>().swap(surfaceConn);
-  vector<su2double>().swap(surfaceCoor);
+  auto infoSendDispl = Displacements(nInfoSend), coordSendDispl = Displacements(nCoordSend);
+  auto infoRecvDispl = Displacements(nInfoRecv), coordRecvDispl = Displacements(nCoordRecv);
+
+  CWallElements recv;
+  recv.info.resize(infoRecvDispl.back() + nInfoRecv.back());
+  recv.coord.resize(coordRecvDispl.back() + nCoordRecv.back());
+
+  SU2_MPI::Alltoallv(send.info.data(), nInfoSend.data(), infoSendDispl.data(), MPI_UNSIGNED_LONG,
+                     recv.info.data(), nInfoRecv.data(), infoRecvDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Alltoallv(send.coord.data(), nCoordSend.data(), coordSendDispl.data(), MPI_DOUBLE,
+                     recv.coord.data(), nCoordRecv.data(), coordRecvDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+  return recv;
+}
+
+}
+
+void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
+
+  /*--- With WALL_DISTANCE_INCREMENTAL, once the distance has been computed it is only
+   recomputed for the points that moved, or whose nearest wall element moved. ---*/
+
+  const bool incremental = config->GetWallDistance_Incremental();
+  const bool update = incremental && (WallDist_Coord.size() == nPoint*nDim);
+
+  if (update) {
+    const auto points = UpdateWall_Distance(config);
+
+    unsigned long nPointLocal = points.size(), nPointGlobal = 0;
+    SU2_MPI::Allreduce(&nPointLocal, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    if (nPointGlobal > 0) ComputeWall_Distance(config, points);
+  }
+  else {
+    vector<unsigned long> points(nPoint);
+    iota(points.begin(), points.end(), 0ul);
+
+    if (incremental) {
+      WallDist_Value.assign(nPoint, 0.0);
+      WallDist_Rank.assign(nPoint, -1);
+      WallDist_Marker.assign(nPoint, 0);
+      WallDist_Elem.assign(nPoint, 0);
+    }
+    ComputeWall_Distance(config, points);
+  }
+
+  /*--- Store the coordinates for the next update, and set the distance of all points from
+   the stored values (in case the distance of the nodes was modified elsewhere). ---*/
+
+  if (incremental) {
+    WallDist_Coord.resize(nPoint*nDim);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        WallDist_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+      node[iPoint]->SetWall_Distance(WallDist_Value[iPoint]);
+    }
+  }
+
+}
+
+void CPhysicalGeometry::ComputeWall_Distance(CConfig *config, const vector<unsigned long>& points) {
+
+  const bool distributed = config->GetWallDistance_Distributed();
+  const bool incremental = config->GetWallDistance_Incremental();
+
+  CADTElemClass* WallADT = nullptr;
+
+  /*--- With WALL_DISTANCE_DISTRIBUTED, each rank only receives the wall elements that can
+   be the nearest to its points, and builds a local ADT of them. ---*/
+
+  CWallElements received;
+
+  if (distributed) {
+    received = ExchangeWallElements(this, LocalWallElements(this, config, {}), points);
+    WallADT = received.NewADT(nDim);
+  }
+  else {
+
+    /*--------------------------------------------------------------------------*/
+    /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
+    /*---         subelements of the local boundaries that must be taken     ---*/
+    /*---         into account in the wall distance computation.             ---*/
+    /*--------------------------------------------------------------------------*/
+
+    /* Initialize an array for the mesh points, which eventually contains the
+       mapping from the local nodes to the number used in the connectivity of the
+       local boundary faces. However, in a first pass it is an indicator whether
+       or not a mesh point is on a local wall boundary. */
+    vector<unsigned long> meshToSurface(nPoint, 0);
+
+    /* Define the vectors for the connectivity of the local linear subelements,
+       the element ID's, the element type and marker ID's. */
+    vector<unsigned long> surfaceConn;
+    vector<unsigned long> elemIDs;
+    vector<unsigned short> VTK_TypeElem;
+    vector<unsigned short> markerIDs;
+
+    /* Loop over the boundary markers. */
+
+    for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
+
+
+      /* Check for a viscous wall. */
+      if( config->GetViscous_Wall(iMarker)) {
+
+        /* Loop over the surface elements of this marker. */
+        for(unsigned long iElem=0; iElem < nElem_Bound[iMarker]; iElem++) {
+
+          /* Set the flag of the mesh points on this surface to true. */
+          for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            unsigned long iPoint = bound[iMarker][iElem]->GetNode(iNode);
+            meshToSurface[iPoint] = 1;
+          }
+          /* Determine the necessary data from the corresponding standard face,
+            such as the number of linear subfaces, the number of DOFs per
+            linear subface and the corresponding local connectivity. */
+          const unsigned short VTK_Type      = bound[iMarker][iElem]->GetVTK_Type();
+          const unsigned short nDOFsPerElem  = bound[iMarker][iElem]->GetnNodes();
+
+            /* Loop over the nodes of element and store the required data. */
+
+          markerIDs.push_back(iMarker);
+          VTK_TypeElem.push_back(VTK_Type);
+          elemIDs.push_back(iElem);
+
+          for (unsigned short iNode = 0; iNode < nDOFsPerElem; iNode++)
+            surfaceConn.push_back(bound[iMarker][iElem]->GetNode(iNode));
+        }
+      }
+    }
+
+
+    /*--- Create the coordinates of the local points on the viscous surfaces and
+          create the final version of the mapping from all volume points to the
+          points on the viscous surfaces. ---*/
+    vector<su2double> surfaceCoor;
+    unsigned long nVertex_SolidWall = 0;
+
+    for(unsigned long i=0; i<nPoint; ++i) {
+      if( meshToSurface[i] ) {
+        meshToSurface[i] = nVertex_SolidWall++;
+
+        for(unsigned short k=0; k<nDim; ++k)
+          surfaceCoor.push_back(node[i]->GetCoord(k));
+      }
+    }
+
+    /*--- Change the surface connectivity, such that it corresponds to
+          the entries in surfaceCoor rather than in meshPoints. ---*/
+    for(unsigned long i=0; i<surfaceConn.size(); ++i)
+      surfaceConn[i] = meshToSurface[surfaceConn[i]];
+
+    /*--------------------------------------------------------------------------*/
+    /*--- Step 2: Build the ADT, which is an ADT of bounding boxes of the    ---*/
+    /*---         surface elements. A nearest point search does not give     ---*/
+    /*---         accurate results, especially not for the integration       ---*/
+    /*---         points of the elements close to a wall boundary.           ---*/
+    /*--------------------------------------------------------------------------*/
+
+    /* Build the ADT. */
+    WallADT = new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                                markerIDs, elemIDs, true);
+
+    /* Release the memory of the vectors used to build the ADT. To make sure
+       that all the memory is deleted, the swap function is used. */
+    vector<unsigned short>().swap(markerIDs);
+    vector<unsigned short>().swap(VTK_TypeElem);
+    vector<unsigned long>().swap(elemIDs);
+    vector<unsigned long>().swap(surfaceConn);
+    vector<su2double>().swap(surfaceCoor);
+  }
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 3: Loop over all interior mesh nodes and compute minimum      ---*/
-  /*---         distance to a solid wall element                           ---*/
+  /*--- Step 3: Loop over the interior mesh nodes and compute minimum      ---*/
+  /*---         distance to a solid wall element.                          ---*/
   /*--------------------------------------------------------------------------*/
 
-
-  if ( WallADT.IsEmpty() ) {
+  if ( WallADT->IsEmpty() ) {
 
     /*--- No solid wall boundary nodes in the entire mesh.
      Set the wall distance to zero for all nodes. ---*/
 
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+    for (auto iPoint : points) {
       node[iPoint]->SetWall_Distance(0.0);
+      if (incremental) {
+        WallDist_Value[iPoint] = 0.0;
+        WallDist_Rank[iPoint] = -1;
+      }
+    }
   }
   else {
 
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+    /*--- Solid wall boundary nodes are present. Compute the wall distance
+     for all nodes, the searches of the ADT are thread safe. ---*/
 
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
+    SU2_OMP_PARALLEL
+    {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long i = 0; i < points.size(); ++i) {
+      const auto iPoint = points[i];
       unsigned short markerID;
       unsigned long  elemID;
       int            rankID;
       su2double      dist;
 
-      WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
-                                   elemID, rankID);
+      WallADT->DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
+                                       elemID, rankID);
       node[iPoint]->SetWall_Distance(dist);
+
+      /*--- Keep the nearest element for the incremental updates, identified
+       by its rank, and marker and element on that rank. ---*/
+
+      if (incremental) {
+        if (distributed) {
+          rankID = received.info[elemID*CWallElements::NINFO + CWallElements::RANK];
+          elemID = received.info[elemID*CWallElements::NINFO + CWallElements::ELEM];
+        }
+        WallDist_Value[iPoint] = dist;
+        WallDist_Rank[iPoint] = rankID;
+        WallDist_Marker[iPoint] = markerID;
+        WallDist_Elem[iPoint] = elemID;
+      }
+    }
+    }
+  }
+
+  delete WallADT;
+
+}
+
+vector<unsigned long> CPhysicalGeometry::UpdateWall_Distance(CConfig *config) {
+
+  /*--- Points that moved since the last computation of the wall distance. ---*/
+
+  vector<bool> moved(nPoint, false);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      if (node[iPoint]->GetCoord(iDim) != WallDist_Coord[iPoint*nDim+iDim]) moved[iPoint] = true;
+
+  /*--- Wall elements with some node that moved, from all ranks, sorted by
+   their identity (rank, marker, element) to search them. ---*/
+
+  const auto movedElems = GatherWallElements(LocalWallElements(this, config, moved));
+  const auto nMoved = movedElems.size();
+
+  vector<array<unsigned long,3> > movedIDs(nMoved);
+  for (unsigned long iElem = 0; iElem < nMoved; iElem++) {
+    const auto info = &movedElems.info[iElem*CWallElements::NINFO];
+    movedIDs[iElem] = {{info[CWallElements::RANK], info[CWallElements::MARKER], info[CWallElements::ELEM]}};
+  }
+  sort(movedIDs.begin(), movedIDs.end());
+
+  /*--- The points that moved, or whose nearest element moved, need a full search. ---*/
+
+  vector<unsigned long> fullSearch, others;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const array<unsigned long,3> nearest = {{static_cast<unsigned long>(WallDist_Rank[iPoint]),
+                                             WallDist_Marker[iPoint], WallDist_Elem[iPoint]}};
+    if (moved[iPoint] || binary_search(movedIDs.begin(), movedIDs.end(), nearest))
+      fullSearch.push_back(iPoint);
+    else
+      others.push_back(iPoint);
+  }
+
+  /*--- The distance to the elements that did not move is the same for the other points, and
+   no such element was nearer than the previous nearest. Their distance only changes if an
+   element that moved is now nearer, which is determined with an ADT of those elements. ---*/
+
+  if (nMoved > 0) {
+    CADTElemClass* MovedADT = movedElems.NewADT(nDim);
+
+    SU2_OMP_PARALLEL
+    {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long i = 0; i < others.size(); ++i) {
+      const auto iPoint = others[i];
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+      su2double      dist;
+
+      MovedADT->DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
+                                        elemID, rankID);
+
+      if (dist < WallDist_Value[iPoint]) {
+        WallDist_Value[iPoint] = dist;
+        WallDist_Rank[iPoint] = movedElems.info[elemID*CWallElements::NINFO + CWallElements::RANK];
+        WallDist_Marker[iPoint] = markerID;
+        WallDist_Elem[iPoint] = movedElems.info[elemID*CWallElements::NINFO + CWallElements::ELEM];
+      }
     }
+    }
+    delete MovedADT;
   }
 
+  return fullSearch;
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -5435,9 +5841,9 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
   vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
 
   inQueue = new bool [nPoint];
@@ -5525,6 +5931,115 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  SetPoint_Renumbering(config, Result);
+
+}
+
+namespace {
+
+/*--- Position along a space-filling curve of a cell of a regular grid, given by its integer
+ coordinates (nBits per dimension, the coordinates are modified). The Hilbert curve uses the
+ transform of J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004),
+ the Morton curve only interleaves the bits of the coordinates. ---*/
+
+unsigned long SpaceFillingCurveIndex(unsigned long* X, unsigned short nDim, unsigned short nBits, bool hilbert) {
+
+  if (hilbert) {
+    const unsigned long M = 1ul << (nBits-1);
+
+    /*--- Inverse undo. ---*/
+
+    for (unsigned long Q = M; Q > 1; Q >>= 1) {
+      const unsigned long P = Q-1;
+      for (unsigned short i = 0; i < nDim; i++) {
+        if (X[i] & Q) {
+          X[0] ^= P;
+        }
+        else {
+          const unsigned long t = (X[0] ^ X[i]) & P;
+          X[0] ^= t;
+          X[i] ^= t;
+        }
+      }
+    }
+
+    /*--- Gray encode. ---*/
+
+    for (unsigned short i = 1; i < nDim; i++) X[i] ^= X[i-1];
+
+    unsigned long t = 0;
+    for (unsigned long Q = M; Q > 1; Q >>= 1)
+      if (X[nDim-1] & Q) t ^= Q-1;
+
+    for (unsigned short i = 0; i < nDim; i++) X[i] ^= t;
+  }
+
+  /*--- Interleave the bits, from the most significant. ---*/
+
+  unsigned long index = 0;
+  for (int iBit = nBits-1; iBit >= 0; iBit--)
+    for (unsigned short i = 0; i < nDim; i++)
+      index = (index << 1) | ((X[i] >> iBit) & 1ul);
+
+  return index;
+}
+
+}
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig *config) {
+
+  const bool hilbert = (config->GetKind_PointOrdering() == HILBERT_ORDERING);
+  const unsigned short nBits = 63 / nDim;
+  const passivedouble nCell = static_cast<passivedouble>((1ul << nBits) - 1);
+
+  /*--- Bounding box of the domain points, the same scale is used in all directions
+   to keep the curve isotropic. ---*/
+
+  passivedouble minCoord[3] = {0.0, 0.0, 0.0}, extent = 0.0;
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    passivedouble minVal = numeric_limits<passivedouble>::max(), maxVal = -minVal;
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const passivedouble coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+      minVal = min(minVal, coord);
+      maxVal = max(maxVal, coord);
+    }
+    minCoord[iDim] = minVal;
+    extent = max(extent, maxVal-minVal);
+  }
+  const passivedouble scale = (extent > 0.0)? nCell/extent : 0.0;
+
+  /*--- Position of the domain points along the curve, the points are sorted by it, and
+   ties keep the previous order. ---*/
+
+  vector<pair<unsigned long, unsigned long> > curve(nPointDomain);
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    unsigned long cell[3] = {0, 0, 0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const passivedouble coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+      cell[iDim] = static_cast<unsigned long>(min(nCell, (coord-minCoord[iDim])*scale));
+    }
+    curve[iPoint] = make_pair(SpaceFillingCurveIndex(cell, nDim, nBits, hilbert), iPoint);
+  }
+  sort(curve.begin(), curve.end());
+
+  /*--- The halo points stay at the end. ---*/
+
+  vector<unsigned long> Result(nPoint);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result[iPoint] = curve[iPoint].second;
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result[iPoint] = iPoint;
+
+  SetPoint_Renumbering(config, Result);
+
+}
+
+void CPhysicalGeometry::SetPoint_Renumbering(CConfig *config, const vector<unsigned long>& Result) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+
   /*--- Reset old data structures ---*/
 
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -9067,6 +9582,15 @@ void CPhysicalGeometry::SetBoundTecPlot(char mesh_filename[MAX_STRING_SIZE], boo
 
 void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
+  SetColorGrid_Parallel(config, vector<int>(), vector<passivedouble>());
+
+}
+
+void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config, const vector<int>& previousColor,
+                                              const vector<passivedouble>& rankTime) {
+
+  const bool adaptive = !previousColor.empty();
+
   /*--- Initialize the color vector ---*/
 
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
@@ -9095,41 +9619,180 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     idx_t *vtxdist = new idx_t[size+1];
     idx_t *part    = new idx_t[nPoint];
 
-    real_t ubvec;
-    real_t *tpwgts = new real_t[size];
-
     /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
     wgtflag = 0;
     numflag = 0;
     ncon    = 1;
-    ubvec   = 1.05;
     nparts  = (idx_t)size;
     idx_t options[METIS_NOPTIONS];
     METIS_SetDefaultOptions(options);
     options[1] = 0;
 
-    /*--- Fill the necessary ParMETIS data arrays. We do not apply
-     any weighting during the partitioning process. ---*/
-
-    for (int i = 0; i < size; i++) {
-      tpwgts[i] = 1.0/((real_t)size);
-    }
-
     vtxdist[0] = 0;
     for (int i = 0; i < size; i++) {
       vtxdist[i+1] = (idx_t)pointPartitioner.GetLastIndexOnRank(i);
     }
 
+    /*--- The work of each point is estimated from its number of neighbors (edges) and
+     markers, see PARMETIS_*_WEIGHT. Optionally, the number of boundary points is a second
+     constraint. Without weights ParMETIS balances the number of points. ---*/
+
+    const idx_t pointWeight = config->GetParMETIS_PointWeight();
+    const idx_t edgeWeight = config->GetParMETIS_EdgeWeight();
+    const idx_t boundaryWeight = config->GetParMETIS_BoundaryWeight();
+    const bool boundaryConstraint = config->GetParMETIS_BoundaryConstraint();
+    const bool weighted = (edgeWeight > 0) || (boundaryWeight > 0) || boundaryConstraint;
+
+    /*--- Number of markers of each point. Only the master has the surface elements at this
+     stage, it sends the points of each marker to the ranks that own them (linear partition). ---*/
+
+    vector<unsigned short> nMarkerOfPoint(nPoint, 0);
+
+    if ((boundaryWeight > 0) || boundaryConstraint) {
+
+      vector<vector<unsigned long> > markerPoints(size);
+
+      if (rank == MASTER_NODE) {
+        for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+          vector<unsigned long> points;
+          for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+            for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+              points.push_back(bound[iMarker][iElem]->GetNode(iNode));
+
+          sort(points.begin(), points.end());
+          points.resize(unique(points.begin(), points.end()) - points.begin());
+
+          for (auto iPoint_Global : points)
+            markerPoints[pointPartitioner.GetRankContainingIndex(iPoint_Global)].push_back(iPoint_Global);
+        }
+      }
+
+      vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+      for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = markerPoints[iRank].size();
+
+      SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+
+      vector<unsigned long> sendBuf;
+      for (int iRank = 0; iRank < size; iRank++) {
+        sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+        recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+        sendBuf.insert(sendBuf.end(), markerPoints[iRank].begin(), markerPoints[iRank].end());
+      }
+      vector<unsigned long> recvBuf(recvDispl[size]);
+
+      SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                         recvBuf.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, comm);
+
+      const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+      for (auto iPoint_Global : recvBuf) nMarkerOfPoint[iPoint_Global-firstIndex]++;
+
+      /*--- The second constraint requires boundary points. ---*/
+
+      unsigned long nBoundPoint = recvBuf.size(), Global_nBoundPoint = 0;
+      SU2_MPI::Allreduce(&nBoundPoint, &Global_nBoundPoint, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+      if (boundaryConstraint && (Global_nBoundPoint > 0)) ncon = 2;
+    }
+
+    vector<idx_t> vwgt;
+
+    if (weighted || adaptive) {
+      wgtflag = 2;
+      vwgt.resize(nPoint*ncon);
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        vwgt[iPoint*ncon] = weighted? pointWeight + edgeWeight*(xadj[iPoint+1]-xadj[iPoint]) +
+                                      boundaryWeight*nMarkerOfPoint[iPoint] : 1;
+        if (ncon == 2) vwgt[iPoint*ncon+1] = nMarkerOfPoint[iPoint];
+      }
+    }
+
+    /*--- For the adaptive repartitioning, the estimated work of each point is scaled by the measured
+     time over the estimated work of its previous rank (normalized by the totals, and by 100 to keep
+     some resolution in the integer weights). ---*/
+
+    if (adaptive) {
+      vector<unsigned long> rankWork(size, 0), Global_rankWork(size, 0);
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+        rankWork[previousColor[iPoint]] += vwgt[iPoint*ncon];
+
+      SU2_MPI::Allreduce(rankWork.data(), Global_rankWork.data(), size, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
+      passivedouble totalWork = 0.0, totalTime = 0.0;
+      for (int iRank = 0; iRank < size; iRank++) {
+        totalWork += Global_rankWork[iRank];
+        totalTime += rankTime[iRank];
+      }
+
+      vector<passivedouble> scale(size, 100.0);
+      for (int iRank = 0; iRank < size; iRank++)
+        if ((totalTime > 0.0) && (Global_rankWork[iRank] > 0))
+          scale[iRank] = 100.0 * (rankTime[iRank] / totalTime) / (Global_rankWork[iRank] / totalWork);
+
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        const auto work = vwgt[iPoint*ncon] * scale[previousColor[iPoint]];
+        vwgt[iPoint*ncon] = max<idx_t>(1, idx_t(work+0.5));
+        part[iPoint] = previousColor[iPoint];
+      }
+    }
+
+    /*--- The target weights of all parts are equal. ---*/
+
+    vector<real_t> tpwgts(ncon*nparts, 1.0/((real_t)size));
+    vector<real_t> ubvec(ncon, 1.0 + SU2_TYPE::GetValue(config->GetParMETIS_Tolerance()));
+
     /*--- Calling ParMETIS ---*/
 
-    if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-    ParMETIS_V3_PartKway(vtxdist, xadj, adjacency, NULL, NULL, &wgtflag,
-                         &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
-                         &edgecut, part, &comm);
+    if (!adaptive) {
+      if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
+      ParMETIS_V3_PartKway(vtxdist, xadj, adjacency, weighted? vwgt.data() : NULL, NULL, &wgtflag,
+                           &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), options,
+                           &edgecut, part, &comm);
+    }
+    else {
+
+      /*--- The initial partition is given by "part" (uncoupled sub-domains and processors). The ratio
+       of the communication to the redistribution time is taken as the number of iterations until the
+       next check of the load balance, the migration is only worth it if it pays off by then. ---*/
+
+      options[0] = 1;
+      options[1] = 0;
+      options[2] = 0;
+      options[3] = PARMETIS_PSR_UNCOUPLED;
+      real_t itr = max<real_t>(1.0, config->GetLoadImbalance_Freq());
+
+      if (rank == MASTER_NODE) cout << "Calling ParMETIS (adaptive repartitioning)...";
+      ParMETIS_V3_AdaptiveRepart(vtxdist, xadj, adjacency, vwgt.data(), NULL, NULL, &wgtflag,
+                                 &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), &itr,
+                                 options, &edgecut, part, &comm);
+    }
+
+    /*--- Estimated imbalance, i.e. the maximum work of a part relative to the average. ---*/
+
+    vector<unsigned long> partWork(size, 0), Global_partWork(size, 0);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      partWork[part[iPoint]] += (weighted || adaptive)? vwgt[iPoint*ncon] : 1;
+
+    SU2_MPI::Allreduce(partWork.data(), Global_partWork.data(), size, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
+    /*--- Number of points that change rank. ---*/
+
+    unsigned long nMigrate = 0, Global_nMigrate = 0;
+    if (adaptive) {
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+        nMigrate += (part[iPoint] != previousColor[iPoint]);
+    }
+    SU2_MPI::Allreduce(&nMigrate, &Global_nMigrate, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
     if (rank == MASTER_NODE) {
+      const su2double maxWork = *max_element(Global_partWork.begin(), Global_partWork.end());
+      su2double avgWork = 0.0;
+      for (auto work : Global_partWork) avgWork += su2double(work) / size;
+
       cout << " graph partitioning complete (";
-      cout << edgecut << " edge cuts)." << endl;
+      cout << edgecut << " edge cuts, estimated load imbalance ";
+      cout << SU2_TYPE::Int(100.0*(maxWork/avgWork-1.0)+0.5) << "%";
+      if (adaptive) cout << ", " << Global_nMigrate << " points change rank";
+      cout << ")." << endl;
     }
 
     /*--- Store the results of the partitioning (note that this is local
@@ -9144,7 +9807,6 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
     if (vtxdist != NULL) delete [] vtxdist;
     if (part    != NULL) delete [] part;
-    if (tpwgts  != NULL) delete [] tpwgts;
 
   }
 
@@ -35,6 +35,7 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
   Coord_CG = NULL;
   Normal   = NULL;
   Nodes    = NULL;
+  ExternalStorage = false;
 
   /*--- Allocate center of gravity coordinates, nodes, and face normal ---*/
   Coord_CG = new su2double [nDim];
@@ -55,9 +56,32 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 CEdge::~CEdge() {
 
   if (Coord_CG != NULL) delete[] Coord_CG;
-  if (Normal   != NULL) delete[] Normal;
-  if (Nodes    != NULL) delete[] Nodes;
+  if (!ExternalStorage) {
+    if (Normal != NULL) delete[] Normal;
+    if (Nodes  != NULL) delete[] Nodes;
+  }
+
+}
+
+void CEdge::SetExternalStorage(unsigned long *val_nodes, su2double *val_normal) {
+
+  /*--- Copy the current values to the new location before releasing the own storage. ---*/
+
+  val_nodes[0] = Nodes[0];
+  val_nodes[1] = Nodes[1];
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    val_normal[iDim] = Normal[iDim];
+
+  if (!ExternalStorage) {
+    delete [] Nodes;
+    delete [] Normal;
+  }
+
+  Nodes  = val_nodes;
+  Normal = val_normal;
 
+  ExternalStorage = true;
 }
 
 void CEdge::SetCoord_CG(su2double **val_coord) {
@@ -41,15 +41,18 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   Coord_n           = NULL;           Coord_n1            = NULL;            Coord_p1   = NULL;
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
+  ExternalStorage   = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
   if (config->GetTime_Marching() == NO) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else {
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -156,15 +159,18 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   Coord_n           = NULL;           Coord_n1            = NULL;            Coord_p1   = NULL;
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
+  ExternalStorage   = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
   if (config->GetTime_Marching() == NO) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else{
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -272,14 +278,17 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   Coord_n           = NULL;           Coord_n1            = NULL;            Coord_p1   = NULL;
   GridVel           = NULL;           GridVel_Grad        = NULL;
   AD_InputIndex     = NULL;           AD_OutputIndex      = NULL;
+  ExternalStorage   = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
   if ( config->GetTime_Marching() == NO ) {
-    Volume = new su2double[1];
+    nVolume = 1;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
   }
   else{
-    Volume = new su2double[3];
+    nVolume = 3;
+    Volume = new su2double[nVolume];
     Volume[0] = 0.0;
     Volume[1] = 0.0;
     Volume[2] = 0.0;
@@ -378,14 +387,16 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 CPoint::~CPoint() {
 
   if (Vertex       != NULL && Boundary) delete[] Vertex;
-  if (Volume       != NULL) delete[] Volume;
-  if (Coord        != NULL) delete[] Coord;
+  if (!ExternalStorage) {
+    if (Volume     != NULL) delete[] Volume;
+    if (Coord      != NULL) delete[] Coord;
+    if (GridVel    != NULL) delete[] GridVel;
+  }
   if (Coord_Old    != NULL) delete[] Coord_Old;
   if (Coord_Sum    != NULL) delete[] Coord_Sum;
   if (Coord_n      != NULL) delete[] Coord_n;
   if (Coord_n1     != NULL) delete[] Coord_n1;
   if (Coord_p1     != NULL) delete[] Coord_p1;
-  if (GridVel      != NULL) delete[] GridVel;
   if (GridVel_Grad != NULL) {
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       delete [] GridVel_Grad[iDim];
@@ -395,6 +406,34 @@ CPoint::~CPoint() {
   if (AD_OutputIndex != NULL) delete[] AD_OutputIndex;
  }
 
+void CPoint::SetExternalStorage(su2double *val_coord, su2double *val_volume, su2double *val_gridvel) {
+
+  /*--- Copy the current values to the new location before releasing the own storage. ---*/
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    val_coord[iDim] = Coord[iDim];
+
+  for (unsigned short iVol = 0; iVol < nVolume; iVol++)
+    val_volume[iVol] = Volume[iVol];
+
+  if (GridVel != NULL) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      val_gridvel[iDim] = GridVel[iDim];
+  }
+
+  if (!ExternalStorage) {
+    delete [] Coord;
+    delete [] Volume;
+    if (GridVel != NULL) delete [] GridVel;
+  }
+
+  Coord  = val_coord;
+  Volume = val_volume;
+  if (GridVel != NULL) GridVel = val_gridvel;
+
+  ExternalStorage = true;
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 
   unsigned short iPoint;
@@ -417,6 +456,12 @@ void CPoint::SetPoint(unsigned long val_point) {
 
 }
 
+void CPoint::SortPoint(void) {
+
+  sort(Point.begin(), Point.end());
+
+}
+
 void CPoint::SetBoundary(unsigned short val_nmarker) {
 
   unsigned short imarker;
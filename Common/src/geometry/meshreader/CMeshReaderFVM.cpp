@@ -26,6 +26,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CMeshReaderFVM.hpp"
 
 CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
@@ -56,3 +57,89 @@ CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
 }
 
 CMeshReaderFVM::~CMeshReaderFVM(void) { }
+
+unsigned short CMeshReaderFVM::GetNodesPerElement(unsigned long vtkType) {
+  switch (vtkType) {
+    case LINE:          return N_POINTS_LINE;
+    case TRIANGLE:      return N_POINTS_TRIANGLE;
+    case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+    case TETRAHEDRON:   return N_POINTS_TETRAHEDRON;
+    case HEXAHEDRON:    return N_POINTS_HEXAHEDRON;
+    case PRISM:         return N_POINTS_PRISM;
+    case PYRAMID:       return N_POINTS_PYRAMID;
+    default:            return 0;
+  }
+}
+
+void CMeshReaderFVM::DistributeVolumeElements(vector<unsigned long>& connectivity) {
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  const unsigned long nElemRead = connectivity.size()/SU2_CONN_SIZE;
+
+  /*--- Count the elements to send to each rank, the flag avoids sending
+   an element more than once to the same rank. ---*/
+
+  vector<int> nElem_Send(size+1, 0), nElem_Recv(size+1, 0), nElem_Flag(size, -1);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const unsigned long* elem = &connectivity[iElem*SU2_CONN_SIZE];
+    const auto nNodes = GetNodesPerElement(elem[1]);
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const int iProcessor = pointPartitioner.GetRankContainingIndex(elem[SU2_CONN_SKIP+iNode]);
+      if (nElem_Flag[iProcessor] != int(iElem)) {
+        nElem_Flag[iProcessor] = iElem;
+        nElem_Send[iProcessor+1]++;
+      }
+    }
+  }
+
+  SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
+                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    nElem_Send[iProcessor+1] += nElem_Send[iProcessor];
+    nElem_Recv[iProcessor+1] += nElem_Recv[iProcessor];
+    nElem_Flag[iProcessor] = -1;
+  }
+
+  /*--- Load the send buffer, the ranks are in order of the global element
+   index and so the received elements are also ordered. ---*/
+
+  vector<unsigned long> connSend(nElem_Send[size]*SU2_CONN_SIZE);
+  vector<unsigned long> index(size);
+  for (int iProcessor = 0; iProcessor < size; iProcessor++)
+    index[iProcessor] = nElem_Send[iProcessor]*SU2_CONN_SIZE;
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const unsigned long* elem = &connectivity[iElem*SU2_CONN_SIZE];
+    const auto nNodes = GetNodesPerElement(elem[1]);
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const int iProcessor = pointPartitioner.GetRankContainingIndex(elem[SU2_CONN_SKIP+iNode]);
+      if (nElem_Flag[iProcessor] != int(iElem)) {
+        nElem_Flag[iProcessor] = iElem;
+        for (int jNode = 0; jNode < SU2_CONN_SIZE; jNode++)
+          connSend[index[iProcessor]++] = elem[jNode];
+      }
+    }
+  }
+  vector<unsigned long>().swap(connectivity);
+
+  /*--- Exchange the elements, counts and displacements in number of entries. ---*/
+
+  vector<int> sendCounts(size), sendDispl(size), recvCounts(size), recvDispl(size);
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    sendCounts[iProcessor] = (nElem_Send[iProcessor+1]-nElem_Send[iProcessor])*SU2_CONN_SIZE;
+    sendDispl[iProcessor]  = nElem_Send[iProcessor]*SU2_CONN_SIZE;
+    recvCounts[iProcessor] = (nElem_Recv[iProcessor+1]-nElem_Recv[iProcessor])*SU2_CONN_SIZE;
+    recvDispl[iProcessor]  = nElem_Recv[iProcessor]*SU2_CONN_SIZE;
+  }
+
+  numberOfLocalElements = nElem_Recv[size];
+  localVolumeElementConnectivity.resize(numberOfLocalElements*SU2_CONN_SIZE);
+
+  SU2_MPI::Alltoallv(connSend.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCounts.data(), recvDispl.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+}
@@ -0,0 +1,204 @@
+/*!
+ * \file CPartitionedMeshReaderFVM.cpp
+ * \brief Puts a partitioned grid back into linear partitions for the
+ *        finite volume solver (FVM), to repartition it at runtime.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CPartitionedMeshReaderFVM.hpp"
+#include "../../../include/geometry/CPhysicalGeometry.hpp"
+
+namespace {
+
+/*!
+ * \brief Exchange a buffer per destination rank (one Alltoall of the counts and one Alltoallv).
+ * \note Only for passive data (the base wrapper is used).
+ * \param[in,out] sendBuf - Data for each rank, released on exit.
+ * \param[in] type - MPI type of the data.
+ * \param[out] recvDispl - Start of the data received from each rank (size+1 entries).
+ * \return Data received from all ranks, in order of rank.
+ */
+template<class T>
+vector<T> ExchangeBuffers(vector<vector<T> >& sendBuf, CBaseMPIWrapper::Datatype type, vector<int>& recvDispl) {
+
+  const int size = sendBuf.size();
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1, 0);
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  CBaseMPIWrapper::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  recvDispl.assign(size+1, 0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<T> send(sendDispl[size]), recv(recvDispl[size]);
+  for (int iRank = 0; iRank < size; iRank++) {
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), send.begin()+sendDispl[iRank]);
+    vector<T>().swap(sendBuf[iRank]);
+  }
+
+  CBaseMPIWrapper::Alltoallv(send.data(), nSend.data(), sendDispl.data(), type,
+                             recv.data(), nRecv.data(), recvDispl.data(), type, MPI_COMM_WORLD);
+  return recv;
+}
+
+}
+
+CPartitionedMeshReaderFVM::CPartitionedMeshReaderFVM(CConfig                 *val_config,
+                                                     unsigned short          val_iZone,
+                                                     unsigned short          val_nZone,
+                                                     const CPhysicalGeometry *geometry)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  dimension = geometry->GetnDim();
+  numberOfGlobalPoints = geometry->GetGlobal_nPointDomain();
+  numberOfGlobalElements = geometry->GetGlobal_nElemDomain();
+
+  SendPointCoordinates(geometry);
+  SendVolumeElementConnectivity(geometry);
+  GatherSurfaceElementConnectivity(geometry);
+
+}
+
+CPartitionedMeshReaderFVM::~CPartitionedMeshReaderFVM(void) { }
+
+void CPartitionedMeshReaderFVM::SendPointCoordinates(const CPhysicalGeometry *geometry) {
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  /*--- Global index and coordinates of the points of this rank, by destination. ---*/
+
+  vector<vector<unsigned long> > indexSend(size);
+  vector<vector<passivedouble> > coordSend(size);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const unsigned long iPoint_Global = geometry->node[iPoint]->GetGlobalIndex();
+    const int iRank = pointPartitioner.GetRankContainingIndex(iPoint_Global);
+    indexSend[iRank].push_back(iPoint_Global);
+    for (unsigned short iDim = 0; iDim < dimension; iDim++)
+      coordSend[iRank].push_back(SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim)));
+  }
+
+  vector<int> indexDispl, coordDispl;
+  const auto index = ExchangeBuffers(indexSend, MPI_UNSIGNED_LONG, indexDispl);
+  const auto coord = ExchangeBuffers(coordSend, MPI_DOUBLE, coordDispl);
+
+  /*--- Store by global index, and record where each point came from. ---*/
+
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  if (index.size() != numberOfLocalPoints)
+    SU2_MPI::Error("The partitioned grid does not contain each point exactly once.", CURRENT_FUNCTION);
+
+  localPointCoordinates.resize(dimension);
+  for (auto& coordDim : localPointCoordinates) coordDim.resize(numberOfLocalPoints);
+  previousOwner.resize(numberOfLocalPoints);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (int i = indexDispl[iRank]; i < indexDispl[iRank+1]; i++) {
+      const unsigned long iPoint = index[i] - firstIndex;
+      previousOwner[iPoint] = iRank;
+      for (unsigned short iDim = 0; iDim < dimension; iDim++)
+        localPointCoordinates[iDim][iPoint] = coord[i*dimension+iDim];
+    }
+  }
+
+}
+
+void CPartitionedMeshReaderFVM::SendVolumeElementConnectivity(const CPhysicalGeometry *geometry) {
+
+  /*--- Each element is sent by the owner of its first node, in the format of the readers. ---*/
+
+  vector<unsigned long> connectivity;
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    const auto elem = geometry->elem[iElem];
+    if (!geometry->node[elem->GetNode(0)]->GetDomain()) continue;
+
+    connectivity.push_back(elem->GetGlobalIndex());
+    connectivity.push_back(elem->GetVTK_Type());
+    for (unsigned short iNode = 0; iNode < SU2_CONN_SIZE-SU2_CONN_SKIP; iNode++) {
+      connectivity.push_back((iNode < elem->GetnNodes())? geometry->node[elem->GetNode(iNode)]->GetGlobalIndex() : 0);
+    }
+  }
+
+  DistributeVolumeElements(connectivity);
+
+}
+
+void CPartitionedMeshReaderFVM::GatherSurfaceElementConnectivity(const CPhysicalGeometry *geometry) {
+
+  /*--- All markers of the grid, in the original order. ---*/
+
+  markerNames = geometry->GetGlobal_Marker_Tags();
+  numberOfMarkers = markerNames.size();
+
+  /*--- Elements of the physical markers whose first node is owned by this rank,
+   [global marker index, VTK type, nodes], sent to the master. ---*/
+
+  vector<vector<unsigned long> > connSend(size);
+
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+
+    const auto tag = find(markerNames.begin(), markerNames.end(), config->GetMarker_All_TagBound(iMarker));
+    if (tag == markerNames.end())
+      SU2_MPI::Error("Unknown marker " + config->GetMarker_All_TagBound(iMarker), CURRENT_FUNCTION);
+    const unsigned long iMarker_Global = tag - markerNames.begin();
+
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+      const auto elem = geometry->bound[iMarker][iElem];
+      if (!geometry->node[elem->GetNode(0)]->GetDomain()) continue;
+
+      connSend[MASTER_NODE].push_back(iMarker_Global);
+      connSend[MASTER_NODE].push_back(elem->GetVTK_Type());
+      for (unsigned short iNode = 0; iNode < SU2_CONN_SIZE-SU2_CONN_SKIP; iNode++) {
+        connSend[MASTER_NODE].push_back((iNode < elem->GetnNodes())?
+                                        geometry->node[elem->GetNode(iNode)]->GetGlobalIndex() : 0);
+      }
+    }
+  }
+
+  vector<int> recvDispl;
+  const auto connRecv = ExchangeBuffers(connSend, MPI_UNSIGNED_LONG, recvDispl);
+
+  /*--- The master sorts the elements by marker, the first entry of a record is not used by the readers. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+
+  for (unsigned long iElem = 0; iElem < connRecv.size()/SU2_CONN_SIZE; iElem++) {
+    const unsigned long* record = &connRecv[iElem*SU2_CONN_SIZE];
+    auto& markerConn = surfaceElementConnectivity[record[0]];
+    markerConn.push_back(0);
+    markerConn.insert(markerConn.end(), record+1, record+SU2_CONN_SIZE);
+  }
+
+}
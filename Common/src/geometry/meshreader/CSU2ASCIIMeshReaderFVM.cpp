@@ -28,6 +28,33 @@
 
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../../include/omp_structure.hpp"
+
+namespace {
+
+/*--- Maximum chunk size used in the parallel parsing loops. ---*/
+const size_t OMP_MAX_SIZE = 4096;
+
+/*--- Allocation-free parsing of the numbers in a (null-terminated) line,
+ the pointer is advanced past the number, false is returned on failure. ---*/
+
+inline bool ParseUnsigned(const char*& ptr, unsigned long& value) {
+  while ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r')) ++ptr;
+  if ((*ptr < '0') || (*ptr > '9')) return false;
+  value = 0;
+  while ((*ptr >= '0') && (*ptr <= '9')) value = 10*value + (*ptr++ - '0');
+  return true;
+}
+
+inline bool ParseDouble(const char*& ptr, passivedouble& value) {
+  char* end = nullptr;
+  value = strtod(ptr, &end);
+  if (end == ptr) return false;
+  ptr = end;
+  return true;
+}
+
+}
 
 CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig        *val_config,
                                                unsigned short val_iZone,
@@ -42,6 +69,7 @@ CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig        *val_config,
   if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
   ActDiskNewPoints = 0;
   Xloc = 0.0; Yloc = 0.0; Zloc = 0.0;
+  markerOffset = 0;
   
   /* Store the current zone to be read and the total number of zones. */
   myZone = val_iZone;
@@ -75,173 +103,314 @@ void CSU2ASCIIMeshReaderFVM::ReadMetadata() {
   bool harmonic_balance = config->GetTime_Marching() == HARMONIC_BALANCE;
   bool multizone_file = config->GetMultizone_Mesh();
   
-  /*--- Open grid file ---*/
+  /*--- The master reads the metadata: problem dimension, offsets for angle
+   of attack and angle of sideslip, global points, global elements, and
+   number of markers. In the same pass it records the byte offsets of the
+   sections of the file, such that the other ranks never need to scan it.
+   Perform error checks as we go. ---*/
   
-  mesh_file.open(meshFilename.c_str(), ios::in);
-  if (mesh_file.fail()) {
-    SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
-                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
-  }
+  /* Dimension, points, elements, markers, offset of the markers, found AoA and AoS offsets. */
+  unsigned long metadata[7] = {0,0,0,0,0,0,0};
+  passivedouble angleOffsets[2] = {0.0,0.0};
   
-  /*--- If more than one, find the curent zone in the mesh file. ---*/
+  pointOffsets.assign(size+1, 0);
+  elemOffsets.assign(size+1, 0);
   
-  string text_line;
-  string::size_type position;
-  if ((nZones > 1 && multizone_file) || harmonic_balance) {
-    if (harmonic_balance) {
-      if (rank == MASTER_NODE)
+  if (rank == MASTER_NODE) {
+    
+    /*--- Open grid file ---*/
+    
+    mesh_file.open(meshFilename.c_str(), ios::in | ios::binary);
+    if (mesh_file.fail()) {
+      SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                     string(" \n Check that the file exists."), CURRENT_FUNCTION);
+    }
+    
+    /*--- If more than one, find the curent zone in the mesh file. ---*/
+    
+    string text_line;
+    string::size_type position;
+    if ((nZones > 1 && multizone_file) || harmonic_balance) {
+      if (harmonic_balance) {
         cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
-    } else {
-      bool foundZone = false;
-      while (getline (mesh_file,text_line)) {
-        /*--- Search for the current domain ---*/
-        position = text_line.find ("IZONE=",0);
-        if (position != string::npos) {
-          text_line.erase (0,6);
-          unsigned short jZone = atoi(text_line.c_str());
-          if (jZone == myZone+1) {
-            if (rank == MASTER_NODE)
+      } else {
+        bool foundZone = false;
+        while (getline (mesh_file,text_line)) {
+          /*--- Search for the current domain ---*/
+          position = text_line.find ("IZONE=",0);
+          if (position != string::npos) {
+            text_line.erase (0,6);
+            unsigned short jZone = atoi(text_line.c_str());
+            if (jZone == myZone+1) {
               cout << "Reading zone " << myZone << " from native SU2 ASCII mesh." << endl;
-            foundZone = true;
-            break;
+              foundZone = true;
+              break;
+            }
           }
         }
+        if (!foundZone) {
+          SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
+                         string(" \n Check the SU2 ASCII file format."),
+                         CURRENT_FUNCTION);
+        }
       }
-      if (!foundZone) {
-        SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
-                       string(" \n Check the SU2 ASCII file format."),
-                       CURRENT_FUNCTION);
-      }
-    }
-  }
-  
-  /*--- Read the metadata: problem dimension, offsets for angle
-   of attack and angle of sideslip, global points, global elements,
-   and number of markers. Perform error checks as we go. ---*/
-  
-  bool foundNDIME = false, foundNPOIN = false;
-  bool foundNELEM = false, foundNMARK = false;
-  
-  while (getline (mesh_file, text_line)) {
-    
-    /*--- Read the dimension of the problem ---*/
-    
-    position = text_line.find ("NDIME=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      dimension = atoi(text_line.c_str());
-      foundNDIME = true;
     }
     
-    /*--- The AoA and AoS offset values are optional. ---*/
+    bool foundNDIME = false, foundNPOIN = false;
+    bool foundNELEM = false, foundNMARK = false;
     
-    position = text_line.find ("AOA_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoA_Offset = 0.0;
-      text_line.erase (0,11);
-      AoA_Offset = atof(text_line.c_str());
+    while (true) {
       
-      /*--- The offset is in deg ---*/
+      const unsigned long lineOffset = mesh_file.tellg();
+      if (!getline (mesh_file, text_line)) break;
       
-      su2double AoA_Current = config->GetAoA() + AoA_Offset;
+      /*--- Read the dimension of the problem ---*/
       
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
-          cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
-        }
-        config->SetAoA_Offset(AoA_Offset);
-        config->SetAoA(AoA_Current);
+      position = text_line.find ("NDIME=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        dimension = atoi(text_line.c_str());
+        foundNDIME = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+      
+      /*--- The AoA and AoS offset values are optional. ---*/
+      
+      position = text_line.find ("AOA_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        angleOffsets[0] = atof(text_line.c_str());
+        metadata[5] = true;
       }
       
-    }
-    
-    position = text_line.find ("AOS_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoS_Offset = 0.0;
-      text_line.erase (0,11);
-      AoS_Offset = atof(text_line.c_str());
+      position = text_line.find ("AOS_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        angleOffsets[1] = atof(text_line.c_str());
+        metadata[6] = true;
+      }
       
-      /*--- The offset is in deg ---*/
+      /*--- Only the byte offsets of the linear partitions of the points
+       and elements are stored, the lines are counted but not parsed. ---*/
       
-      su2double AoS_Current = config->GetAoS() + AoS_Offset;
+      position = text_line.find ("NPOIN=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfGlobalPoints = strtoul(text_line.c_str(), nullptr, 10);
+        IndexSection(numberOfGlobalPoints, pointOffsets);
+        foundNPOIN = true;
+      }
       
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
-          cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
-        }
-        config->SetAoS_Offset(AoS_Offset);
-        config->SetAoS(AoS_Current);
+      position = text_line.find ("NELEM=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfGlobalElements = strtoul(text_line.c_str(), nullptr, 10);
+        IndexSection(numberOfGlobalElements, elemOffsets);
+        foundNELEM = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+      
+      position = text_line.find ("NMARK=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        numberOfMarkers = atoi(text_line.c_str());
+        markerOffset = lineOffset;
+        foundNMARK = true;
       }
       
+      /* Stop before we reach the next zone then check for errors below. */
+      position = text_line.find ("IZONE=",0);
+      if (position != string::npos) {
+        break;
+      }
     }
     
-    position = text_line.find ("NPOIN=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalPoints = atoi(text_line.c_str());
-      for (unsigned long iPoint = 0; iPoint < numberOfGlobalPoints; iPoint++)
-        getline (mesh_file, text_line);
-      foundNPOIN = true;
-    }
+    /* Close the mesh file. */
+    mesh_file.close();
     
-    position = text_line.find ("NELEM=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalElements = atoi(text_line.c_str());
-      for (unsigned long iElem = 0; iElem < numberOfGlobalElements; iElem++)
-        getline (mesh_file, text_line);
-      foundNELEM = true;
+    /* Throw an error if any of the keywords was not found. */
+    if (!foundNDIME) {
+      SU2_MPI::Error(string("Could not find NDIME= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!foundNPOIN) {
+      SU2_MPI::Error(string("Could not find NPOIN= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!foundNELEM) {
+      SU2_MPI::Error(string("Could not find NELEM= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!foundNMARK) {
+      SU2_MPI::Error(string("Could not find NMARK= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
     }
     
-    position = text_line.find ("NMARK=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfMarkers = atoi(text_line.c_str());
-      foundNMARK = true;
+    metadata[0] = dimension;
+    metadata[1] = numberOfGlobalPoints;
+    metadata[2] = numberOfGlobalElements;
+    metadata[3] = numberOfMarkers;
+    metadata[4] = markerOffset;
+  }
+  
+  /*--- Communicate the metadata and the index of the file to all ranks. ---*/
+  
+  SU2_MPI::Bcast(metadata, 7, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Bcast(angleOffsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(pointOffsets.data(), size+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(elemOffsets.data(), size+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  
+  dimension              = metadata[0];
+  numberOfGlobalPoints   = metadata[1];
+  numberOfGlobalElements = metadata[2];
+  numberOfMarkers        = metadata[3];
+  markerOffset           = metadata[4];
+  
+  if (metadata[5]) {
+    
+    su2double AoA_Offset = angleOffsets[0];
+    
+    /*--- The offset is in deg ---*/
+    
+    su2double AoA_Current = config->GetAoA() + AoA_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+      }
+      config->SetAoA_Offset(AoA_Offset);
+      config->SetAoA(AoA_Current);
+    }
+    else {
+      if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+        cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
     }
     
-    /* Stop before we reach the next zone then check for errors below. */
-    position = text_line.find ("IZONE=",0);
-    if (position != string::npos) {
-      break;
+  }
+  
+  if (metadata[6]) {
+    
+    su2double AoS_Offset = angleOffsets[1];
+    
+    /*--- The offset is in deg ---*/
+    
+    su2double AoS_Current = config->GetAoS() + AoS_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+      }
+      config->SetAoS_Offset(AoS_Offset);
+      config->SetAoS(AoS_Current);
+    }
+    else {
+      if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+        cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
     }
+    
   }
   
-  /* Close the mesh file. */
-  mesh_file.close();
+}
+
+void CSU2ASCIIMeshReaderFVM::IndexSection(unsigned long nLines, vector<unsigned long>& offsets) {
   
-  /* Throw an error if any of the keywords was not found. */
-  if (!foundNDIME) {
-    SU2_MPI::Error(string("Could not find NDIME= keyword.") +
-                   string(" \n Check the SU2 ASCII file format."),
-                   CURRENT_FUNCTION);
+  /*--- Count the lines in large blocks, recording the start of the first
+   line of each rank (ranks with empty partitions get the next offset). ---*/
+  
+  CLinearPartitioner partitioner(nLines,0);
+  
+  unsigned long lineStart = mesh_file.tellg(), iLine = 0;
+  int iRank = 0;
+  
+  auto setOffsets = [&]() {
+    while ((iRank <= size) && (partitioner.GetCumulativeSizeBeforeRank(iRank) == iLine))
+      offsets[iRank++] = lineStart;
+  };
+  setOffsets();
+  
+  vector<char> block(1<<20);
+  
+  while (iLine < nLines) {
+    
+    const unsigned long blockStart = mesh_file.tellg();
+    mesh_file.read(block.data(), block.size());
+    const auto nRead = mesh_file.gcount();
+    
+    if (nRead == 0) {
+      SU2_MPI::Error(string("Unexpected end of file while reading ") + meshFilename +
+                     string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+    }
+    
+    const char *ptr = block.data(), *end = block.data() + nRead;
+    while ((iLine < nLines) && (ptr = static_cast<const char*>(memchr(ptr, '\n', end-ptr)))) {
+      ++ptr;
+      ++iLine;
+      lineStart = blockStart + (ptr - block.data());
+      setOffsets();
+    }
+    
+    /*--- Clear the flags in case the block went past the end of the file. ---*/
+    mesh_file.clear();
   }
-  if (!foundNPOIN) {
-    SU2_MPI::Error(string("Could not find NPOIN= keyword.") +
-                   string(" \n Check the SU2 ASCII file format."),
-                   CURRENT_FUNCTION);
+  
+  /*--- Position the file after the section. ---*/
+  
+  mesh_file.seekg(lineStart);
+  
+}
+
+void CSU2ASCIIMeshReaderFVM::ReadLines(const vector<unsigned long>& offsets, unsigned long nLinesSection,
+                                       unsigned long firstLine, unsigned long nLines,
+                                       vector<char>& buffer, vector<const char*>& lines) {
+  
+  lines.resize(nLines);
+  if (nLines == 0) return;
+  
+  /*--- Determine the partitions of the section (by line) that contain the range.
+   Usually this is our own partition, but the point partitioning changes when
+   new points are added to split an actuator disk. ---*/
+  
+  CLinearPartitioner partitioner(nLinesSection,0);
+  
+  const int firstRank = partitioner.GetRankContainingIndex(firstLine);
+  const int lastRank = partitioner.GetRankContainingIndex(firstLine+nLines-1);
+  const unsigned long begin = offsets[firstRank], end = offsets[lastRank+1];
+  
+  buffer.resize(end-begin+1);
+  
+  ifstream file(meshFilename.c_str(), ios::in | ios::binary);
+  if (file.fail()) {
+    SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
   }
-  if (!foundNELEM) {
-    SU2_MPI::Error(string("Could not find NELEM= keyword.") +
-                   string(" \n Check the SU2 ASCII file format."),
-                   CURRENT_FUNCTION);
+  file.seekg(begin);
+  file.read(buffer.data(), end-begin);
+  if ((unsigned long)file.gcount() != end-begin) {
+    SU2_MPI::Error(string("Unexpected end of file while reading ") + meshFilename, CURRENT_FUNCTION);
   }
-  if (!foundNMARK) {
-    SU2_MPI::Error(string("Could not find NMARK= keyword.") +
-                   string(" \n Check the SU2 ASCII file format."),
-                   CURRENT_FUNCTION);
+  file.close();
+  buffer.back() = '\0';
+  
+  /*--- Skip the lines before the range, and null-terminate the lines such
+   that the parsing cannot run into the next one. ---*/
+  
+  unsigned long nSkip = firstLine - partitioner.GetCumulativeSizeBeforeRank(firstRank);
+  
+  char* ptr = buffer.data();
+  for (unsigned long iLine = 0; iLine < nSkip+nLines; iLine++) {
+    char* lineEnd = static_cast<char*>(memchr(ptr, '\n', buffer.data()+end-begin-ptr));
+    if (lineEnd == nullptr) {
+      SU2_MPI::Error(string("Unexpected end of section while reading ") + meshFilename, CURRENT_FUNCTION);
+    }
+    *lineEnd = '\0';
+    if (iLine >= nSkip) lines[iLine-nSkip] = ptr;
+    ptr = lineEnd+1;
   }
   
 }
@@ -729,454 +898,132 @@ void CSU2ASCIIMeshReaderFVM::ReadPointCoordinates() {
   CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
   
   /* Determine number of local points */
-  for (unsigned long globalIndex=0; globalIndex < numberOfGlobalPoints; globalIndex++) {
-    if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-      numberOfLocalPoints++;
-    }
-  }
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  
+  /*--- The new actuator disk points (if any) are after the points of the file. ---*/
+  
+  const unsigned long nFilePoints = numberOfGlobalPoints - ActDiskNewPoints;
+  const unsigned long nReadPoints = (firstPoint >= nFilePoints)? 0 :
+                                    min(numberOfLocalPoints, nFilePoints-firstPoint);
   
   /* Prepare our data structure for the point coordinates. */
   localPointCoordinates.resize(dimension);
   for (int k = 0; k < dimension; k++)
-    localPointCoordinates[k].reserve(numberOfLocalPoints);
+    localPointCoordinates[k].resize(numberOfLocalPoints);
   
-  /*--- Open the mesh file and jump to our zone. ---*/
+  /*--- Read the lines of our linear partition and parse them in parallel. ---*/
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  vector<char> buffer;
+  vector<const char*> lines;
+  ReadLines(pointOffsets, nFilePoints, firstPoint, nReadPoints, buffer, lines);
   
-  /*--- Read the point coordinates into our data structure. ---*/
+  const auto chunkSize = computeStaticChunkSize(nReadPoints, omp_get_max_threads(), OMP_MAX_SIZE);
+  bool valid = true;
   
-  string text_line;
-  string::size_type position;
-  while (getline (mesh_file, text_line)) {
-    
-    position = text_line.find ("NPOIN=",0);
-    if (position != string::npos) {
-      
-      unsigned long GlobalIndex = 0;
-      while (GlobalIndex < numberOfGlobalPoints) {
-        
-        if (!actuator_disk) { getline(mesh_file, text_line); }
-        else {
-          if (GlobalIndex < numberOfGlobalPoints-ActDiskNewPoints) {
-            getline(mesh_file, text_line);
-          }
-          else {
-            /* This is a new actuator disk point, so we must construct a
-             string with the new point's coordinates. */
-            ostringstream strsX, strsY, strsZ;
-            unsigned long BackActDisk_Index = GlobalIndex;
-            unsigned long LocalIndex = BackActDisk_Index - (numberOfGlobalPoints-ActDiskNewPoints);
-            strsX.precision(20); strsY.precision(20); strsZ.precision(20);
-            su2double CoordX = CoordXActDisk[LocalIndex]; strsX << scientific << CoordX;
-            su2double CoordY = CoordYActDisk[LocalIndex]; strsY << scientific << CoordY;
-            su2double CoordZ = CoordZActDisk[LocalIndex]; strsZ << scientific << CoordZ;
-            text_line = strsX.str() + "\t" + strsY.str() + "\t" + strsZ.str();
-          }
-        }
-        
-        /*--- We only read information for this node if it is owned by this
-         rank based upon our initial linear partitioning. ---*/
-        
-        passivedouble Coords[3] = {0.0,0.0,0.0};
-        if ((int)pointPartitioner.GetRankContainingIndex(GlobalIndex) == rank) {
-          
-          istringstream point_line(text_line);
-          
-          /* Store the coordinates more clearly. */
-          if (dimension == 2) {
-            point_line >> Coords[0];
-            point_line >> Coords[1];
-          } else {
-            point_line >> Coords[0];
-            point_line >> Coords[1];
-            point_line >> Coords[2];
-          }
-          
-          /* Load into the coordinate class data structure. */
-          for (unsigned short iDim = 0; iDim < dimension; iDim++) {
-            localPointCoordinates[iDim].push_back(Coords[iDim]);
-            
-          }
-        }
-        GlobalIndex++;
-      }
-    }
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize) reduction(&&:valid))
+  for (unsigned long iPoint = 0; iPoint < nReadPoints; iPoint++) {
+    const char* ptr = lines[iPoint];
+    for (unsigned short iDim = 0; iDim < dimension; iDim++)
+      valid = ParseDouble(ptr, localPointCoordinates[iDim][iPoint]) && valid;
   }
   
-  mesh_file.close();
+  if (!valid) {
+    SU2_MPI::Error(string("Invalid point coordinates in ") + meshFilename +
+                   string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+  }
+  
+  /*--- New actuator disk points owned by this rank. ---*/
+  
+  for (unsigned long iPoint = nReadPoints; iPoint < numberOfLocalPoints; iPoint++) {
+    const unsigned long LocalIndex = firstPoint + iPoint - nFilePoints;
+    localPointCoordinates[0][iPoint] = SU2_TYPE::GetValue(CoordXActDisk[LocalIndex]);
+    localPointCoordinates[1][iPoint] = SU2_TYPE::GetValue(CoordYActDisk[LocalIndex]);
+    if (dimension == 3)
+      localPointCoordinates[2][iPoint] = SU2_TYPE::GetValue(CoordZActDisk[LocalIndex]);
+  }
   
 }
 
 void CSU2ASCIIMeshReaderFVM::ReadVolumeElementConnectivity() {
   
-  /* Get a partitioner to help with linear partitioning. */
-  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  /*--- Each rank reads a linear partition of the elements, which is then
+   redistributed to match the linear partitioning of the points, i.e. each
+   rank receives all elements that contain at least one of its points
+   (there is element redundancy across ranks). ---*/
   
-  /* Loop over our analytically defined of elements and store only those
-   that contain a node within our linear partition of points. */
-  numberOfLocalElements  = 0;
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON,0);
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
   
-  /*--- Open the mesh file and jump to our zone. ---*/
+  const unsigned long nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nFilePoints = numberOfGlobalPoints - ActDiskNewPoints;
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  vector<char> buffer;
+  vector<const char*> lines;
+  ReadLines(elemOffsets, numberOfGlobalElements, firstElem, nElemRead, buffer, lines);
   
-  string text_line;
-  string::size_type position;
-  while (getline (mesh_file, text_line)) {
+  vector<unsigned long> connectivity(nElemRead*SU2_CONN_SIZE, 0);
+  
+  const auto chunkSize = computeStaticChunkSize(nElemRead, omp_get_max_threads(), OMP_MAX_SIZE);
+  bool valid = true;
+  
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize) reduction(&&:valid))
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
     
-    /*--- Find the section containing the interior elements. ---*/
+    const char* ptr = lines[iElem];
+    unsigned long* elem = &connectivity[iElem*SU2_CONN_SIZE];
     
-    position = text_line.find ("NELEM=",0);
-    if (position != string::npos) {
-      
-      /*--- Loop over all the volumetric elements and store any element that
-       contains at least one of an owned node for this rank (i.e., there will
-       be element redundancy, since multiple ranks will store the same elems
-       on the boundaries of the initial linear partitioning. ---*/
-      
-      numberOfLocalElements = 0;
-      unsigned long GlobalIndex = 0;
-      bool isOwned = false;
-      while (GlobalIndex < numberOfGlobalElements) {
-        getline(mesh_file, text_line);
-        istringstream elem_line(text_line);
-        
-        /*--- Decide whether this rank needs each element. ---*/
-        
-        unsigned short VTK_Type;
-        elem_line >> VTK_Type;
-        
-        switch(VTK_Type) {
-            
-          case TRIANGLE:
-            
-            /*--- Store the connectivity for this element more clearly. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            
-            /*--- Adjust for actuator disk splitting if necessary. ---*/
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_TRIANGLE; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_TRIANGLE; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_TRIANGLE; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case QUADRILATERAL:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_QUADRILATERAL; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_QUADRILATERAL; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_QUADRILATERAL; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case TETRAHEDRON:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_TETRAHEDRON; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_TETRAHEDRON; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) {
-                      connectivity[i] = ActDiskPoint_Back[connectivity[i]];
-                    }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                  
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_TETRAHEDRON; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case HEXAHEDRON:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            elem_line >> connectivity[5];
-            elem_line >> connectivity[6];
-            elem_line >> connectivity[7];
-            
-            if (actuator_disk) {
-              for (unsigned short  i = 0; i<N_POINTS_HEXAHEDRON; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_HEXAHEDRON; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case PRISM:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            elem_line >> connectivity[5];
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_PRISM; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_PRISM; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_PRISM; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
-            }
-            GlobalIndex++;
-            break;
-            
-          case PYRAMID:
-            
-            /*--- Load the connectivity for this element. ---*/
-            
-            elem_line >> connectivity[0];
-            elem_line >> connectivity[1];
-            elem_line >> connectivity[2];
-            elem_line >> connectivity[3];
-            elem_line >> connectivity[4];
-            
-            if (actuator_disk) {
-              for (unsigned short i = 0; i<N_POINTS_PYRAMID; i++) {
-                if (ActDisk_Bool[connectivity[i]]) {
-                  
-                  su2double Xcg = 0.0; unsigned long Counter = 0;
-                  for (unsigned short j = 0; j<N_POINTS_PYRAMID; j++) {
-                    if (connectivity[j] < numberOfGlobalPoints-ActDiskNewPoints) {
-                      Xcg += CoordXVolumePoint[VolumePoint_Inv[connectivity[j]]];
-                      Counter++;
-                    }
-                  }
-                  Xcg = Xcg / su2double(Counter);
-                  
-                  if (Counter != 0)  {
-                    if (Xcg > Xloc) { connectivity[i] = ActDiskPoint_Back[connectivity[i]]; }
-                    else { connectivity[i] = connectivity[i]; }
-                  }
-                }
-              }
-            }
-            
-            /* Check whether any of the points reside in our linear partition. */
-            isOwned = false;
-            for (unsigned short i = 0; i < N_POINTS_PYRAMID; i++) {
-              if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-                isOwned = true;
-              }
-            }
-            
-            /* If so, we need to store the element locally. */
-            if (isOwned) {
-              localVolumeElementConnectivity.push_back(GlobalIndex);
-              localVolumeElementConnectivity.push_back(VTK_Type);
-              for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-                localVolumeElementConnectivity.push_back(connectivity[i]);
-              }
-              numberOfLocalElements++;
+    unsigned long VTK_Type = 0;
+    bool validElem = ParseUnsigned(ptr, VTK_Type);
+    
+    const auto nNodes = (VTK_Type == LINE)? 0 : GetNodesPerElement(VTK_Type);
+    validElem = validElem && (nNodes != 0);
+    
+    elem[0] = firstElem + iElem;
+    elem[1] = VTK_Type;
+    
+    unsigned long* nodes = &elem[SU2_CONN_SKIP];
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      validElem = validElem && ParseUnsigned(ptr, nodes[iNode]) && (nodes[iNode] < nFilePoints);
+    }
+    valid = valid && validElem;
+    if (!validElem) continue;
+    
+    /*--- Adjust for actuator disk splitting if necessary, the nodes on the disk
+     are replaced by the new points if the element is behind the disk. ---*/
+    
+    if (actuator_disk) {
+      for (unsigned short i = 0; i < nNodes; i++) {
+        if (ActDisk_Bool[nodes[i]]) {
+          
+          passivedouble Xcg = 0.0; unsigned long Counter = 0;
+          for (unsigned short j = 0; j < nNodes; j++) {
+            if (nodes[j] < nFilePoints) {
+              Xcg += SU2_TYPE::GetValue(CoordXVolumePoint[VolumePoint_Inv[nodes[j]]]);
+              Counter++;
             }
-            GlobalIndex++;
-            break;
+          }
+          
+          if (Counter != 0) {
+            Xcg = Xcg / passivedouble(Counter);
+            if (Xcg > SU2_TYPE::GetValue(Xloc)) nodes[i] = ActDiskPoint_Back[nodes[i]];
+          }
         }
       }
-      if (GlobalIndex == numberOfGlobalElements) break;
     }
   }
   
-  mesh_file.close();
+  if (!valid) {
+    SU2_MPI::Error(string("Invalid volume element in ") + meshFilename +
+                   string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+  }
+  
+  /*--- The lines are no longer needed, release them before the communication. ---*/
+  
+  vector<const char*>().swap(lines);
+  vector<char>().swap(buffer);
+  
+  DistributeVolumeElements(connectivity);
   
 }
 
@@ -1190,10 +1037,11 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
   
   /*--- In this routine, the boundary info is read by all ranks,
    however, the surface connectivity is still handled by the
-   master node (and eventually distributed by the master as well). ---*/
+   master node (and eventually distributed by the master as well).
+   Jump directly to the section containing the markers. ---*/
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  mesh_file.open(meshFilename, ios::in | ios::binary);
+  mesh_file.seekg(markerOffset);
   
   string text_line;
   string::size_type position;
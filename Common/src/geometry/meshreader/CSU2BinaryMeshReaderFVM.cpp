@@ -0,0 +1,352 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+#ifndef HAVE_MPI
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#endif
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /*--- The binary format stores one zone per file and is written after any
+   actuator disk splitting, i.e. the splitting is not done by this reader. ---*/
+
+  if ((val_nZone > 1) && config->GetMultizone_Mesh())
+    SU2_MPI::Error("SU2 binary mesh files contain a single zone, use one file per zone.", CURRENT_FUNCTION);
+
+  const bool actuator_disk = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                               (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                              ((config->GetKind_SU2() == SU2_CFD) ||
+                               ((config->GetKind_SU2() == SU2_DEF) &&
+                                (config->GetActDisk_SU2_DEF()))));
+  if (actuator_disk && !config->GetActDisk_DoubleSurface())
+    SU2_MPI::Error(string("Single surface actuator disks cannot be split when reading SU2 binary meshes.\n") +
+                   string("Split the disk with SU2_DEF (MESH_OUT_FORMAT= SU2_BINARY) and use ACTDISK_DOUBLE_SURFACE."),
+                   CURRENT_FUNCTION);
+
+  meshFilename = config->GetMesh_FileName();
+
+  /* Read the header and perform some basic error checks. */
+  OpenFile();
+
+  /* Read and store the points, interior elements, and surface elements.
+   We store only the points and interior elements on our rank's linear
+   partition, but the master stores the entire set of surface connectivity. */
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+  CloseFile();
+
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) { }
+
+void CSU2BinaryMeshReaderFVM::OpenFile() {
+
+  using namespace SU2BinaryMesh;
+
+#ifdef HAVE_MPI
+
+  /*--- All ranks open the file, the master reads the header. ---*/
+
+  int ierr = MPI_File_open(MPI_COMM_WORLD, const_cast<char*>(meshFilename.c_str()),
+                           MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle);
+  if (ierr) {
+    SU2_MPI::Error(string("The SU2 binary mesh file named ") + meshFilename +
+                   string(" was not found."), CURRENT_FUNCTION);
+  }
+
+  MPI_Offset mpiFileSize = 0;
+  MPI_File_get_size(fileHandle, &mpiFileSize);
+  fileSize = mpiFileSize;
+
+#else
+
+  struct stat stat_buf;
+  if (stat(meshFilename.c_str(), &stat_buf) != 0) {
+    SU2_MPI::Error(string("The SU2 binary mesh file named ") + meshFilename +
+                   string(" was not found."), CURRENT_FUNCTION);
+  }
+  fileSize = stat_buf.st_size;
+
+  /*--- Map the file in memory, only the pages that are touched are read. ---*/
+
+#ifndef _WIN32
+  int fd = open(meshFilename.c_str(), O_RDONLY);
+  void* ptr = (fd < 0 || fileSize == 0)? MAP_FAILED : mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (fd >= 0) close(fd);
+  if (ptr == MAP_FAILED) {
+    SU2_MPI::Error(string("Unable to map the SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+  mappedFile = static_cast<const char*>(ptr);
+#else
+  /*--- No memory mapping, the file is read once. ---*/
+  FILE* fhr = fopen(meshFilename.c_str(), "rb");
+  char* buffer = new char[fileSize];
+  if (!fhr || fread(buffer, 1, fileSize, fhr) != fileSize) {
+    SU2_MPI::Error(string("Unable to read the SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+  fclose(fhr);
+  mappedFile = buffer;
+#endif
+
+#endif
+
+  /*--- Read the header on the master and broadcast it. ---*/
+
+  for (auto& word : header) word = 0;
+  if (fileSize < HEADER_SIZE*sizeof(uint64_t)) {
+    SU2_MPI::Error(string("File ") + meshFilename + string(" is not a binary SU2 mesh file."), CURRENT_FUNCTION);
+  }
+  if (rank == MASTER_NODE)
+    ReadBytes(0, HEADER_SIZE*sizeof(uint64_t), header, false);
+
+  unsigned long headerBuf[HEADER_SIZE];
+  for (auto iWord = 0ul; iWord < HEADER_SIZE; ++iWord) headerBuf[iWord] = header[iWord];
+  SU2_MPI::Bcast(headerBuf, HEADER_SIZE, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  for (auto iWord = 0ul; iWord < HEADER_SIZE; ++iWord) header[iWord] = headerBuf[iWord];
+
+  if (header[MAGIC] != MAGIC_NUMBER) {
+    SU2_MPI::Error(string("File ") + meshFilename + string(" is not a binary SU2 mesh file.\n") +
+                   string("Use MESH_FORMAT= SU2 for ASCII meshes."), CURRENT_FUNCTION);
+  }
+  if (header[FORMAT] != FORMAT_VERSION) {
+    SU2_MPI::Error(string("Unsupported version of the SU2 binary mesh format in ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  dimension              = header[NDIM];
+  numberOfGlobalPoints   = header[NPOINT];
+  numberOfGlobalElements = header[NELEM];
+  numberOfMarkers        = header[NMARKER];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid dimension in ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  /*--- Check that all sections fit in the file. ---*/
+
+  const bool truncated =
+    (header[OFFSET_COORDS] + numberOfGlobalPoints*dimension*sizeof(passivedouble) > fileSize) ||
+    (header[OFFSET_ELEMS] + numberOfGlobalElements*SU2_CONN_SIZE*sizeof(uint64_t) > fileSize) ||
+    (header[OFFSET_MARKERS] + numberOfMarkers*MARKER_RECORD_SIZE > fileSize);
+  if (truncated) {
+    SU2_MPI::Error(string("The SU2 binary mesh file ") + meshFilename + string(" is truncated."), CURRENT_FUNCTION);
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Reading the SU2 binary mesh file " << meshFilename << "." << endl;
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::CloseFile() {
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+#ifndef _WIN32
+  munmap(const_cast<char*>(mappedFile), fileSize);
+#else
+  delete [] mappedFile;
+#endif
+  mappedFile = nullptr;
+#endif
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadBytes(unsigned long offset, unsigned long sizeInBytes,
+                                        void* data, bool collective) const {
+
+  if (offset + sizeInBytes > fileSize) {
+    SU2_MPI::Error(string("Attempted to read past the end of ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+#ifdef HAVE_MPI
+
+  /*--- The MPI counts are int, large ranges are read in chunks, for collective
+   reads all ranks need to make the same number of calls. ---*/
+
+  const unsigned long maxChunk = 1ul << 30;
+  unsigned long nChunk = (sizeInBytes + maxChunk - 1) / maxChunk, nChunkMax = nChunk;
+  if (collective)
+    SU2_MPI::Allreduce(&nChunk, &nChunkMax, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+  int ierr = MPI_SUCCESS;
+  for (unsigned long iChunk = 0; iChunk < nChunkMax; ++iChunk) {
+    const unsigned long begin = min(iChunk*maxChunk, sizeInBytes);
+    const int count = int(min(maxChunk, sizeInBytes - begin));
+    char* ptr = static_cast<char*>(data) + begin;
+    if (collective)
+      ierr += MPI_File_read_at_all(fileHandle, offset + begin, ptr, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    else
+      ierr += MPI_File_read_at(fileHandle, offset + begin, ptr, count, MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+  if (ierr != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Error reading the SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+#else
+  memcpy(data, mappedFile + offset, sizeInBytes);
+#endif
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  /*--- The points of this rank are contiguous in the file. ---*/
+
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long recordSize = dimension*sizeof(passivedouble);
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+  ReadBytes(header[SU2BinaryMesh::OFFSET_COORDS] + firstPoint*recordSize,
+            numberOfLocalPoints*recordSize, coords.data(), true);
+
+  /* Transpose into our data structure for the point coordinates. */
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) {
+    localPointCoordinates[k].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[k][iPoint] = coords[iPoint*dimension + k];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+
+  /*--- Each rank reads a linear partition of the elements, which is then
+   redistributed to match the linear partitioning of the points, i.e. each
+   rank receives all elements that contain at least one of its points
+   (there is element redundancy across ranks). ---*/
+
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
+
+  const unsigned long nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long recordSize = SU2_CONN_SIZE*sizeof(uint64_t);
+
+  vector<uint64_t> connFile(nElemRead*SU2_CONN_SIZE);
+  ReadBytes(header[SU2BinaryMesh::OFFSET_ELEMS] + firstElem*recordSize,
+            nElemRead*recordSize, connFile.data(), true);
+
+  /*--- Check the elements before sending them to the ranks that own their points. ---*/
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const uint64_t* elem = &connFile[iElem*SU2_CONN_SIZE];
+    const auto nNodes = GetNodesPerElement(elem[1]);
+    if ((nNodes == 0) || (elem[1] == LINE) || (elem[0] != firstElem+iElem)) {
+      SU2_MPI::Error(string("Invalid volume element in ") + meshFilename, CURRENT_FUNCTION);
+    }
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      if (elem[SU2_CONN_SKIP+iNode] >= numberOfGlobalPoints) {
+        SU2_MPI::Error(string("Invalid point index in ") + meshFilename, CURRENT_FUNCTION);
+      }
+    }
+  }
+
+  vector<unsigned long> connectivity(connFile.begin(), connFile.end());
+  vector<uint64_t>().swap(connFile);
+
+  DistributeVolumeElements(connectivity);
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+
+  using namespace SU2BinaryMesh;
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The master reads the marker table and the connectivity of all markers. ---*/
+
+  vector<char> names(numberOfMarkers*MARKER_NAME_SIZE+1, '\0');
+
+  if (rank == MASTER_NODE) {
+
+    vector<char> table(numberOfMarkers*MARKER_RECORD_SIZE);
+    ReadBytes(header[OFFSET_MARKERS], table.size(), table.data(), false);
+
+    for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+      const char* record = &table[iMarker*MARKER_RECORD_SIZE];
+      memcpy(&names[iMarker*MARKER_NAME_SIZE], record, MARKER_NAME_SIZE);
+
+      uint64_t nElem = 0, offset = 0;
+      memcpy(&nElem, record + MARKER_NAME_SIZE, sizeof(uint64_t));
+      memcpy(&offset, record + MARKER_NAME_SIZE + sizeof(uint64_t), sizeof(uint64_t));
+
+      vector<uint64_t> conn(nElem*SU2_CONN_SIZE);
+      ReadBytes(offset, conn.size()*sizeof(uint64_t), conn.data(), false);
+
+      /*--- Check the element types, lines are only possible in 2D. ---*/
+
+      for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+        const auto vtkType = conn[iElem*SU2_CONN_SIZE+1];
+        const bool valid = (dimension == 2)? (vtkType == LINE) :
+                           ((vtkType == TRIANGLE) || (vtkType == QUADRILATERAL));
+        if (!valid) {
+          SU2_MPI::Error(string("Invalid boundary element type in ") + meshFilename, CURRENT_FUNCTION);
+        }
+      }
+
+      surfaceElementConnectivity[iMarker].assign(conn.begin(), conn.end());
+    }
+  }
+
+  /*--- All ranks get the names. ---*/
+
+  SU2_MPI::Bcast(names.data(), numberOfMarkers*MARKER_NAME_SIZE, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+    const char* name = &names[iMarker*MARKER_NAME_SIZE];
+    markerNames[iMarker] = string(name, strnlen(name, MARKER_NAME_SIZE));
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(string("Mesh file contains deprecated SEND_RECEIVE marker!\n\n") +
+                     string("Please remove any SEND_RECEIVE markers from the SU2 mesh."),
+                     CURRENT_FUNCTION);
+    }
+  }
+
+}
@@ -285,6 +285,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+        case CGS_FGMRES:
+
+          Tot_Iter = System.FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, Residual, Screen_Output, config, true);
+
+          break;
+
           /*--- Solve the linear system (BCGSTAB) ---*/
 
         case BCGSTAB:
@@ -300,6 +306,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+        case PIPELINED_CG:
+
+          Tot_Iter = System.PipelinedCG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, Residual, Screen_Output, config);
+
+          break;
+
       }
     }
     
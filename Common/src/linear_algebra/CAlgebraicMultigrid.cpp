@@ -0,0 +1,717 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the smoothed aggregation algebraic multigrid hierarchy.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+/*--- Marker for points that do not belong to an aggregate. ---*/
+const unsigned long NOT_AGGREGATED = ~0ul;
+
+/*--- Threshold for strong connections, |A_ij| > theta * sqrt(|A_ii| * |A_jj|). ---*/
+const passivedouble STRENGTH_THRESHOLD = 0.08;
+
+/*--- Aggregation stops if a level has more than this fraction of the points of the previous. ---*/
+const passivedouble MIN_COARSENING = 0.8;
+
+/*--- Relative tolerance (on the squared norms) to consider a matrix symmetric. ---*/
+const passivedouble SYMMETRY_TOLERANCE = 1e-10;
+
+/*--- Number of iterations to estimate the spectral radius of D^{-1}*A. ---*/
+const unsigned long POWER_ITERATIONS = 15;
+
+/*--- Small dense kernels, the blocks are square (n x n) and row-major. ---*/
+
+template<class T>
+T squaredNorm(unsigned long n, const T* a) {
+  T sum = 0.0;
+  for (auto k = 0ul; k < n*n; ++k) sum += a[k]*a[k];
+  return sum;
+}
+
+template<class T>
+void gemmAdd(unsigned long n, T alpha, const T* a, const T* b, T* c) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j) {
+      T sum = 0.0;
+      for (auto k = 0ul; k < n; ++k) sum += a[i*n+k] * b[k*n+j];
+      c[i*n+j] += alpha * sum;
+    }
+}
+
+template<class T>
+void gemm(unsigned long n, const T* a, const T* b, T* c) {
+  for (auto k = 0ul; k < n*n; ++k) c[k] = 0.0;
+  gemmAdd(n, T(1.0), a, b, c);
+}
+
+template<class T>
+void gemv(unsigned long n, const T* a, const T* x, T* y) {
+  for (auto i = 0ul; i < n; ++i) {
+    T sum = 0.0;
+    for (auto j = 0ul; j < n; ++j) sum += a[i*n+j] * x[j];
+    y[i] = sum;
+  }
+}
+
+template<class T>
+void blockInverse(unsigned long n, T* a, T* inv) {
+  /*--- Gauss-Jordan elimination without pivoting, as in CSysMatrix, "a" is destroyed. ---*/
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j)
+      inv[i*n+j] = T(i==j);
+
+  for (auto k = 0ul; k < n; ++k) {
+    const T pivot = 1.0 / a[k*n+k];
+    for (auto j = 0ul; j < n; ++j) { a[k*n+j] *= pivot; inv[k*n+j] *= pivot; }
+    for (auto i = 0ul; i < n; ++i) {
+      if (i == k) continue;
+      const T weight = a[i*n+k];
+      for (auto j = 0ul; j < n; ++j) {
+        a[i*n+j] -= weight * a[k*n+j];
+        inv[i*n+j] -= weight * inv[k*n+j];
+      }
+    }
+  }
+}
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(unsigned long nvar, unsigned long npointdomain, const unsigned long* row_ptr,
+                                            const unsigned long* col_ind, const ScalarType* values, const ScalarType* invDiag) {
+  /*--- The matrix coefficients change between calls (e.g. new Newton iteration, or deformation step)
+   *    so the hierarchy is rebuilt from scratch, the setup costs about as much as a few V-cycles. ---*/
+
+  SU2_OMP_MASTER
+  {
+    nVar = nvar;
+    nPointDomain = npointdomain;
+    fineResidual.resize(nPointDomain*nVar);
+    levels.clear();
+    levels.reserve(MAX_LEVELS);
+    denseCoarsest = false;
+  }
+  SU2_OMP_BARRIER
+
+  CMatrixView mat = {npointdomain, nvar, row_ptr, col_ind, values, invDiag};
+
+  /*--- Smoothing the prolongation destroys the diagonal dominance of the coarse operators of
+   *    non-symmetric (e.g. upwind convection) matrices, for those plain aggregation is used.
+   *    The symmetry of the finest level is inherited by the coarse ones, since R = P^T. ---*/
+
+  SU2_OMP_MASTER
+  smoothProlongation = IsSymmetric(mat);
+  SU2_OMP_BARRIER
+  ScalarType* omega = &fineOmega;
+
+  while (Coarsen(mat, *omega)) {
+    const auto& level = levels.back();
+    mat = {level.A.nRow, nvar, level.A.row_ptr.data(), level.A.col_ind.data(),
+           level.A.values.data(), level.invDiag.data()};
+    omega = &levels.back().omega;
+  }
+
+  SU2_OMP_MASTER
+  FactorizeCoarsest();
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+bool CAlgebraicMultigrid<ScalarType>::Coarsen(const CMatrixView& mat, ScalarType& omega) {
+
+  const auto nRow = mat.nRow;
+  const auto blkSize = nVar*nVar;
+  const auto chunk = computeStaticChunkSize(nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  /*--- The relaxation factor of the Jacobi smoother is also used to smooth the prolongation. ---*/
+
+  const ScalarType w = 4.0 / (3.0 * SpectralRadius(mat));
+
+  SU2_OMP_MASTER
+  omega = w;
+
+  if ((nRow <= COARSEST_SIZE) || (levels.size() == MAX_LEVELS)) {
+    SU2_OMP_BARRIER
+    return false;
+  }
+
+  /*--- Aggregation (sequential), and allocation of the new level. Note that addLevel
+   *    is only written after a barrier, when all threads have read its previous value. ---*/
+
+  SU2_OMP_MASTER
+  {
+    const auto nCoarse = Aggregate(mat);
+
+    addLevel = (nCoarse > 0) && (nCoarse < MIN_COARSENING*nRow);
+
+    if (addLevel) {
+      levels.emplace_back();
+      auto& level = levels.back();
+      level.P.nRow = nRow;
+      level.P.nCol = nCoarse;
+      level.P.nVar = nVar;
+      level.P.row_ptr.assign(nRow+1, 0);
+      level.A.nRow = level.A.nCol = nCoarse;
+      level.A.nVar = nVar;
+      level.A.row_ptr.assign(nCoarse+1, 0);
+    }
+  }
+  SU2_OMP_BARRIER
+
+  if (!addLevel) return false;
+
+  auto& level = levels.back();
+  auto& P = level.P;
+  auto& R = level.R;
+  auto& A = level.A;
+  const auto nCoarse = A.nRow;
+
+  vector<unsigned long> cols;
+
+  /*--- Count the coarse points that influence each fine point via A*P_tent. ---*/
+
+  SU2_OMP_FOR_DYN(chunk)
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    cols.clear();
+    for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = mat.col_ind[k];
+      if (jPoint >= nRow || aggregate[jPoint] == NOT_AGGREGATED) continue;
+      if (find(cols.begin(), cols.end(), aggregate[jPoint]) == cols.end())
+        cols.push_back(aggregate[jPoint]);
+    }
+    P.row_ptr[iPoint+1] = cols.size();
+  }
+
+  SU2_OMP_MASTER
+  {
+    for (auto iPoint = 0ul; iPoint < nRow; ++iPoint)
+      P.row_ptr[iPoint+1] += P.row_ptr[iPoint];
+    P.col_ind.resize(P.row_ptr[nRow]);
+    P.values.resize(P.row_ptr[nRow]*blkSize);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Smoothed prolongation, P = (I - w D^{-1} A) P_tent, where P_tent(i,J) = I/sqrt(|J|)
+   *    if point i belongs to aggregate J (whose size is |J|) and 0 otherwise. ---*/
+
+  SU2_OMP_FOR_DYN(chunk)
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+
+    const auto begin = P.row_ptr[iPoint];
+    auto nnz = 0ul;
+
+    for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = mat.col_ind[k];
+      if (jPoint >= nRow || aggregate[jPoint] == NOT_AGGREGATED) continue;
+      const auto J = aggregate[jPoint];
+
+      auto pos = begin;
+      while (pos < begin+nnz && P.col_ind[pos] != J) ++pos;
+      ScalarType* block = &P.values[pos*blkSize];
+      if (pos == begin+nnz) {
+        P.col_ind[pos] = J;
+        for (auto iVar = 0ul; iVar < blkSize; ++iVar) block[iVar] = 0.0;
+        ++nnz;
+      }
+
+      const ScalarType scale = 1.0 / sqrt(ScalarType(aggregateSize[J]));
+
+      if (smoothProlongation)
+        gemmAdd(nVar, -w*scale, &mat.invDiag[iPoint*blkSize], &mat.values[k*blkSize], block);
+
+      if (jPoint == iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) block[iVar*(nVar+1)] += scale;
+    }
+  }
+
+  /*--- Restriction, R = P^T, and allocation of the level vectors (sequential). ---*/
+
+  SU2_OMP_MASTER
+  {
+    R.nRow = nCoarse;
+    R.nCol = nRow;
+    R.nVar = nVar;
+    R.row_ptr.assign(nCoarse+1, 0);
+    R.col_ind.resize(P.col_ind.size());
+    R.values.resize(P.values.size());
+
+    for (auto k = 0ul; k < P.col_ind.size(); ++k)
+      ++R.row_ptr[P.col_ind[k]+1];
+    for (auto J = 0ul; J < nCoarse; ++J)
+      R.row_ptr[J+1] += R.row_ptr[J];
+
+    vector<unsigned long> next(R.row_ptr.begin(), R.row_ptr.end()-1);
+
+    for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+      for (auto k = P.row_ptr[iPoint]; k < P.row_ptr[iPoint+1]; ++k) {
+        const auto pos = next[P.col_ind[k]]++;
+        R.col_ind[pos] = iPoint;
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            R.values[pos*blkSize+jVar*nVar+iVar] = P.values[k*blkSize+iVar*nVar+jVar];
+      }
+    }
+
+    level.invDiag.resize(nCoarse*blkSize);
+    level.x.resize(nCoarse*nVar);
+    level.b.resize(nCoarse*nVar);
+    level.r.resize(nCoarse*nVar);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Galerkin product, A_c = R*A*P, computed by coarse rows. The marker holds the
+   *    last coarse row where a column was found, and "position" where it was stored. ---*/
+
+  const auto coarseChunk = computeStaticChunkSize(nCoarse, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  vector<unsigned long> marker(nCoarse, NOT_AGGREGATED), position(nCoarse);
+
+  SU2_OMP_FOR_DYN(coarseChunk)
+  for (auto I = 0ul; I < nCoarse; ++I) {
+    auto nnz = 0ul;
+    for (auto kr = R.row_ptr[I]; kr < R.row_ptr[I+1]; ++kr) {
+      const auto iPoint = R.col_ind[kr];
+      for (auto ka = mat.row_ptr[iPoint]; ka < mat.row_ptr[iPoint+1]; ++ka) {
+        const auto jPoint = mat.col_ind[ka];
+        if (jPoint >= nRow) continue;
+        for (auto kp = P.row_ptr[jPoint]; kp < P.row_ptr[jPoint+1]; ++kp) {
+          const auto J = P.col_ind[kp];
+          if (marker[J] != I) { marker[J] = I; ++nnz; }
+        }
+      }
+    }
+    A.row_ptr[I+1] = nnz;
+  }
+
+  SU2_OMP_MASTER
+  {
+    for (auto I = 0ul; I < nCoarse; ++I)
+      A.row_ptr[I+1] += A.row_ptr[I];
+    A.col_ind.resize(A.row_ptr[nCoarse]);
+    A.values.resize(A.row_ptr[nCoarse]*blkSize);
+  }
+  SU2_OMP_BARRIER
+
+  marker.assign(nCoarse, NOT_AGGREGATED);
+
+  SU2_OMP_FOR_DYN(coarseChunk)
+  for (auto I = 0ul; I < nCoarse; ++I) {
+    const auto begin = A.row_ptr[I];
+    auto nnz = 0ul;
+
+    for (auto kr = R.row_ptr[I]; kr < R.row_ptr[I+1]; ++kr) {
+      const auto iPoint = R.col_ind[kr];
+
+      for (auto ka = mat.row_ptr[iPoint]; ka < mat.row_ptr[iPoint+1]; ++ka) {
+        const auto jPoint = mat.col_ind[ka];
+        if (jPoint >= nRow) continue;
+
+        ScalarType RA[MAXNVAR*MAXNVAR];
+        gemm(nVar, &R.values[kr*blkSize], &mat.values[ka*blkSize], RA);
+
+        for (auto kp = P.row_ptr[jPoint]; kp < P.row_ptr[jPoint+1]; ++kp) {
+          const auto J = P.col_ind[kp];
+          if (marker[J] != I) {
+            marker[J] = I;
+            position[J] = begin + nnz++;
+            A.col_ind[position[J]] = J;
+            for (auto iVar = 0ul; iVar < blkSize; ++iVar)
+              A.values[position[J]*blkSize+iVar] = 0.0;
+          }
+          gemmAdd(nVar, ScalarType(1.0), RA, &P.values[kp*blkSize], &A.values[position[J]*blkSize]);
+        }
+      }
+    }
+  }
+
+  /*--- Inverse of the diagonal blocks for the smoother. ---*/
+
+  SU2_OMP_FOR_STAT(coarseChunk)
+  for (auto I = 0ul; I < nCoarse; ++I) {
+    ScalarType block[MAXNVAR*MAXNVAR];
+    for (auto iVar = 0ul; iVar < blkSize; ++iVar) block[iVar] = 0.0;
+    for (auto k = A.row_ptr[I]; k < A.row_ptr[I+1]; ++k) {
+      if (A.col_ind[k] == I) {
+        for (auto iVar = 0ul; iVar < blkSize; ++iVar) block[iVar] = A.values[k*blkSize+iVar];
+        break;
+      }
+    }
+    blockInverse(nVar, block, &level.invDiag[I*blkSize]);
+  }
+
+  return true;
+}
+
+template<class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(const CMatrixView& mat) {
+
+  const auto nRow = mat.nRow;
+  const auto blkSize = nVar*nVar;
+  const passivedouble theta2 = pow(STRENGTH_THRESHOLD, 2);
+
+  /*--- Norm of the diagonal blocks. ---*/
+
+  vector<ScalarType> diagNorm(nRow, 0.0);
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint)
+    for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k)
+      if (mat.col_ind[k] == iPoint)
+        diagNorm[iPoint] = sqrt(squaredNorm(nVar, &mat.values[k*blkSize]));
+
+  /*--- Strong connections, in CSR format, the halo points are ignored. ---*/
+
+  vector<unsigned long> strong_ptr(nRow+1, 0), strong_ind;
+  vector<ScalarType> strength;
+  strong_ind.reserve(mat.row_ptr[nRow]-mat.row_ptr[0]);
+  strength.reserve(strong_ind.capacity());
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = mat.col_ind[k];
+      if (jPoint >= nRow || jPoint == iPoint) continue;
+      const ScalarType norm = squaredNorm(nVar, &mat.values[k*blkSize]);
+      if (norm > theta2 * diagNorm[iPoint] * diagNorm[jPoint]) {
+        strong_ind.push_back(jPoint);
+        strength.push_back(norm / diagNorm[jPoint]);
+      }
+    }
+    strong_ptr[iPoint+1] = strong_ind.size();
+  }
+
+  /*--- Points without strong connections (e.g. Dirichlet rows) are left for the smoother. ---*/
+
+  auto isolated = [&](unsigned long iPoint) { return strong_ptr[iPoint] == strong_ptr[iPoint+1]; };
+
+  aggregate.assign(nRow, NOT_AGGREGATED);
+  unsigned long nAggregate = 0;
+
+  /*--- Phase 1, points whose strong neighbors are all free form aggregates with them. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    if (isolated(iPoint) || aggregate[iPoint] != NOT_AGGREGATED) continue;
+
+    bool free = true;
+    for (auto k = strong_ptr[iPoint]; k < strong_ptr[iPoint+1] && free; ++k)
+      free = (aggregate[strong_ind[k]] == NOT_AGGREGATED);
+    if (!free) continue;
+
+    aggregate[iPoint] = nAggregate;
+    for (auto k = strong_ptr[iPoint]; k < strong_ptr[iPoint+1]; ++k)
+      aggregate[strong_ind[k]] = nAggregate;
+    ++nAggregate;
+  }
+
+  /*--- Phase 2, remaining points join the aggregate (from phase 1) they are most strongly connected to. ---*/
+
+  const auto phase1 = aggregate;
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    if (isolated(iPoint) || aggregate[iPoint] != NOT_AGGREGATED) continue;
+
+    ScalarType maxStrength = 0.0;
+    for (auto k = strong_ptr[iPoint]; k < strong_ptr[iPoint+1]; ++k) {
+      const auto jPoint = strong_ind[k];
+      if (phase1[jPoint] != NOT_AGGREGATED && strength[k] > maxStrength) {
+        maxStrength = strength[k];
+        aggregate[iPoint] = phase1[jPoint];
+      }
+    }
+  }
+
+  /*--- Phase 3, points still free form aggregates with their free strong neighbors. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    if (isolated(iPoint) || aggregate[iPoint] != NOT_AGGREGATED) continue;
+
+    aggregate[iPoint] = nAggregate;
+    for (auto k = strong_ptr[iPoint]; k < strong_ptr[iPoint+1]; ++k)
+      if (aggregate[strong_ind[k]] == NOT_AGGREGATED)
+        aggregate[strong_ind[k]] = nAggregate;
+    ++nAggregate;
+  }
+
+  aggregateSize.assign(nAggregate, 0);
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint)
+    if (aggregate[iPoint] != NOT_AGGREGATED) ++aggregateSize[aggregate[iPoint]];
+
+  return nAggregate;
+}
+
+template<class ScalarType>
+bool CAlgebraicMultigrid<ScalarType>::IsSymmetric(const CMatrixView& mat) const {
+
+  const auto nRow = mat.nRow;
+  const auto blkSize = nVar*nVar;
+
+  /*--- Compare the norm of A - A^T with the norm of A (owned part), block A_ji is
+   *    found by linear search as the rows of the matrices of interest are short. ---*/
+
+  ScalarType normA = 0.0, normDiff = 0.0;
+
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = mat.col_ind[k];
+      if (jPoint >= nRow) continue;
+
+      const ScalarType* Aij = &mat.values[k*blkSize];
+      const ScalarType* Aji = nullptr;
+      for (auto l = mat.row_ptr[jPoint]; l < mat.row_ptr[jPoint+1] && !Aji; ++l)
+        if (mat.col_ind[l] == iPoint) Aji = &mat.values[l*blkSize];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          const ScalarType aji = Aji? Aji[jVar*nVar+iVar] : ScalarType(0.0);
+          normA += pow(Aij[iVar*nVar+jVar], 2);
+          normDiff += pow(Aij[iVar*nVar+jVar] - aji, 2);
+        }
+      }
+    }
+  }
+
+  return normDiff <= SYMMETRY_TOLERANCE * normA;
+}
+
+template<class ScalarType>
+ScalarType CAlgebraicMultigrid<ScalarType>::SpectralRadius(const CMatrixView& mat) {
+
+  const auto nRow = mat.nRow;
+  const auto blkSize = nVar*nVar;
+  const auto chunk = computeStaticChunkSize(nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  SU2_OMP_MASTER
+  {
+    powerIter[0].resize(nRow*nVar);
+    powerIter[1].resize(nRow*nVar);
+    for (auto i = 0ul; i < nRow*nVar; ++i) powerIter[0][i] = 1.0 + (i % 7) / 7.0;
+    spectralRadius = 1.0;
+  }
+  SU2_OMP_BARRIER
+
+  for (auto iter = 0ul; iter < POWER_ITERATIONS; ++iter) {
+
+    const ScalarType* x = powerIter[0].data();
+    ScalarType* y = powerIter[1].data();
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+      ScalarType Ax[MAXNVAR] = {0.0};
+      for (auto k = mat.row_ptr[iPoint]; k < mat.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = mat.col_ind[k];
+        if (jPoint >= nRow) continue;
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            Ax[iVar] += mat.values[k*blkSize+iVar*nVar+jVar] * x[jPoint*nVar+jVar];
+      }
+      gemv(nVar, &mat.invDiag[iPoint*blkSize], Ax, &y[iPoint*nVar]);
+    }
+
+    /*--- Normalize (sequential), the ratio of norms converges to the spectral radius. ---*/
+
+    SU2_OMP_MASTER
+    {
+      ScalarType normX = 0.0, normY = 0.0;
+      for (auto i = 0ul; i < nRow*nVar; ++i) {
+        normX += x[i]*x[i];
+        normY += y[i]*y[i];
+      }
+      if (normY > 0.0) {
+        spectralRadius = sqrt(normY / normX);
+        for (auto i = 0ul; i < nRow*nVar; ++i) powerIter[0][i] = y[i] / sqrt(normY);
+      }
+    }
+    SU2_OMP_BARRIER
+  }
+
+  return spectralRadius;
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::FactorizeCoarsest() {
+
+  if (levels.empty()) return;
+
+  const auto& A = levels.back().A;
+  const auto N = A.nRow*nVar;
+
+  denseCoarsest = (N <= MAX_DENSE_SIZE);
+  if (!denseCoarsest) return;
+
+  /*--- Assemble the dense matrix. ---*/
+
+  coarseLU.assign(N*N, 0.0);
+  coarsePivot.resize(N);
+
+  for (auto I = 0ul; I < A.nRow; ++I)
+    for (auto k = A.row_ptr[I]; k < A.row_ptr[I+1]; ++k)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          coarseLU[(I*nVar+iVar)*N + A.col_ind[k]*nVar+jVar] = A.values[(k*nVar+iVar)*nVar+jVar];
+
+  /*--- LU factorization with partial pivoting, in place. ---*/
+
+  for (auto k = 0ul; k < N; ++k) {
+    auto pivot = k;
+    for (auto i = k+1; i < N; ++i)
+      if (fabs(coarseLU[i*N+k]) > fabs(coarseLU[pivot*N+k])) pivot = i;
+    coarsePivot[k] = pivot;
+
+    if (coarseLU[pivot*N+k] == 0.0) {
+      /*--- Singular operator, use the smoother instead. ---*/
+      denseCoarsest = false;
+      return;
+    }
+    if (pivot != k)
+      for (auto j = 0ul; j < N; ++j) swap(coarseLU[k*N+j], coarseLU[pivot*N+j]);
+
+    for (auto i = k+1; i < N; ++i) {
+      const ScalarType weight = coarseLU[i*N+k] / coarseLU[k*N+k];
+      coarseLU[i*N+k] = weight;
+      for (auto j = k+1; j < N; ++j)
+        coarseLU[i*N+j] -= weight * coarseLU[k*N+j];
+    }
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(unsigned long iLevel) const {
+
+  const auto& level = levels[iLevel];
+  const auto nRow = level.A.nRow;
+  const auto chunk = computeStaticChunkSize(nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+    ScalarType Ax[MAXNVAR] = {0.0};
+    level.A.RowProduct(iPoint, level.x.data(), Ax);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      level.r[iPoint*nVar+iVar] = level.b[iPoint*nVar+iVar] - Ax[iVar];
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(unsigned long iLevel, bool zeroGuess, unsigned long nSweeps) const {
+
+  const auto& level = levels[iLevel];
+  const auto nRow = level.A.nRow;
+  const auto blkSize = nVar*nVar;
+  const auto chunk = computeStaticChunkSize(nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  for (auto iSweep = 0ul; iSweep < nSweeps; ++iSweep) {
+
+    if (iSweep == 0 && zeroGuess) {
+      /*--- x = w D^{-1} b ---*/
+      SU2_OMP_FOR_STAT(chunk)
+      for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+        gemv(nVar, &level.invDiag[iPoint*blkSize], &level.b[iPoint*nVar], &level.x[iPoint*nVar]);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) level.x[iPoint*nVar+iVar] *= level.omega;
+      }
+    }
+    else {
+      /*--- x += w D^{-1} (b - A x) ---*/
+      Residual(iLevel);
+
+      SU2_OMP_FOR_STAT(chunk)
+      for (auto iPoint = 0ul; iPoint < nRow; ++iPoint) {
+        ScalarType corr[MAXNVAR];
+        gemv(nVar, &level.invDiag[iPoint*blkSize], &level.r[iPoint*nVar], corr);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) level.x[iPoint*nVar+iVar] += level.omega * corr[iVar];
+      }
+    }
+  }
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::VCycle(unsigned long iLevel) const {
+
+  const auto& level = levels[iLevel];
+
+  /*--- Coarsest level, direct solution or many smoothing sweeps. ---*/
+
+  if (iLevel+1 == levels.size()) {
+    if (denseCoarsest) {
+      SU2_OMP_MASTER
+      {
+        const auto N = level.A.nRow*nVar;
+        auto x = level.x.data();
+
+        for (auto i = 0ul; i < N; ++i) x[i] = level.b[i];
+        for (auto k = 0ul; k < N; ++k) swap(x[k], x[coarsePivot[k]]);
+
+        for (auto i = 1ul; i < N; ++i)
+          for (auto j = 0ul; j < i; ++j)
+            x[i] -= coarseLU[i*N+j] * x[j];
+
+        for (auto i = N; i > 0ul;) {
+          --i; // unsigned type
+          for (auto j = i+1; j < N; ++j)
+            x[i] -= coarseLU[i*N+j] * x[j];
+          x[i] /= coarseLU[i*N+i];
+        }
+      }
+      SU2_OMP_BARRIER
+    }
+    else {
+      Smooth(iLevel, true, 4*NUM_SWEEPS);
+    }
+    return;
+  }
+
+  const auto& next = levels[iLevel+1];
+  const auto chunk = computeStaticChunkSize(level.A.nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  /*--- Pre-smoothing and restriction of the residual. ---*/
+
+  Smooth(iLevel, true, NUM_SWEEPS);
+  Residual(iLevel);
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto I = 0ul; I < next.A.nRow; ++I) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) next.b[I*nVar+iVar] = 0.0;
+    next.R.RowProduct(I, level.r.data(), &next.b[I*nVar]);
+  }
+
+  VCycle(iLevel+1);
+
+  /*--- Prolongation of the correction and post-smoothing. ---*/
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iPoint = 0ul; iPoint < level.A.nRow; ++iPoint)
+    next.P.RowProduct(iPoint, next.x.data(), &level.x[iPoint*nVar]);
+
+  Smooth(iLevel, false, NUM_SWEEPS);
+}
+
+template class CAlgebraicMultigrid<su2double>;
+#ifdef CODI_REVERSE_TYPE
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<float>;
+#endif
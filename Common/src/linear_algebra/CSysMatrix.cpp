@@ -165,8 +165,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
   }
 
-  if (ilu_needed || (sol_prec==JACOBI) || (sol_prec==LINELET) ||
-      (adjoint && (adj_prec==JACOBI)) || (def_prec==JACOBI))
+  if (ilu_needed || (sol_prec==JACOBI) || (sol_prec==LINELET) || (sol_prec==AMG) ||
+      (adjoint && (adj_prec==JACOBI)) || (def_prec==JACOBI) || (def_prec==AMG))
   {
     ALLOC_AND_INIT(invM, nPointDomain*nVar*nEqn);
   }
@@ -223,13 +223,10 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
 
   /*--- Local variables ---*/
 
-  unsigned short iVar;
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE        = 0;
 
-  unsigned long iPoint, msg_offset, buf_offset;
-
-  int iMessage, iSend, nSend;
+  int iMessage;
 
   /*--- Create a boolean for reversing the order of comms. ---*/
 
@@ -263,10 +260,6 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
     geometry->AllocateP2PComms(COUNT_PER_POINT);
   }
 
-  /*--- Set some local pointers to make access simpler. ---*/
-
-  su2double *bufDSend = geometry->bufD_P2PSend;
-
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
 
@@ -278,82 +271,10 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
 
     for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
 
-      switch (commType) {
-
-        case SOLUTION_MATRIX:
-
-          /*--- Get the offset for the start of this message. ---*/
-
-          msg_offset = geometry->nPoint_P2PSend[iMessage];
-
-          /*--- Total count can include multiple pieces of data per point. ---*/
-
-          nSend = (geometry->nPoint_P2PSend[iMessage+1] -
-                   geometry->nPoint_P2PSend[iMessage]);
-
-          for (iSend = 0; iSend < nSend; iSend++) {
-
-            /*--- Get the local index for this communicated data. ---*/
-
-            iPoint = geometry->Local_Point_P2PSend[msg_offset + iSend];
-
-            /*--- Compute the offset in the recv buffer for this point. ---*/
-
-            buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
-
-            /*--- Load the buffer with the data to be sent. ---*/
-
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = x[iPoint*nVar+iVar];
-
-          }
-
-          break;
-
-        case SOLUTION_MATRIXTRANS:
-
-          /*--- We are going to communicate in reverse, so we use the
-           recv buffer for the send instead. Also, all of the offsets
-           and counts are derived from the recv data structures. ---*/
-
-          bufDSend = geometry->bufD_P2PRecv;
-
-          /*--- Get the offset for the start of this message. ---*/
-
-          msg_offset = geometry->nPoint_P2PRecv[iMessage];
+      /*--- Load the buffer with the data to be sent, in reverse mode (transposed
+       product) the recv points and buffer are used for the sends. ---*/
 
-          /*--- Total count can include multiple pieces of data per point. ---*/
-
-          nSend = (geometry->nPoint_P2PRecv[iMessage+1] -
-                   geometry->nPoint_P2PRecv[iMessage]);
-
-          for (iSend = 0; iSend < nSend; iSend++) {
-
-            /*--- Get the local index for this communicated data. Here we
-             again use the recv structure to find the send point, since
-             the usual recv points are now the senders in reverse mode. ---*/
-
-            iPoint = geometry->Local_Point_P2PRecv[msg_offset + iSend];
-
-            /*--- Compute the offset in the recv buffer for this point. ---*/
-
-            buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
-
-            /*--- Load the buffer with the data to be sent. ---*/
-
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = x[iPoint*nVar+iVar];
-
-          }
-
-          break;
-
-        default:
-          SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                         CURRENT_FUNCTION);
-          break;
-
-      }
+      geometry->PackP2PBuffer(iMessage, &x[0], nVar, reverse);
 
       /*--- Launch the point-to-point MPI send for this message. ---*/
 
@@ -373,16 +294,9 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
   /*--- Local variables ---*/
 
-  unsigned short iVar;
-  unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
-
   int ind, source, iMessage, jRecv;
   SU2_MPI::Status status;
 
-  /*--- Set some local pointers to make access simpler. ---*/
-
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
-
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
 
@@ -407,71 +321,21 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
           jRecv = geometry->P2PRecv2Neighbor[source];
 
-          /*--- Get the offset for the start of this message. ---*/
-
-          msg_offset = geometry->nPoint_P2PRecv[jRecv];
-
-          /*--- Get the number of packets to be received in this message. ---*/
-
-          nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
-                   geometry->nPoint_P2PRecv[jRecv]);
-
-          for (iRecv = 0; iRecv < nRecv; iRecv++) {
-
-            /*--- Get the local index for this communicated data. ---*/
+          /*--- Store the data of the recv points. ---*/
 
-            iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
-
-            /*--- Compute the offset in the recv buffer for this point. ---*/
-
-            buf_offset = (msg_offset + iRecv)*geometry->countPerPoint;
-
-            /*--- Store the data correctly depending on the quantity. ---*/
-
-            for (iVar = 0; iVar < nVar; iVar++)
-              x[iPoint*nVar+iVar] = ActiveAssign<OtherType,su2double>(bufDRecv[buf_offset+iVar]);
-
-          }
+          geometry->UnpackP2PBuffer(jRecv, &x[0], nVar);
           break;
 
         case SOLUTION_MATRIXTRANS:
 
-          /*--- We are going to communicate in reverse, so we use the
-           send buffer for the recv instead. Also, all of the offsets
-           and counts are derived from the send data structures. ---*/
-
-          bufDRecv = geometry->bufD_P2PSend;
-
-          /*--- We know the offsets based on the source rank. ---*/
+          /*--- We are going to communicate in reverse, so the data is
+           received in the send buffer and accumulated on the send points. ---*/
 
           jRecv = geometry->P2PSend2Neighbor[source];
 
-          /*--- Get the offset for the start of this message. ---*/
-
-          msg_offset = geometry->nPoint_P2PSend[jRecv];
-
-          /*--- Get the number of packets to be received in this message. ---*/
-
-          nRecv = (geometry->nPoint_P2PSend[jRecv+1] -
-                   geometry->nPoint_P2PSend[jRecv]);
-
-          for (iRecv = 0; iRecv < nRecv; iRecv++) {
-
-            /*--- Get the local index for this communicated data. ---*/
-
-            iPoint = geometry->Local_Point_P2PSend[msg_offset + iRecv];
-
-            /*--- Compute the offset in the recv buffer for this point. ---*/
-
-            buf_offset = (msg_offset + iRecv)*geometry->countPerPoint;
-
-
-            for (iVar = 0; iVar < nVar; iVar++)
-              x[iPoint*nVar+iVar] += ActiveAssign<OtherType,su2double>(bufDRecv[buf_offset+iVar]);
-
-          }
-
+          geometry->UnpackP2PBuffer(jRecv, &x[0], nVar, true, true);
           break;
+
         default:
           SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
                          CURRENT_FUNCTION);
@@ -506,21 +370,18 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
       matrix[dia_ptr[iPoint]*nVar*nEqn + index] = 0.0;
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+template<class SizeType, class T>
+FORCEINLINE void gauss_elimination_kernel(const SizeType nVar, T* matrix, T* vec) {
+
+  /*--- The size is a template type to allow fully unrolled versions of
+   *    the kernel for the common block sizes, see BLOCK_SIZE_DISPATCH. ---*/
 
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
-#else
 #define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Transform system in Upper Matrix ---*/
   for (auto iVar = 1ul; iVar < nVar; iVar++) {
     for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
+      T weight = A(iVar,jVar) / A(jVar,jVar);
       for (auto kVar = jVar; kVar < nVar; kVar++)
         A(iVar,kVar) -= weight * A(jVar,kVar);
       vec[iVar] -= weight * vec[jVar];
@@ -528,47 +389,36 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   }
 
   /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
+  for (auto iVar = static_cast<unsigned long>(nVar); iVar > 0ul;) {
     iVar--; // unsigned type
     for (auto jVar = iVar+1; jVar < nVar; jVar++)
       vec[iVar] -= A(iVar,jVar) * vec[jVar];
     vec[iVar] /= A(iVar,iVar);
   }
 #undef A
-#endif
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
+template<class SizeType, class T>
+FORCEINLINE void matrix_inverse_kernel(const SizeType nVar, T* matrix, T* inverse) {
 
   /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
    We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
    the performance of both routines would suffer in both cases without the use of exotic templating.
    And so it feels reasonable to have some duplication here. ---*/
 
-  assert((matrix != inverse) && "Output cannot be the same as the input.");
-
+#define A(I,J) matrix[(I)*nVar+(J)]
 #define M(I,J) inverse[(I)*nVar+(J)]
 
   /*--- Initialize the inverse with the identity. ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     for (auto jVar = 0ul; jVar < nVar; jVar++)
-      M(iVar,jVar) = ScalarType(iVar==jVar);
-
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
-#else
-#define A(I,J) matrix[(I)*nVar+(J)]
+      M(iVar,jVar) = T(iVar==jVar);
 
   /*--- Transform system in Upper Matrix ---*/
   for (auto iVar = 1ul; iVar < nVar; iVar++) {
     for (auto jVar = 0ul; jVar < iVar; jVar++)
     {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
+      T weight = A(iVar,jVar) / A(jVar,jVar);
 
       for (auto kVar = jVar; kVar < nVar; kVar++)
         A(iVar,kVar) -= weight * A(jVar,kVar);
@@ -580,7 +430,7 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
   }
 
   /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
+  for (auto iVar = static_cast<unsigned long>(nVar); iVar > 0ul;) {
     iVar--; // unsigned type
     for (auto jVar = iVar+1; jVar < nVar; jVar++)
       for (auto kVar = 0ul; kVar < nVar; kVar++)
@@ -589,9 +439,40 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
     for (auto kVar = 0ul; kVar < nVar; kVar++)
       M(iVar,kVar) /= A(iVar,iVar);
   }
+#undef M
 #undef A
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
+#else
+  BLOCK_SIZE_DISPATCH(nVar, gauss_elimination_kernel(blockSize, matrix, vec))
+#endif
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
+
+  assert((matrix != inverse) && "Output cannot be the same as the input.");
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    for (auto jVar = 0ul; jVar < nVar; jVar++)
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar);
+
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
+#else
+  BLOCK_SIZE_DISPATCH(nVar, matrix_inverse_kernel(blockSize, matrix, inverse))
 #endif
-#undef M
 }
 
 template<class ScalarType>
@@ -611,8 +492,9 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
-                                        unsigned long row_i, ScalarType *prod) const {
+template<class OtherType>
+void CSysMatrix<ScalarType>::RowProduct(const CSysVector<OtherType> & vec,
+                                        unsigned long row_i, OtherType *prod) const {
   unsigned long iVar, index, col_j;
 
   for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
@@ -625,10 +507,11 @@ void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                  CGeometry *geometry, CConfig *config) const {
 
-  /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
+  /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
 #ifndef NDEBUG
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     SU2_OMP_MASTER
@@ -715,7 +598,8 @@ void CSysMatrix<ScalarType>::BuildJacobiPreconditioner(bool transpose) {
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                          CGeometry *geometry, CConfig *config) const {
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
@@ -844,7 +728,8 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                       CGeometry *geometry, CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
@@ -856,7 +741,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread+1];
 
-    ScalarType aux_vec[MAXNVAR];
+    OtherType aux_vec[MAXNVAR];
 
     /*--- Copy vector to then work on prod in place ---*/
 
@@ -905,7 +790,8 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                          CGeometry *geometry, CConfig *config) const {
 
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
@@ -925,7 +811,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
      *    This is NOT exactly equivalent to the MPI implementation on the same
      *    number of domains, for that we would need to define "thread-halos". ---*/
 
-    ScalarType low_prod[MAXNVAR];
+    OtherType low_prod[MAXNVAR];
 
     for (auto iPoint = begin; iPoint < end; ++iPoint) {
       auto idx = iPoint*nVar;
@@ -955,7 +841,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
      *    product should consider halo columns. ---*/
     const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
 
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+    OtherType up_prod[MAXNVAR], dia_prod[MAXNVAR];
 
     for (auto iPoint = row_end; iPoint > begin;) {
       iPoint--; // because of unsigned type
@@ -1145,7 +1031,8 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                           CGeometry *geometry, CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
@@ -1256,11 +1143,109 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
-                                             CSysVector<ScalarType> & res) const {
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+
+  /*--- The smoother of the finest level is damped block-Jacobi, the coarse levels
+   *    are built from the (owned part of the) matrix and the inverse diagonal. ---*/
+  BuildJacobiPreconditioner(false);
+  SU2_OMP_BARRIER
+
+  amg_hierarchy.Build(nVar, nPointDomain, row_ptr, col_ind, matrix, invM);
+}
+
+template<class ScalarType>
+template<class OtherType>
+void CSysMatrix<ScalarType>::AMGSmoothingSweep(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
+                                               CGeometry *geometry, CConfig *config) const {
+
+  /*--- The correction is stored before updating the solution (Jacobi, not Gauss-Seidel). ---*/
+  const ScalarType omega = amg_hierarchy.GetFineRelaxation();
+  ScalarType* corr = amg_hierarchy.GetFineResidual();
+
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    ScalarType aux_vec[MAXNVAR];
+    OtherType aux_vec[MAXNVAR], inv_res[MAXNVAR];
+    RowProduct(prod, iPoint, aux_vec);
+    VectorSubtraction(aux_vec, &vec[iPoint*nVar], aux_vec);
+    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), aux_vec, inv_res);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      corr[iPoint*nVar+iVar] = omega * inv_res[iVar];
+  }
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (unsigned long iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    prod[iVar] -= corr[iVar];
+
+  /*--- MPI Parallelization ---*/
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
+                                                      CGeometry *geometry, CConfig *config) const {
+
+  const auto nSweeps = CAlgebraicMultigrid<ScalarType>::NUM_SWEEPS;
+  const ScalarType omega = amg_hierarchy.GetFineRelaxation();
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- Pre-smoothing, the first sweep starts from 0, i.e. y = w * D^{-1} * x. ---*/
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      prod[iPoint*nVar+iVar] *= omega;
+  }
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+
+  for (auto iSweep = 1ul; iSweep < nSweeps; ++iSweep)
+    AMGSmoothingSweep(vec, prod, geometry, config);
+
+  /*--- Coarse grid correction, the residual (A*y-x) is restricted to the coarse levels. ---*/
+  ScalarType* res = amg_hierarchy.GetFineResidual();
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    OtherType aux_vec[MAXNVAR];
+    RowProduct(prod, iPoint, aux_vec);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      res[iPoint*nVar+iVar] = aux_vec[iVar] - vec[iPoint*nVar+iVar];
+  }
+
+  amg_hierarchy.CoarseGridCorrection(&prod[0]);
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Post-smoothing, same number of sweeps to keep the preconditioner symmetric. ---*/
+  for (auto iSweep = 0ul; iSweep < nSweeps; ++iSweep)
+    AMGSmoothingSweep(vec, prod, geometry, config);
+}
+
+template<class ScalarType>
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<OtherType> & sol, const CSysVector<OtherType> & f,
+                                             CSysVector<OtherType> & res) const {
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    OtherType aux_vec[MAXNVAR];
     RowProduct(sol, iPoint, aux_vec);
     VectorSubtraction(aux_vec, &f[iPoint*nVar], &res[iPoint*nVar]);
   }
@@ -1366,7 +1351,8 @@ void CSysMatrix<ScalarType>::BuildPastixPreconditioner(CGeometry *geometry, CCon
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                          CGeometry *geometry, CConfig *config) const {
 #ifdef HAVE_PASTIX
   SU2_OMP_BARRIER
@@ -1390,7 +1376,7 @@ void CSysMatrix<su2double>::BuildPastixPreconditioner(CGeometry *geometry, CConf
   SU2_OMP_MASTER
   SU2_MPI::Error("The PaStiX preconditioner is only available in CSysMatrix<passivedouble>", CURRENT_FUNCTION);
 }
-template<>
+template<> template<>
 void CSysMatrix<su2double>::ComputePastixPreconditioner(const CSysVector<su2double> & vec, CSysVector<su2double> & prod,
                                                         CGeometry *geometry, CConfig *config) const {
   SU2_OMP_MASTER
@@ -1398,21 +1384,65 @@ void CSysMatrix<su2double>::ComputePastixPreconditioner(const CSysVector<su2doub
 }
 #endif
 
+#ifdef USE_MIXED_PRECISION
+template<>
+void CSysMatrix<float>::BuildPastixPreconditioner(CGeometry *geometry, CConfig *config,
+                                                  unsigned short kind_fact, bool transposed) {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is only available in CSysMatrix<passivedouble>", CURRENT_FUNCTION);
+}
+template<> template<>
+void CSysMatrix<float>::ComputePastixPreconditioner(const CSysVector<passivedouble> & vec, CSysVector<passivedouble> & prod,
+                                                    CGeometry *geometry, CConfig *config) const {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is only available in CSysMatrix<passivedouble>", CURRENT_FUNCTION);
+}
+#endif
+
 /*--- Explicit instantiations ---*/
+
+/*--- Operations on vectors, for a matrix of type MATTYPE and vectors of type VECTYPE. ---*/
+#define INSTANTIATE_VECTOR_OPS(MATTYPE, VECTYPE)                                                                                       \
+template void CSysMatrix<MATTYPE>::InitiateComms(const CSysVector<VECTYPE>&, CGeometry*, CConfig*, unsigned short) const;              \
+template void CSysMatrix<MATTYPE>::CompleteComms(CSysVector<VECTYPE>&, CGeometry*, CConfig*, unsigned short) const;                    \
+template void CSysMatrix<MATTYPE>::EnforceSolutionAtNode(unsigned long, const VECTYPE*, CSysVector<VECTYPE>&);                         \
+template void CSysMatrix<MATTYPE>::MatrixVectorProduct(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&, CGeometry*, CConfig*) const;   \
+template void CSysMatrix<MATTYPE>::ComputeJacobiPreconditioner(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&,                       \
+                                                               CGeometry*, CConfig*) const;                                            \
+template void CSysMatrix<MATTYPE>::ComputeILUPreconditioner(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&,                          \
+                                                            CGeometry*, CConfig*) const;                                               \
+template void CSysMatrix<MATTYPE>::ComputeLU_SGSPreconditioner(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&,                       \
+                                                               CGeometry*, CConfig*) const;                                            \
+template void CSysMatrix<MATTYPE>::ComputeLineletPreconditioner(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&,                      \
+                                                                CGeometry*, CConfig*) const;                                           \
+template void CSysMatrix<MATTYPE>::ComputeAMGPreconditioner(const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&,                          \
+                                                            CGeometry*, CConfig*) const;                                               \
+template void CSysMatrix<MATTYPE>::ComputeResidual(const CSysVector<VECTYPE>&, const CSysVector<VECTYPE>&, CSysVector<VECTYPE>&) const;
+
 template class CSysMatrix<su2double>;
-template void  CSysMatrix<su2double>::InitiateComms(const CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
-template void  CSysMatrix<su2double>::CompleteComms(CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
-template void  CSysMatrix<su2double>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
+INSTANTIATE_VECTOR_OPS(su2double, su2double)
 template void  CSysMatrix<su2double>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
+#ifndef CODI_REVERSE_TYPE
+template void  CSysMatrix<su2double>::ComputePastixPreconditioner(const CSysVector<su2double>&, CSysVector<su2double>&,
+                                                                  CGeometry*, CConfig*) const;
+#endif
 
 #ifdef CODI_REVERSE_TYPE
 template class CSysMatrix<passivedouble>;
-template void  CSysMatrix<passivedouble>::InitiateComms(const CSysVector<passivedouble>&, CGeometry*, CConfig*, unsigned short) const;
+INSTANTIATE_VECTOR_OPS(passivedouble, passivedouble)
 template void  CSysMatrix<passivedouble>::InitiateComms(const CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
-template void  CSysMatrix<passivedouble>::CompleteComms(CSysVector<passivedouble>&, CGeometry*, CConfig*, unsigned short) const;
 template void  CSysMatrix<passivedouble>::CompleteComms(CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
-template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, const passivedouble*, CSysVector<passivedouble>&);
 template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(passivedouble, const CSysMatrix<passivedouble>&);
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
+template void  CSysMatrix<passivedouble>::ComputePastixPreconditioner(const CSysVector<passivedouble>&, CSysVector<passivedouble>&,
+                                                                      CGeometry*, CConfig*) const;
+#endif
+
+#ifdef USE_MIXED_PRECISION
+/*--- Single precision matrix used with double precision vectors. ---*/
+template class CSysMatrix<float>;
+INSTANTIATE_VECTOR_OPS(float, passivedouble)
+template void  CSysMatrix<float>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
 #endif
+#undef INSTANTIATE_VECTOR_OPS
@@ -36,12 +36,17 @@
 #include "../../include/linear_algebra/CPreconditioner.hpp"
 
 #include <limits>
+#include <type_traits>
 
 const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief machine epsilon */
 
+/*--- Non-blocking reductions are only used for built-in types, AD types need the MPI wrapper of the AD tool. ---*/
+template<class T> struct UseNonBlockingReduction : is_same<T, passivedouble> {};
+
 template<class ScalarType>
 CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : cg_ready(false), bcg_ready(false),
-                                                                gmres_ready(false), smooth_ready(false) {
+                                                                gmres_ready(false), smooth_ready(false),
+                                                                pcg_ready(false) {
   mesh_deform = mesh_deform_mode;
   LinSysRes_ptr = nullptr;
   LinSysSol_ptr = nullptr;
@@ -156,6 +161,123 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg,
+                                                 vector<CSysVector<ScalarType> > & w) const {
+
+  /*--- Parameter for reorthonormalization, same as ModGramSchmidt. ---*/
+
+  const ScalarType reorth = 0.98;
+
+  /*--- Products of w[i+1] with w[0:i], and with itself, in one reduction. ---*/
+
+  vector<const VectorType*> a(i+2, &w[i+1]), b(i+2);
+  for (int k = 0; k < i+2; k++) b[k] = &w[k];
+
+  vector<ScalarType> prod(i+2);
+  ScalarType nrm = 0.0;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    StartDotProducts(i+2, a.data(), b.data());
+    FinishDotProducts(prod.data());
+
+    /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+    nrm = prod[i+1];
+    if ((nrm <= 0.0) || (nrm != nrm)) {
+      SU2_OMP_MASTER
+      SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+
+    /*--- Subtract the projections and update the norm. ---*/
+
+    ScalarType proj = 0.0;
+    for (int k = 0; k < i+1; k++) {
+      if (pass == 0) Hsbg[k][i] = prod[k];
+      else Hsbg[k][i] += prod[k];
+      w[i+1].Plus_AX(-prod[k], w[k]);
+      proj += prod[k]*prod[k];
+    }
+    nrm = max<ScalarType>(nrm - proj, 0.0);
+
+    /*--- The second pass is only needed if there was significant cancellation. ---*/
+
+    if (proj <= reorth*prod[i+1]) break;
+  }
+
+  /*--- Test the resulting vector ---*/
+
+  nrm = sqrt(nrm);
+  Hsbg[i+1][i] = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i+1] /= nrm;
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartDotProducts(unsigned long n, const VectorType* const* a, const VectorType* const* b) const {
+
+  /*--- All threads get the same view of the vectors, and of the shared buffers. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    dotLocal.assign(n, 0.0);
+    dotGlobal.resize(n);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Local dot products for each thread, added to the shared (rank) values. ---*/
+
+  const auto nElmDomain = a[0]->GetNElmDomain();
+  const auto chunkSize = computeStaticChunkSize(nElmDomain, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  for (auto k = 0ul; k < n; ++k) {
+    const VectorType& x = *a[k];
+    const VectorType& y = *b[k];
+    ScalarType sum = 0.0;
+
+    SU2_OMP(for schedule(static,chunkSize) nowait)
+    for (auto i = 0ul; i < nElmDomain; ++i)
+      sum += x[i]*y[i];
+
+    atomicAdd(sum, dotLocal[k]);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Only the master thread communicates, the other threads do not wait for the reduction. ---*/
+
+  SU2_OMP_MASTER
+  {
+#ifdef HAVE_MPI
+    if (UseNonBlockingReduction<ScalarType>::value)
+      CBaseMPIWrapper::Iallreduce(dotLocal.data(), dotGlobal.data(), n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &dotRequest);
+    else
+      SelectMPIWrapper<ScalarType>::W::Allreduce(dotLocal.data(), dotGlobal.data(), n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+    dotGlobal = dotLocal;
+#endif
+  }
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::FinishDotProducts(ScalarType* res) const {
+
+#ifdef HAVE_MPI
+  SU2_OMP_MASTER
+  {
+    if (UseNonBlockingReduction<ScalarType>::value)
+      CBaseMPIWrapper::Wait(&dotRequest, MPI_STATUS_IGNORE);
+  }
+#endif
+  SU2_OMP_BARRIER
+
+  for (auto k = 0ul; k < dotGlobal.size(); ++k) res[k] = dotGlobal[k];
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -325,10 +447,183 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedCG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                           const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                           ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, only one thread can
+   *    do this since the working vectors are shared. ---*/
+
+  if (!pcg_ready) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      u.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      w.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      q.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      s.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      Mw.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      AMw.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      pcg_ready = true;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  mat_vec(x, A_x);
+  r = b; r -= A_x;
+
+  /*--- Only compute the residuals in full communication mode. ---*/
+
+  if (config->GetComm_Level() == COMM_FULL) {
+
+    norm_r = r.norm();
+    norm0  = b.norm();
+    if ((norm_r < tol*norm0) || (norm_r < eps)) {
+      if (master) cout << "CSysSolve::PipelinedConjugateGradient(): system solved by initial guess." << endl;
+      return 0;
+    }
+
+    /*--- Set the norm to the initial initial residual value ---*/
+
+    norm0 = norm_r;
+
+    /*--- Output header information including initial residual ---*/
+
+    if ((monitoring) && (master)) {
+      WriteHeader("Pipelined CG", tol, norm_r);
+      WriteHistory(i, norm_r/norm0);
+    }
+
+  }
+
+  /*--- Preconditioned residual (u) and its product with the matrix (w). The recurrences below
+   *    keep z = A*q, q = M*s, s = A*p, the extra memory and vector updates, compared to CG, allow
+   *    the (single) reduction of each iteration to overlap with the preconditioner and product. ---*/
+
+  precond(r, u);
+  mat_vec(u, w);
+
+  ScalarType alpha = 0.0, alpha_old, beta, gamma = 0.0, gamma_old, delta;
+  ScalarType dots[3];
+  const VectorType* dotA[] = {&r, &w, &r};
+  const VectorType* dotB[] = {&u, &u, &r};
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Start the reduction of gamma = (r,u), delta = (w,u), and (r,r) ---*/
+
+    StartDotProducts(3, dotA, dotB);
+
+    /*--- Meanwhile, apply the preconditioner and the matrix to w ---*/
+
+    precond(w, Mw);
+    mat_vec(Mw, AMw);
+
+    FinishDotProducts(dots);
+
+    gamma_old = gamma;
+    gamma = dots[0];
+    delta = dots[1];
+
+    /*--- Only check the residual in full communication mode, for consistency with CG. ---*/
+
+    if (config->GetComm_Level() == COMM_FULL) {
+
+      /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+      norm_r = sqrt(dots[2]);
+      if (norm_r < tol*norm0) break;
+      if (((monitoring) && (master)) && (i > 0) && (i % 10 == 0))
+        WriteHistory(i, norm_r/norm0);
+
+    }
+
+    /*--- Calculate the step length alpha and the Gram-Schmidt coefficient beta ---*/
+
+    alpha_old = alpha;
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta*gamma/alpha_old);
+    }
+    else {
+      beta = 0.0;
+      alpha = gamma / delta;
+    }
+
+    /*--- Update the search direction and the auxiliary vectors ---*/
+
+    if (i > 0) {
+      z.Equals_AX_Plus_BY(1.0, AMw, beta, z);
+      q.Equals_AX_Plus_BY(1.0, Mw, beta, q);
+      s.Equals_AX_Plus_BY(1.0, w, beta, s);
+      p.Equals_AX_Plus_BY(1.0, u, beta, p);
+    }
+    else {
+      z = AMw; q = Mw; s = w; p = u;
+    }
+
+    /*--- Update solution, residual, and its preconditioned counterparts ---*/
+
+    x.Plus_AX(alpha, p);
+    r.Plus_AX(-alpha, s);
+    u.Plus_AX(-alpha, q);
+    w.Plus_AX(-alpha, z);
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("Pipelined CG", i, norm_r/norm0);
+
+    mat_vec(x, A_x);
+    r = b; r -= A_x;
+    ScalarType true_res = r.norm();
+
+    if (fabs(true_res - norm_r) > tol*10.0) {
+      if (master) {
+        WriteWarning(norm_r, true_res, tol);
+      }
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
-                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config,
+                                                      bool classical_gs) const {
 
   const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
 
@@ -426,9 +721,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     mat_vec(Z[i], W[i+1]);
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified (or single reduction classical) Gram-Schmidt orthogonalization ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (classical_gs) ClassicalGramSchmidt(i, H, W);
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -812,8 +1108,10 @@ void CSysSolve<passivedouble>::HandleTemporariesOut(CSysVector<su2double> & LinS
 #endif
 
 template<class ScalarType>
-unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
-                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
+template<class MatrixScalar>
+unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<MatrixScalar> & Jacobian, const CSysVector<su2double> & LinSysRes,
+                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config,
+                                           const ProductType* product) {
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -822,6 +1120,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
    Preconditioner (and therefore with the Matrix). Likewise for Solve_b (which is used by CSysSolve_b).
    There are no provisions here for active Matrix and passive Vectors as that makes no sense since we only handle the
    derivatives of the residual in CSysSolve_b.
+   The Matrix may however be of lower precision than the Vectors (mixed precision builds), in which case the
+   matrix-vector product and preconditioner operations of CSysMatrix are instantiated for the two types.
   ---*/
 
   unsigned short KindSolver, KindPrecond;
@@ -874,27 +1174,31 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  const auto jacobian_product = CSysMatrixVectorProduct<ScalarType,MatrixScalar>(Jacobian, geometry, config);
+  const ProductType& mat_vec = product? *product : jacobian_product;
   CPreconditioner<ScalarType>* precond = nullptr;
 
   switch (KindPrecond) {
     case JACOBI:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
+      precond = new CJacobiPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config, false);
       break;
     case ILU:
-      precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, false);
+      precond = new CILUPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config, false);
       break;
     case LU_SGS:
-      precond = new CLU_SGSPreconditioner<ScalarType>(Jacobian, geometry, config);
+      precond = new CLU_SGSPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config);
       break;
     case LINELET:
-      precond = new CLineletPreconditioner<ScalarType>(Jacobian, geometry, config);
+      precond = new CLineletPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config);
+      break;
+    case AMG:
+      precond = new CAMGPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config);
       break;
     case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
-      precond = new CPastixPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond, false);
+      precond = new CPastixPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config, KindPrecond, false);
       break;
     default:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
+      precond = new CJacobiPreconditioner<ScalarType,MatrixScalar>(Jacobian, geometry, config, false);
       break;
   }
 
@@ -914,9 +1218,15 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case CGS_FGMRES:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config, true);
+      break;
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       norm0 = LinSysRes_ptr->norm();
       while (IterLinSol < MaxIter) {
@@ -958,6 +1268,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     AD::SetExtFuncOut(&LinSysSol[0], (int)LinSysSol.GetLocSize());
 
 #ifdef CODI_REVERSE_TYPE
+    static_assert(is_same<ScalarType,MatrixScalar>::value, "Mixed precision is not compatible with the discrete adjoint.");
     AD::FuncHelper->addUserData(&LinSysRes);
     AD::FuncHelper->addUserData(&LinSysSol);
     AD::FuncHelper->addUserData(&Jacobian);
@@ -1035,6 +1346,11 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case JACOBI:
       precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
       break;
+    case AMG:
+      if (RequiresTranspose)
+        SU2_MPI::Error("The AMG preconditioner cannot be used for transposed systems.", CURRENT_FUNCTION);
+      precond = new CAMGPreconditioner<ScalarType>(Jacobian, geometry, config);
+      break;
     case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
       precond = new CPastixPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond, RequiresTranspose);
       break;
@@ -1050,12 +1366,18 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
+    case CGS_FGMRES:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config, true);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
       break;
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       Norm0 = LinSysRes_ptr->norm();
@@ -1087,8 +1409,20 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 }
 
 /*--- Explicit instantiations ---*/
+#define INSTANTIATE_SOLVE(VECTYPE, MATTYPE)                                                                 \
+template unsigned long CSysSolve<VECTYPE>::Solve(CSysMatrix<MATTYPE>&, const CSysVector<su2double>&,       \
+                                                 CSysVector<su2double>&, CGeometry*, CConfig*,             \
+                                                 const CMatrixVectorProduct<VECTYPE>*);
+
 template class CSysSolve<su2double>;
+INSTANTIATE_SOLVE(su2double, su2double)
 
 #ifdef CODI_REVERSE_TYPE
 template class CSysSolve<passivedouble>;
+INSTANTIATE_SOLVE(passivedouble, passivedouble)
+#endif
+
+#ifdef USE_MIXED_PRECISION
+INSTANTIATE_SOLVE(passivedouble, float)
 #endif
+#undef INSTANTIATE_SOLVE
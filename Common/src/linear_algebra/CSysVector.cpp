@@ -247,3 +247,8 @@ template class CSysVector<passivedouble>;
 template void CSysVector<su2double>::PassiveCopy(const CSysVector<passivedouble>&);
 template void CSysVector<passivedouble>::PassiveCopy(const CSysVector<su2double>&);
 #endif
+
+#ifdef USE_MIXED_PRECISION
+/*--- Needed by the transposed product of single precision matrices. ---*/
+template class CSysVector<float>;
+#endif
@@ -0,0 +1,284 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Compression of restart data (byte shuffle, quantization and LZ codec).
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace CompressionToolbox {
+
+namespace {
+
+/*--- Parameters of the LZ codec. Each sequence is a token (high nibble: number of
+ literals, low nibble: match length - MIN_MATCH, 15 means more length bytes follow),
+ the literals, and the match as a 2 byte offset back into the decoded data. The
+ last sequence has only literals. ---*/
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr int HASH_LOG = 16;
+
+/*--- Methods of the blocks, stored in their first byte. ---*/
+
+enum : unsigned char {SHUFFLED = 0, SHUFFLED_LZ = 1};
+
+inline uint32_t Read32(const unsigned char* p) {
+  uint32_t v; memcpy(&v, p, sizeof(v)); return v;
+}
+
+inline uint32_t Hash(uint32_t v) {
+  return (v * 2654435761u) >> (32 - HASH_LOG);
+}
+
+inline void WriteLength(size_t len, std::vector<unsigned char>& dst) {
+  for (len -= 15; len >= 255; len -= 255) dst.push_back(255);
+  dst.push_back(static_cast<unsigned char>(len));
+}
+
+inline bool ReadLength(const unsigned char*& ip, const unsigned char* iend, size_t& len) {
+  unsigned char b = 255;
+  while (b == 255) {
+    if (ip == iend) return false;
+    b = *ip++;
+    len += b;
+  }
+  return true;
+}
+
+void WriteSequence(const unsigned char* literals, size_t nLiteral, size_t offset,
+                   size_t matchLen, std::vector<unsigned char>& dst) {
+  const size_t m = (matchLen >= MIN_MATCH)? matchLen-MIN_MATCH : 0;
+  dst.push_back(static_cast<unsigned char>((std::min<size_t>(nLiteral,15) << 4) | std::min<size_t>(m,15)));
+  if (nLiteral >= 15) WriteLength(nLiteral, dst);
+  dst.insert(dst.end(), literals, literals+nLiteral);
+  if (matchLen == 0) return;
+  dst.push_back(static_cast<unsigned char>(offset & 0xff));
+  dst.push_back(static_cast<unsigned char>(offset >> 8));
+  if (m >= 15) WriteLength(m, dst);
+}
+
+/*--- Zig-zag mapping of signed to unsigned integers, small magnitudes give small values. ---*/
+
+inline uint64_t ZigZag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+
+inline int64_t UnZigZag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+}
+
+void LZCompress(const unsigned char* src, size_t srcSize, std::vector<unsigned char>& dst) {
+
+  dst.clear();
+  dst.reserve(srcSize + srcSize/255 + 16);
+
+  /*--- Last position (+1) where each hash of 4 bytes was seen, 0 for none. ---*/
+  std::vector<size_t> table(size_t(1) << HASH_LOG, 0);
+
+  size_t anchor = 0, i = 0;
+
+  while (i + MIN_MATCH <= srcSize) {
+    const uint32_t seq = Read32(src+i);
+    const uint32_t h = Hash(seq);
+    const size_t cand = table[h];
+    table[h] = i+1;
+
+    if (cand && (i-(cand-1) <= MAX_OFFSET) && (Read32(src+cand-1) == seq)) {
+      const size_t ref = cand-1;
+      size_t len = MIN_MATCH;
+      while ((i+len < srcSize) && (src[ref+len] == src[i+len])) ++len;
+
+      WriteSequence(src+anchor, i-anchor, i-ref, len, dst);
+      i += len;
+      anchor = i;
+    }
+    else {
+      ++i;
+    }
+  }
+
+  /*--- Remaining literals. ---*/
+  WriteSequence(src+anchor, srcSize-anchor, 0, 0, dst);
+}
+
+bool LZDecompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize) {
+
+  const unsigned char* ip = src;
+  const unsigned char* const iend = src + srcSize;
+  size_t op = 0;
+
+  while (ip < iend) {
+    const unsigned char token = *ip++;
+
+    size_t nLiteral = token >> 4;
+    if (nLiteral == 15 && !ReadLength(ip, iend, nLiteral)) return false;
+    if ((nLiteral > size_t(iend-ip)) || (nLiteral > dstSize-op)) return false;
+    memcpy(dst+op, ip, nLiteral);
+    ip += nLiteral;
+    op += nLiteral;
+
+    if (ip == iend) break;
+
+    if (iend-ip < 2) return false;
+    const size_t offset = ip[0] | (size_t(ip[1]) << 8);
+    ip += 2;
+    size_t matchLen = token & 15;
+    if (matchLen == 15 && !ReadLength(ip, iend, matchLen)) return false;
+    matchLen += MIN_MATCH;
+    if ((offset == 0) || (offset > op) || (matchLen > dstSize-op)) return false;
+
+    /*--- The match may overlap the output (repeated patterns), copy byte by byte. ---*/
+    for (size_t k = 0; k < matchLen; ++k, ++op) dst[op] = dst[op-offset];
+  }
+  return op == dstSize;
+}
+
+uint64_t Checksum(const unsigned char* src, size_t size) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= src[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+void EncodeBlock(const passivedouble* data, unsigned long nPoint, unsigned long nVar,
+                 const passivedouble* errorBound, std::vector<unsigned char>& block,
+                 const passivedouble* reference) {
+
+  constexpr size_t WORD = sizeof(uint64_t);
+  static_assert(sizeof(passivedouble) == WORD, "Restart data must be 64-bit.");
+
+  const size_t fieldSize = nPoint*WORD;
+  std::vector<unsigned char> shuffled(nVar*fieldSize);
+  std::vector<uint64_t> words(nPoint);
+
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+
+    /*--- Lossy fields are quantized to multiples of twice the error bound, and the
+     differences between consecutive points (or w.r.t. the reference) are stored, which
+     are small integers for smooth fields. The bits of lossless fields are stored as
+     they are, or XOR'ed with those of the reference. ---*/
+
+    if (errorBound[iVar] > 0.0) {
+      const passivedouble scale = 0.5/errorBound[iVar];
+      int64_t prev = 0;
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        const int64_t q = llround(data[iPoint*nVar+iVar]*scale);
+        if (reference) prev = llround(reference[iPoint*nVar+iVar]*scale);
+        words[iPoint] = ZigZag(q-prev);
+        prev = q;
+      }
+    }
+    else {
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        memcpy(&words[iPoint], &data[iPoint*nVar+iVar], WORD);
+        if (reference) {
+          uint64_t ref;
+          memcpy(&ref, &reference[iPoint*nVar+iVar], WORD);
+          words[iPoint] ^= ref;
+        }
+      }
+    }
+
+    /*--- Byte shuffle, the k-th bytes of all points are stored together. ---*/
+
+    unsigned char* field = shuffled.data() + iVar*fieldSize;
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      unsigned char bytes[WORD];
+      memcpy(bytes, &words[iPoint], WORD);
+      for (size_t k = 0; k < WORD; ++k) field[k*nPoint+iPoint] = bytes[k];
+    }
+  }
+
+  LZCompress(shuffled.data(), shuffled.size(), block);
+
+  /*--- Incompressible data is stored without the LZ stage. ---*/
+
+  if (block.size() < shuffled.size()) {
+    block.insert(block.begin(), SHUFFLED_LZ);
+  }
+  else {
+    block.resize(1);
+    block[0] = SHUFFLED;
+    block.insert(block.end(), shuffled.begin(), shuffled.end());
+  }
+}
+
+bool DecodeBlock(const unsigned char* block, size_t blockSize, unsigned long nPoint, unsigned long nVar,
+                 const passivedouble* errorBound, passivedouble* data, const passivedouble* reference) {
+
+  constexpr size_t WORD = sizeof(uint64_t);
+  const size_t fieldSize = nPoint*WORD;
+
+  if (blockSize < 1) return false;
+
+  std::vector<unsigned char> shuffled(nVar*fieldSize);
+
+  switch (block[0]) {
+    case SHUFFLED:
+      if (blockSize-1 != shuffled.size()) return false;
+      memcpy(shuffled.data(), block+1, shuffled.size());
+      break;
+    case SHUFFLED_LZ:
+      if (!LZDecompress(block+1, blockSize-1, shuffled.data(), shuffled.size())) return false;
+      break;
+    default:
+      return false;
+  }
+
+  for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+    const unsigned char* field = shuffled.data() + iVar*fieldSize;
+    const passivedouble step = 2.0*errorBound[iVar];
+    const passivedouble scale = (step > 0.0)? 1.0/step : 0.0;
+    int64_t q = 0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      unsigned char bytes[WORD];
+      for (size_t k = 0; k < WORD; ++k) bytes[k] = field[k*nPoint+iPoint];
+      uint64_t word;
+      memcpy(&word, bytes, WORD);
+
+      if (errorBound[iVar] > 0.0) {
+        if (reference) q = llround(reference[iPoint*nVar+iVar]*scale);
+        q += UnZigZag(word);
+        data[iPoint*nVar+iVar] = q*step;
+      }
+      else {
+        if (reference) {
+          uint64_t ref;
+          memcpy(&ref, &reference[iPoint*nVar+iVar], WORD);
+          word ^= ref;
+        }
+        memcpy(&data[iPoint*nVar+iVar], &word, WORD);
+      }
+    }
+  }
+  return true;
+}
+
+}
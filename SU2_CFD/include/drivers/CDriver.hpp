@@ -139,8 +139,9 @@ protected:
 
   /*!
    * \brief Construction of the edge-based data structure and the multigrid structure.
+   * \param[in] geometry_aux - Grid in linear partitions, already colored, to use instead of the grid file (FVM only, deleted).
    */
-  void Geometrical_Preprocessing(CConfig *config, CGeometry **&geometry, bool dummy);
+  void Geometrical_Preprocessing(CConfig *config, CGeometry **&geometry, bool dummy, CGeometry *geometry_aux = nullptr);
 
   /*!
    * \brief Do the geometrical preprocessing for the DG FEM solver.
@@ -149,8 +150,9 @@ protected:
 
   /*!
    * \brief Geometrical_Preprocessing_FVM
+   * \param[in] geometry_aux - Grid in linear partitions, already colored, by default it is read and colored here (deleted).
    */
-  void Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry);
+  void Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry, CGeometry *geometry_aux = nullptr);
 
   /*!
    * \brief Definition of the physics iteration class or within a single zone.
@@ -251,6 +253,15 @@ protected:
    */
   void StaticMesh_Preprocessing(CConfig *config, CGeometry **geometry, CSurfaceMovement *surface_movement);
 
+  /*!
+   * \brief Repartition the grid of a single zone problem at runtime (LOAD_REBALANCE), the geometry, solvers,
+   *        numerics and integration of the zone are rebuilt on the new partition and the solution is moved to it.
+   * \note The new partition is an adaptive repartitioning (ParMETIS) of the current one, the work of the points
+   *       is scaled by the measured time of their current rank. Only for FVM flow problems without multigrid.
+   * \param[in] rankTime - Time of the residual computations of each rank with the current partition.
+   */
+  void Repartition(const vector<passivedouble>& rankTime);
+
   /*!
    * \brief Initiate value for static mesh movement such as the gridVel for the ROTATING frame.
    */
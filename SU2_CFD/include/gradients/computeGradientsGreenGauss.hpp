@@ -30,50 +30,16 @@
 #include "../../../Common/include/omp_structure.hpp"
 
 
-/*!
- * \brief Compute the gradient of a field using the Green-Gauss theorem.
- * \note Gradients can be computed only for a contiguous range of variables, defined
- *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
- *       This can be used, for example, to compute only velocity gradients.
- * \note The function uses an optional solver object to perform communications, if
- *       none (nullptr) is provided the function does not fail (the objective of
- *       this is to improve test-ability).
- * \param[in] solver - Optional, solver associated with the field (used only for MPI).
- * \param[in] kindMpiComm - Type of MPI communication required.
- * \param[in] kindPeriodicComm - Type of periodic communication required.
- * \param[in] geometry - Geometric grid properties.
- * \param[in] config - Configuration of the problem, used to identify types of boundaries.
- * \param[in] field - Generic object implementing operator (iPoint, iVar).
- * \param[in] varBegin - Index of first variable for which to compute the gradient.
- * \param[in] varEnd - Index of last variable for which to compute the gradient.
- * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
- */
-template<class FieldType, class GradientType>
-void computeGradientsGreenGauss(CSolver* solver,
-                                MPI_QUANTITIES kindMpiComm,
-                                PERIODIC_QUANTITIES kindPeriodicComm,
-                                CGeometry& geometry,
-                                CConfig& config,
-                                const FieldType& field,
-                                size_t varBegin,
-                                size_t varEnd,
-                                GradientType& gradient)
+namespace GreenGaussHelpers
 {
-  size_t nPointDomain = geometry.GetnPointDomain();
-  size_t nDim = geometry.GetnDim();
-
-#ifdef HAVE_OMP
-  constexpr size_t OMP_MAX_CHUNK = 512;
-
-  size_t chunkSize = computeStaticChunkSize(nPointDomain,
-                     omp_get_max_threads(), OMP_MAX_CHUNK);
-#endif
-
-  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
-
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  /*!
+   * \brief Integrate over the faces (edges) of the volume of an owned point, this sets its gradient.
+   */
+  template<class FieldType, class GradientType>
+  inline void interiorFluxes(CGeometry& geometry, const FieldType& field, size_t varBegin,
+                             size_t varEnd, GradientType& gradient, size_t iPoint)
   {
+    size_t nDim = geometry.GetnDim();
     auto node = geometry.node[iPoint];
 
     AD::StartPreacc();
@@ -128,12 +94,92 @@ void computeGradientsGreenGauss(CSolver* solver,
     AD::EndPreacc();
   }
 
+  /*!
+   * \brief Add the flux through a boundary face (vertex) to the gradient of its (owned) point.
+   */
+  template<class FieldType, class GradientType>
+  inline void boundaryFlux(CGeometry& geometry, const FieldType& field, size_t varBegin,
+                           size_t varEnd, GradientType& gradient, size_t iMarker, size_t iVertex)
+  {
+    size_t nDim = geometry.GetnDim();
+    size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+    auto node = geometry.node[iPoint];
+
+    su2double volume = node->GetVolume() + node->GetPeriodicVolume();
+
+    const su2double* area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+    for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+    {
+      su2double flux = field(iPoint,iVar) / volume;
+
+      for (size_t iDim = 0; iDim < nDim; iDim++)
+        gradient(iPoint, iVar, iDim) -= flux * area[iDim];
+    }
+  }
+
+  /*!
+   * \brief Whether the boundary fluxes of a marker are part of the gradient.
+   */
+  inline bool boundaryMarker(const CConfig& config, size_t iMarker)
+  {
+    return (config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+           (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY);
+  }
+}
+
+/*!
+ * \brief Compute the gradient of a field using the Green-Gauss theorem.
+ * \note Gradients can be computed only for a contiguous range of variables, defined
+ *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
+ *       This can be used, for example, to compute only velocity gradients.
+ * \note The function uses an optional solver object to perform communications, if
+ *       none (nullptr) is provided the function does not fail (the objective of
+ *       this is to improve test-ability).
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] kindPeriodicComm - Type of periodic communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] mpiComms - If false only the periodic communications are performed, the caller
+ *            is then responsible for the exchange of halo gradients with other ranks.
+ */
+template<class FieldType, class GradientType>
+void computeGradientsGreenGauss(CSolver* solver,
+                                MPI_QUANTITIES kindMpiComm,
+                                PERIODIC_QUANTITIES kindPeriodicComm,
+                                CGeometry& geometry,
+                                CConfig& config,
+                                const FieldType& field,
+                                size_t varBegin,
+                                size_t varEnd,
+                                GradientType& gradient,
+                                bool mpiComms = true)
+{
+  size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    GreenGaussHelpers::interiorFluxes(geometry, field, varBegin, varEnd, gradient, iPoint);
+
   /*--- Add boundary fluxes. ---*/
 
   for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
   {
-    if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-        (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+    if (GreenGaussHelpers::boundaryMarker(config, iMarker))
     {
       /*--- Work is shared in inner loop as two markers
        *    may try to update the same point. ---*/
@@ -142,23 +188,12 @@ void computeGradientsGreenGauss(CSolver* solver,
       for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
       {
         size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
-        auto node = geometry.node[iPoint];
 
         /*--- Halo points do not need to be considered. ---*/
 
-        if (!node->GetDomain()) continue;
-
-        su2double volume = node->GetVolume() + node->GetPeriodicVolume();
-
-        const su2double* area = geometry.vertex[iMarker][iVertex]->GetNormal();
-
-        for (size_t iVar = varBegin; iVar < varEnd; iVar++)
-        {
-          su2double flux = field(iPoint,iVar) / volume;
+        if (!geometry.node[iPoint]->GetDomain()) continue;
 
-          for (size_t iDim = 0; iDim < nDim; iDim++)
-            gradient(iPoint, iVar, iDim) -= flux * area[iDim];
-        }
+        GreenGaussHelpers::boundaryFlux(geometry, field, varBegin, varEnd, gradient, iMarker, iVertex);
       }
     }
   }
@@ -178,9 +213,53 @@ void computeGradientsGreenGauss(CSolver* solver,
 
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (mpiComms) {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
   }
   SU2_OMP_BARRIER
 
 }
+
+/*!
+ * \brief Compute the Green-Gauss gradients of the owned points in [pointBegin, pointEnd[,
+ *        sequentially, e.g. in an OpenMP task. The result is the same as that of the
+ *        function above, without the periodic and MPI communications.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] pointBegin - First point of the range.
+ * \param[in] pointEnd - End of the range (at most the number of owned points).
+ */
+template<class FieldType, class GradientType>
+void computeGradientsGreenGaussRange(CGeometry& geometry,
+                                     const CConfig& config,
+                                     const FieldType& field,
+                                     size_t varBegin,
+                                     size_t varEnd,
+                                     GradientType& gradient,
+                                     size_t pointBegin,
+                                     size_t pointEnd)
+{
+  for (size_t iPoint = pointBegin; iPoint < pointEnd; ++iPoint)
+  {
+    GreenGaussHelpers::interiorFluxes(geometry, field, varBegin, varEnd, gradient, iPoint);
+
+    /*--- Boundary fluxes, in the order of the markers. ---*/
+
+    auto node = geometry.node[iPoint];
+    if (!node->GetBoundary()) continue;
+
+    for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+    {
+      long iVertex = node->GetVertex(iMarker);
+
+      if ((iVertex >= 0) && GreenGaussHelpers::boundaryMarker(config, iMarker))
+        GreenGaussHelpers::boundaryFlux(geometry, field, varBegin, varEnd, gradient, iMarker, iVertex);
+    }
+  }
+}
@@ -29,52 +29,19 @@
 #include "../../../Common/include/omp_structure.hpp"
 
 
-/*!
- * \brief Compute the gradient of a field using inverse-distance-weighted or
- *        unweighted Least-Squares approximation.
- * \note See notes from computeGradientsGreenGauss.hpp.
- * \param[in] solver - Optional, solver associated with the field (used only for MPI).
- * \param[in] kindMpiComm - Type of MPI communication required.
- * \param[in] kindPeriodicComm - Type of periodic communication required.
- * \param[in] geometry - Geometric grid properties.
- * \param[in] weighted - Use inverse-distance weights.
- * \param[in] config - Configuration of the problem, used to identify types of boundaries.
- * \param[in] field - Generic object implementing operator (iPoint, iVar).
- * \param[in] varBegin - Index of first variable for which to compute the gradient.
- * \param[in] varEnd - Index of last variable for which to compute the gradient.
- * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
- * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
- */
-template<class FieldType, class GradientType, class RMatrixType>
-void computeGradientsLeastSquares(CSolver* solver,
-                                  MPI_QUANTITIES kindMpiComm,
-                                  PERIODIC_QUANTITIES kindPeriodicComm,
-                                  CGeometry& geometry,
-                                  CConfig& config,
-                                  bool weighted,
-                                  const FieldType& field,
-                                  size_t varBegin,
-                                  size_t varEnd,
-                                  GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+namespace LeastSquaresHelpers
 {
   constexpr size_t MAXNDIM = 3;
 
-  size_t nPointDomain = geometry.GetnPointDomain();
-  size_t nDim = geometry.GetnDim();
-
-#ifdef HAVE_OMP
-  constexpr size_t OMP_MAX_CHUNK = 512;
-
-  size_t chunkSize = computeStaticChunkSize(nPointDomain,
-                     omp_get_max_threads(), OMP_MAX_CHUNK);
-#endif
-
-  /*--- First loop over non-halo points of the grid. ---*/
-
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  /*!
+   * \brief Sums over the neighbors of an owned point, the entries of R and of c:= transpose(A)*b.
+   */
+  template<class FieldType, class GradientType, class RMatrixType>
+  inline void pointSums(CGeometry& geometry, bool weighted, const FieldType& field, size_t varBegin,
+                        size_t varEnd, GradientType& gradient, RMatrixType& Rmatrix, size_t iPoint)
   {
+    size_t nDim = geometry.GetnDim();
+
     auto node = geometry.node[iPoint];
     const su2double* coord_i = node->GetCoord();
 
@@ -163,23 +130,12 @@ void computeGradientsLeastSquares(CSolver* solver,
     AD::EndPreacc();
   }
 
-  /*--- Correct the gradient values across any periodic boundaries. ---*/
-
-  SU2_OMP_MASTER
-  if (solver != nullptr)
-  {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    }
-  }
-  SU2_OMP_BARRIER
-
-  /*--- Second loop over points of the grid to compute final gradient. ---*/
-
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  /*!
+   * \brief Solve the least squares problem of an owned point, the gradient is set from the sums.
+   */
+  template<class GradientType, class RMatrixType>
+  inline void pointSolve(size_t nDim, size_t varBegin, size_t varEnd, GradientType& gradient,
+                         const RMatrixType& Rmatrix, size_t iPoint)
   {
     /*--- Entries of upper triangular matrix R. ---*/
 
@@ -294,6 +250,74 @@ void computeGradientsLeastSquares(CSolver* solver,
         gradient(iPoint, iVar, iDim) = Cvector[iDim];
     }
   }
+}
+
+/*!
+ * \brief Compute the gradient of a field using inverse-distance-weighted or
+ *        unweighted Least-Squares approximation.
+ * \note See notes from computeGradientsGreenGauss.hpp.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required.
+ * \param[in] kindPeriodicComm - Type of periodic communication required.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in] mpiComms - If false only the periodic communications are performed, the caller
+ *            is then responsible for the exchange of halo gradients with other ranks.
+ */
+template<class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquares(CSolver* solver,
+                                  MPI_QUANTITIES kindMpiComm,
+                                  PERIODIC_QUANTITIES kindPeriodicComm,
+                                  CGeometry& geometry,
+                                  CConfig& config,
+                                  bool weighted,
+                                  const FieldType& field,
+                                  size_t varBegin,
+                                  size_t varEnd,
+                                  GradientType& gradient,
+                                  RMatrixType& Rmatrix,
+                                  bool mpiComms = true)
+{
+  size_t nPointDomain = geometry.GetnPointDomain();
+  size_t nDim = geometry.GetnDim();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- First loop over non-halo points of the grid. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    LeastSquaresHelpers::pointSums(geometry, weighted, field, varBegin, varEnd, gradient, Rmatrix, iPoint);
+
+  /*--- Correct the gradient values across any periodic boundaries. ---*/
+
+  SU2_OMP_MASTER
+  if (solver != nullptr)
+  {
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+    {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Second loop over points of the grid to compute final gradient. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    LeastSquaresHelpers::pointSolve(nDim, varBegin, varEnd, gradient, Rmatrix, iPoint);
 
   /*--- If no solver was provided we do not communicate ---*/
 
@@ -302,9 +326,43 @@ void computeGradientsLeastSquares(CSolver* solver,
   {
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (mpiComms) {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
   }
   SU2_OMP_BARRIER
 
 }
+
+/*!
+ * \brief Compute the least-squares gradients of the owned points in [pointBegin, pointEnd[,
+ *        sequentially, e.g. in an OpenMP task. The result is the same as that of the
+ *        function above, without the periodic and MPI communications.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in] pointBegin - First point of the range.
+ * \param[in] pointEnd - End of the range (at most the number of owned points).
+ */
+template<class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquaresRange(CGeometry& geometry,
+                                       bool weighted,
+                                       const FieldType& field,
+                                       size_t varBegin,
+                                       size_t varEnd,
+                                       GradientType& gradient,
+                                       RMatrixType& Rmatrix,
+                                       size_t pointBegin,
+                                       size_t pointEnd)
+{
+  for (size_t iPoint = pointBegin; iPoint < pointEnd; ++iPoint)
+  {
+    LeastSquaresHelpers::pointSums(geometry, weighted, field, varBegin, varEnd, gradient, Rmatrix, iPoint);
+    LeastSquaresHelpers::pointSolve(geometry.GetnDim(), varBegin, varEnd, gradient, Rmatrix, iPoint);
+  }
+}
@@ -50,6 +50,7 @@ protected:
   bool Convergence,   /*!< \brief To indicate if the flow solver (direct, adjoint, or linearized) has converged or not. */
   Convergence_FSI,    /*!< \brief To indicate if the FSI problem has converged or not. */
   Convergence_FullMG;  /*!< \brief Initial value of the residual to evaluate the convergence level. */
+  passivedouble ResidualTime = 0.0;  /*!< \brief Time spent by this rank in the residual computations that do not communicate. */
 
   /*!
    * \brief Do the space integration of the numerical system.
@@ -65,6 +66,35 @@ protected:
                          CConfig *config, unsigned short iMesh, unsigned short iRKStep,
                          unsigned short RunTime_EqSystem);
 
+  /*!
+   * \brief Compute the weak boundary condition of a marker.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the convective numerical method (boundary term).
+   * \param[in] visc_numerics - Description of the viscous numerical method (boundary term).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] MainSolver - Position of the solver in the container.
+   * \param[in] iMarker - Index of the marker.
+   */
+  void Weak_BC(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+               CNumerics *visc_numerics, CConfig *config, unsigned short MainSolver,
+               unsigned short iMarker) const;
+
+  /*!
+   * \brief Compute the weak boundary conditions of all markers, the markers whose boundary conditions are
+   *        task-safe (see CSolver::GetBC_TaskSafe) are computed as OpenMP tasks, by all threads, color by
+   *        color (see CGeometry::GetMarkerColoring), the other markers of each color are computed by the
+   *        calling (master) thread, while the tasks execute.
+   * \note Called by the master thread, the other threads execute tasks while waiting at the next barrier.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method (all threads).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] MainSolver - Position of the solver in the container.
+   */
+  void Weak_BC_Tasks(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                     CConfig *config, unsigned short MainSolver) const;
+
   /*!
    * \brief Do the time integration (explicit or implicit) of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -124,6 +154,16 @@ public:
    */
   inline bool GetConvergence_FullMG(void) const { return Convergence_FullMG; }
 
+  /*!
+   * \brief Get the time spent by this rank in the residual computations that do not communicate (see Space_Integration).
+   */
+  inline passivedouble GetResidualTime(void) const { return ResidualTime; }
+
+  /*!
+   * \brief Set the time spent by this rank in the residual computations (e.g. to reset it).
+   */
+  inline void SetResidualTime(passivedouble value) { ResidualTime = value; }
+
   /*!
    * \brief Save the solution, and volume at different time steps.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <ctime>
+#include <functional>
 
 #include "../../Common/include/mpi_structure.hpp"
 #include "../../Common/include/geometry/CGeometry.hpp"
@@ -58,6 +59,10 @@ protected:
             StopTime,
             UsedTime;
 
+  unsigned long nIter_LoadBalance = 0;  /*!< \brief Number of iterations since the last load balance check. */
+  vector<passivedouble> rankResidualTime;  /*!< \brief Residual time of each rank, when a repartition is pending. */
+  std::function<void(const vector<passivedouble>&)> Repartition;  /*!< \brief Repartitions the grid (LOAD_REBALANCE). */
+
 public:
 
   /*!
@@ -101,6 +106,23 @@ public:
                            CConfig *config_container,
                            unsigned short kind_recording);
 
+  /*!
+   * \brief Measure the load imbalance of the residual computations every LOAD_IMBALANCE_FREQ calls
+   *        (collective), and warn if it is above LOAD_IMBALANCE_THRESHOLD, or request a repartition
+   *        of the grid at the end of the iteration (LOAD_REBALANCE, see SetRepartition).
+   * \note The imbalance is the time of the slowest rank relative to the average time (see
+   *       CIntegration::GetResidualTime). Only the computations that do not communicate are measured.
+   * \param[in] integration - Container vector with the integration methods of the zone and instance.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CheckLoadBalance(CIntegration **integration, const CConfig *config);
+
+  /*!
+   * \brief Set the function that repartitions the grid and moves the problem to the new partition (LOAD_REBALANCE).
+   * \param[in] repartition - Function of the residual time of each rank, called between inner iterations.
+   */
+  inline void SetRepartition(std::function<void(const vector<passivedouble>&)> repartition) { Repartition = repartition; }
+
   /*!
    * \brief A virtual member.
    * \param[in] ??? - Description here.
@@ -48,12 +48,13 @@ void computeLimiters(ENUM_LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     bool mpiComms = true)
 {
 #define INSTANTIATE(KIND) \
 computeLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiComm, \
   kindPeriodicComm1, kindPeriodicComm2, geometry, config, varBegin, \
-  varEnd, field, gradient, fieldMin, fieldMax, limiter)
+  varEnd, field, gradient, fieldMin, fieldMax, limiter, mpiComms)
 
   switch (LimiterKind) {
     case NO_LIMITER:
@@ -97,3 +98,50 @@ computeLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiComm, \
   }
 #undef INSTANTIATE
 }
+
+/*!
+ * \brief Prepare the computation of limiters for ranges of owned points, which can then be done
+ *        sequentially, e.g. in OpenMP tasks. The arguments are those of "computeLimiters".
+ * \note The preprocessing of some limiters is collective, all threads (and ranks) must call this
+ *       function. The function it returns does not perform periodic or MPI communications.
+ * \return Function that computes the limiters of the owned points in [pointBegin, pointEnd[.
+ */
+template<class FieldType, class GradientType>
+std::function<void(size_t,size_t)> computeLimitersRange(ENUM_LIMITER LimiterKind,
+                                                        CGeometry& geometry,
+                                                        CConfig& config,
+                                                        size_t varBegin,
+                                                        size_t varEnd,
+                                                        const FieldType& field,
+                                                        const GradientType& gradient,
+                                                        FieldType& fieldMin,
+                                                        FieldType& fieldMax,
+                                                        FieldType& limiter)
+{
+#define INSTANTIATE(KIND) \
+computeLimitersRange_impl<FieldType, GradientType, KIND>(geometry, config, \
+  varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter)
+
+  switch (LimiterKind) {
+    case NO_LIMITER:
+      return [=, &limiter](size_t pointBegin, size_t pointEnd) {
+        for(size_t iPoint = pointBegin; iPoint < pointEnd; ++iPoint)
+          for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+            limiter(iPoint, iVar) = 1.0;
+      };
+    case BARTH_JESPERSEN:
+      return INSTANTIATE(BARTH_JESPERSEN);
+    case VENKATAKRISHNAN:
+      return INSTANTIATE(VENKATAKRISHNAN);
+    case VENKATAKRISHNAN_WANG:
+      return INSTANTIATE(VENKATAKRISHNAN_WANG);
+    case WALL_DISTANCE:
+      return INSTANTIATE(WALL_DISTANCE);
+    case SHARP_EDGES:
+      return INSTANTIATE(SHARP_EDGES);
+    default:
+      SU2_MPI::Error("Unknown limiter type.", CURRENT_FUNCTION);
+      return nullptr;
+  }
+#undef INSTANTIATE
+}
@@ -27,6 +27,125 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <functional>
+
+
+namespace LimiterHelpers
+{
+  constexpr size_t MAXNDIM = 3;
+  constexpr size_t MAXNVAR = 8;
+
+  /*!
+   * \brief Compute the limiters of an owned point, see computeLimiters_impl for the arguments.
+   * \param[in] initMinMax - Initialize the min/max field values of the point, false if the
+   *            periodic communications already did that.
+   * \param[in] iPoint - The point.
+   */
+  template<class FieldType, class GradientType, class LimiterDetails>
+  inline void pointLimiter(const LimiterDetails& limiterDetails,
+                           CGeometry& geometry,
+                           size_t varBegin,
+                           size_t varEnd,
+                           bool initMinMax,
+                           const FieldType& field,
+                           const GradientType& gradient,
+                           FieldType& fieldMin,
+                           FieldType& fieldMax,
+                           FieldType& limiter,
+                           size_t iPoint)
+  {
+    size_t nDim = geometry.GetnDim();
+
+    auto node = geometry.node[iPoint];
+    const su2double* coord_i = node->GetCoord();
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(coord_i, nDim);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(iPoint,iVar));
+
+      if (!initMinMax) {
+        /*--- Started outside loop, so counts as input. ---*/
+        AD::SetPreaccIn(fieldMax(iPoint,iVar));
+        AD::SetPreaccIn(fieldMin(iPoint,iVar));
+      }
+      else {
+        /*--- Initialize min/max now for iPoint if not periodic. ---*/
+        fieldMax(iPoint,iVar) = field(iPoint,iVar);
+        fieldMin(iPoint,iVar) = field(iPoint,iVar);
+      }
+
+      for(size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+    }
+
+    /*--- Initialize min/max projection out of iPoint. ---*/
+
+    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      projMax[iVar] = projMin[iVar] = 0.0;
+
+    /*--- Compute max/min projection and values over direct neighbors. ---*/
+
+    for(size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+    {
+      size_t jPoint = node->GetPoint(iNeigh);
+
+      const su2double* coord_j = geometry.node[jPoint]->GetCoord();
+      AD::SetPreaccIn(coord_j, nDim);
+
+      /*--- Distance vector from iPoint to face (middle of the edge). ---*/
+
+      su2double dist_ij[MAXNDIM] = {0.0};
+
+      for(size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+      /*--- Project each variable, update min/max. ---*/
+
+      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double proj = 0.0;
+
+        for(size_t iDim = 0; iDim < nDim; ++iDim)
+          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+        projMax[iVar] = max(projMax[iVar], proj);
+        projMin[iVar] = min(projMin[iVar], proj);
+
+        AD::SetPreaccIn(field(jPoint,iVar));
+
+        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+      }
+    }
+
+    /*--- Compute the geometric factor. ---*/
+
+    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+    /*--- Final limiter computation for each variable, get the min limiter
+     *    out of the positive/negative projections and deltas. ---*/
+
+    for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+
+      AD::SetPreaccOut(limiter(iPoint,iVar));
+    }
+
+    AD::EndPreacc();
+  }
+}
 
 /*!
  * \brief Generic limiter computation for methods based on one limiter
@@ -53,6 +172,8 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] mpiComms - If false only the periodic communications are performed, the caller
+ *            is then responsible for the exchange of halo limiters with other ranks.
  *
  * Template parameters:
  * \param FieldType - Generic object with operator (iPoint,iVar)
@@ -72,17 +193,14 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool mpiComms)
 {
-  constexpr size_t MAXNDIM = 3;
-  constexpr size_t MAXNVAR = 8;
-
-  if (varEnd > MAXNVAR)
+  if (varEnd > LimiterHelpers::MAXNVAR)
     SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
 
   size_t nPointDomain = geometry.GetnPointDomain();
   size_t nPoint = geometry.GetnPoint();
-  size_t nDim = geometry.GetnDim();
 
   /*--- If we do not have periodicity we can use a
    *    more efficient access pattern to memory. ---*/
@@ -137,96 +255,8 @@ void computeLimiters_impl(CSolver* solver,
 
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-  {
-    auto node = geometry.node[iPoint];
-    const su2double* coord_i = node->GetCoord();
-
-    AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
-
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-    {
-      AD::SetPreaccIn(field(iPoint,iVar));
-
-      if (periodic) {
-        /*--- Started outside loop, so counts as input. ---*/
-        AD::SetPreaccIn(fieldMax(iPoint,iVar));
-        AD::SetPreaccIn(fieldMin(iPoint,iVar));
-      }
-      else {
-        /*--- Initialize min/max now for iPoint if not periodic. ---*/
-        fieldMax(iPoint,iVar) = field(iPoint,iVar);
-        fieldMin(iPoint,iVar) = field(iPoint,iVar);
-      }
-
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
-    }
-
-    /*--- Initialize min/max projection out of iPoint. ---*/
-
-    su2double projMax[MAXNVAR], projMin[MAXNVAR];
-
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      projMax[iVar] = projMin[iVar] = 0.0;
-
-    /*--- Compute max/min projection and values over direct neighbors. ---*/
-
-    for(size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
-    {
-      size_t jPoint = node->GetPoint(iNeigh);
-
-      const su2double* coord_j = geometry.node[jPoint]->GetCoord();
-      AD::SetPreaccIn(coord_j, nDim);
-
-      /*--- Distance vector from iPoint to face (middle of the edge). ---*/
-
-      su2double dist_ij[MAXNDIM] = {0.0};
-
-      for(size_t iDim = 0; iDim < nDim; ++iDim)
-        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
-
-      /*--- Project each variable, update min/max. ---*/
-
-      for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      {
-        su2double proj = 0.0;
-
-        for(size_t iDim = 0; iDim < nDim; ++iDim)
-          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
-
-        projMax[iVar] = max(projMax[iVar], proj);
-        projMin[iVar] = min(projMin[iVar], proj);
-
-        AD::SetPreaccIn(field(jPoint,iVar));
-
-        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
-        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
-      }
-    }
-
-    /*--- Compute the geometric factor. ---*/
-
-    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
-
-    /*--- Final limiter computation for each variable, get the min limiter
-     *    out of the positive/negative projections and deltas. ---*/
-
-    for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
-    {
-      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
-                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
-
-      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
-                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
-
-      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
-
-      AD::SetPreaccOut(limiter(iPoint,iVar));
-    }
-
-    AD::EndPreacc();
-  }
+    LimiterHelpers::pointLimiter(limiterDetails, geometry, varBegin, varEnd, !periodic,
+                                 field, gradient, fieldMin, fieldMax, limiter, iPoint);
 
   /*--- If no solver was provided we do not communicate. ---*/
 
@@ -243,8 +273,10 @@ void computeLimiters_impl(CSolver* solver,
 
     /*--- Obtain the limiters at halo points from the MPI ranks that own them. ---*/
 
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (mpiComms) {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
   }
   SU2_OMP_BARRIER
 
@@ -253,3 +285,33 @@ void computeLimiters_impl(CSolver* solver,
 #endif
 
 }
+
+
+/*!
+ * \brief Implementation of computeLimitersRange for a kind of limiter, see
+ *        computeLimiters_impl for the arguments and template parameters.
+ */
+template<class FieldType, class GradientType, ENUM_LIMITER LimiterKind>
+std::function<void(size_t,size_t)> computeLimitersRange_impl(CGeometry& geometry,
+                                                             CConfig& config,
+                                                             size_t varBegin,
+                                                             size_t varEnd,
+                                                             const FieldType& field,
+                                                             const GradientType& gradient,
+                                                             FieldType& fieldMin,
+                                                             FieldType& fieldMax,
+                                                             FieldType& limiter)
+{
+  if (varEnd > LimiterHelpers::MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  return [=, &geometry, &field, &gradient, &fieldMin, &fieldMax, &limiter](size_t pointBegin, size_t pointEnd) {
+    for (size_t iPoint = pointBegin; iPoint < pointEnd; ++iPoint)
+      LimiterHelpers::pointLimiter(limiterDetails, geometry, varBegin, varEnd, true,
+                                   field, gradient, fieldMin, fieldMax, limiter, iPoint);
+  };
+}
@@ -0,0 +1,101 @@
+/*!
+ * \file batched_fluxes.hpp
+ * \brief Declaration of the interface for vectorized convective schemes,
+ *        which compute the fluxes of a batch of edges in one call.
+ *        The schemes are implemented in batched_fluxes.cpp.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../../../Common/include/CConfig.hpp"
+#include "../../../../../Common/include/toolboxes/vectorization.hpp"
+
+/*!
+ * \class CBatchedConvectiveFlux
+ * \brief Interface for convective schemes that compute the fluxes (and Jacobians) of
+ *        "BatchSize" edges at once, one edge per SIMD lane.
+ * \ingroup ConvDiscr
+ * \note Contrary to CNumerics, the state of the edges is not set via member functions but
+ *       passed to ComputeFlux in a structure, which makes the schemes stateless and so one
+ *       object can be shared by all threads. Only the ideal gas versions of the Roe, AUSM+up,
+ *       HLLC, and JST schemes are available (for other settings CreateFlux returns nullptr
+ *       and the scalar schemes must be used). The results are the same as those of the
+ *       corresponding CNumerics classes, see roe.cpp, ausm_slau.cpp, hllc.cpp, and centered.cpp.
+ * \author agent
+ */
+class CBatchedConvectiveFlux {
+public:
+  enum : size_t {MAXNDIM = 3};              /*!< \brief Max number of space dimensions. */
+  enum : size_t {MAXNVAR = MAXNDIM+2};      /*!< \brief Max number of conservative variables. */
+  enum : size_t {MAXNPRIMVAR = MAXNDIM+5};  /*!< \brief Primitives used by the schemes (T, vel, P, rho, h, c). */
+
+  enum : size_t {BatchSize = simd::preferredLen<passivedouble>()}; /*!< \brief Number of edges per call. */
+
+  using Double = simd::Array<passivedouble, BatchSize>;
+
+  /*!
+   * \brief State of a batch of edges, "k-th lane" of each member is for the k-th edge.
+   * \note Members that a scheme does not use need not be set (e.g. the sensors for upwind schemes).
+   */
+  struct Input {
+    Double normal[MAXNDIM];                           /*!< \brief Edge normal (area-scaled). */
+    Double V_i[MAXNPRIMVAR], V_j[MAXNPRIMVAR];        /*!< \brief Primitive variables at points i and j. */
+    Double gridVel_i[MAXNDIM], gridVel_j[MAXNDIM];    /*!< \brief Grid velocities (dynamic grids). */
+    Double lambda_i, lambda_j;                        /*!< \brief Spectral radii (centered schemes). */
+    Double sensor_i, sensor_j;                        /*!< \brief Pressure sensors (JST). */
+    Double undivLapl_i[MAXNVAR], undivLapl_j[MAXNVAR];/*!< \brief Undivided Laplacians (JST). */
+    Double nNeighbor_i, nNeighbor_j;                  /*!< \brief Number of neighbors (centered schemes). */
+  };
+
+  /*!
+   * \brief Fluxes and Jacobians for a batch of edges.
+   */
+  struct Output {
+    Double flux[MAXNVAR];                             /*!< \brief Flux across the edges. */
+    Double jac_i[MAXNVAR][MAXNVAR];                   /*!< \brief Flux Jacobian w.r.t. the conservatives of i. */
+    Double jac_j[MAXNVAR][MAXNVAR];                   /*!< \brief Flux Jacobian w.r.t. the conservatives of j. */
+  };
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CBatchedConvectiveFlux(void) = default;
+
+  /*!
+   * \brief Compute the fluxes (and Jacobians for implicit time integration) of a batch of edges.
+   * \param[in] input - State of the edges.
+   * \param[out] output - Fluxes and Jacobians.
+   */
+  virtual void ComputeFlux(const Input& input, Output& output) const = 0;
+
+  /*!
+   * \brief Factory method, create the batched version of the convective scheme of the flow solver.
+   * \param[in] nDim - Number of dimensions of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Grid level (on coarse grids centered schemes are replaced by Lax-Friedrich).
+   * \return Pointer to the scheme, or nullptr if vectorization is not enabled or not supported for the settings.
+   */
+  static CBatchedConvectiveFlux* CreateFlux(unsigned short nDim, const CConfig* config, unsigned short iMesh);
+};
@@ -29,6 +29,7 @@
 
 #include "COutput.hpp"
 #include "../variables/CVariable.hpp"
+#include "tools/CProbes.hpp"
 
 class CFlowOutput : public COutput{
 public:
@@ -43,7 +44,14 @@ public:
    */
   ~CFlowOutput(void) override;
 
+  /*!
+   * \brief Release the data that depends on the partition of the grid, including the donors of the probes.
+   */
+  void ClearGeometryData() override;
+
 protected:
+  CProbes* probes = nullptr;  /*!< \brief Point and line probes of the flow solution. */
+
   /*!
    * \brief Add flow surface output fields
    * \param[in] config - Definition of the particular problem.
@@ -59,6 +67,20 @@ protected:
    */
   void SetAnalyzeSurface(CSolver *solver, CGeometry *geometry, CConfig *config, bool output);
 
+  /*!
+   * \brief Add the history output fields of the probes (PROBE_POINTS and PROBE_LINES), group PROBES.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AddProbeOutput(const CConfig *config);
+
+  /*!
+   * \brief Set the history output field values of the probes, the probes are located on the first call.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The flow solver.
+   */
+  void SetProbeOutput(const CConfig *config, CGeometry *geometry, CSolver *solver);
+
   /*!
    * \brief Add aerodynamic coefficients as output fields
    * \param[in] config - Definition of the particular problem.
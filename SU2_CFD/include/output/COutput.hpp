@@ -44,6 +44,8 @@ class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+struct CRestartKeyframe;
+class CSurfaceSampler;
 class CConfig;
 
 using namespace std;
@@ -161,6 +163,13 @@ protected:
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
    CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+   std::map<unsigned short, CFileWriter*> asyncWriters; //!< Writers with pending background writes, at most one per format
+
+   CRestartKeyframe* restartKeyframe = nullptr; //!< Last keyframe of the compressed restarts, for the deltas
+   unsigned long nRestartWritten = 0;           //!< Number of compressed restarts written, to space the keyframes
+
+   CSurfaceSampler* surfaceSampler = nullptr;   //!< In-situ sampling of the markers (MARKER_SAMPLING)
+
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
 
@@ -623,6 +632,14 @@ protected:
    */
   void LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver);
 
+  /*!
+   * \brief Load up the values of the requested volume fields only for the points of the sampled markers.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  void LoadSampledDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver);
+
   /*!
    * \brief Postprocess_HistoryData
    * \param[in] config - Definition of the particular problem.
@@ -675,6 +692,13 @@ public:
    */
   virtual ~COutput(void);
 
+  /*!
+   * \brief Complete the background writes and release the data that depends on the partition of the grid
+   *        (data sorters, surface sampler, keyframe of the restarts), it is set up again by the next output.
+   * \note Called before the grid is repartitioned (LOAD_REBALANCE).
+   */
+  virtual void ClearGeometryData();
+
 protected:
 
   /*!
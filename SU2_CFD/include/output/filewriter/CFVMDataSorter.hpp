@@ -35,6 +35,7 @@ class CFVMDataSorter final: public CParallelDataSorter{
 private:
 
   int* Local_Halo; //!< Array containing the flag whether a point is a halo node
+  bool connectivityLinear = false; //!< Whether the connectivity was sorted into the linear partitioning (val_sort)
 
 public:
 
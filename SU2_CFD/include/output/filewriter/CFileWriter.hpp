@@ -94,6 +94,11 @@ protected:
    * \brief The file handle for writing
    */
   MPI_File fhw;
+
+  bool asyncWrite = false;             /*!< \brief Whether the data is written with non-blocking MPI-IO. */
+  bool asyncPending = false;           /*!< \brief Whether there are writes pending completion. */
+  vector<vector<char> > asyncBuffers;  /*!< \brief Copies of the data being written asynchronously. */
+  vector<MPI_Request> asyncRequests;   /*!< \brief Requests of the pending asynchronous writes. */
 #else
 
   /*!
@@ -143,6 +148,21 @@ public:
    * \return The time used to write to file.
    */
   su2double Get_UsedTime() const {return usedTime;}
+
+  /*!
+   * \brief Write the data in the background with non-blocking MPI-IO (no effect without MPI).
+   * \note Must be called before Write_Data, which then copies the data and returns before it is
+   *       written, i.e. the data sorter can be modified. The file is closed by WaitForCompletion.
+   *       Only writers that access the file exclusively via the functions of this class support this.
+   * \param[in] async - Whether to write asynchronously.
+   */
+  void SetAsync(bool async);
+
+  /*!
+   * \brief Complete the pending writes of an asynchronous Write_Data and close the file (collective).
+   * \note After this the bandwidth and file size are available.
+   */
+  void WaitForCompletion();
   
 protected:
   
@@ -174,6 +194,18 @@ protected:
    * \return 
    */
   bool WriteMPIString(const std::string& str, unsigned short processor);
+
+#ifdef HAVE_MPI
+  /*!
+   * \brief Copy data and post a non-blocking write of it at an explicit offset of the file.
+   * \param[in] data - Pointer to the data to write.
+   * \param[in] sizeInBytes - The size of the data in bytes on this processor.
+   * \param[in] offsetInBytes - Position of the data in the file.
+   * \param[in] collective - If all processors call this function.
+   * \return Boolean indicating whether the posting was successful.
+   */
+  bool PostAsyncWrite(const void *data, unsigned long sizeInBytes, unsigned long offsetInBytes, bool collective);
+#endif
   
   /*!
    * \brief Open a file to write using MPI I/O. Already existing file is deleted.
@@ -0,0 +1,103 @@
+/*!
+ * \file CHDF5FileWriter.hpp
+ * \brief Headers for the HDF5/XDMF file writer class.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CHDF5FileWriter
+ * \brief Writes the sorted data to an HDF5 file and an XDMF descriptor of it (".xmf", for Paraview/VisIt).
+ * \note The HDF5 file contains the datasets "/Geometry" (nPoint x 3 doubles), "/Topology" (the elements in
+ *       XDMF "Mixed" format, 64-bit integers), and "/Fields/<field name>" (nPoint doubles per field). The
+ *       datasets are chunked, i.e. fields or ranges of points can be read without reading the whole file.
+ *       Each rank writes the points and elements of its linear partition. With a parallel HDF5 library
+ *       the writes are collective (MPI-IO), otherwise the ranks write their part in turn.
+ *       Without HDF5 support (HAVE_HDF5) nothing is written.
+ * \author agent
+ */
+class CHDF5FileWriter final: public CFileWriter{
+
+  unsigned long timeIter;  //!< Current value of the time iteration
+  su2double timeStep;       //!< Current value of the time step
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Number of entries per chunk of the datasets (or number of points for "/Geometry").
+   */
+  static constexpr unsigned long chunkSize = 65536;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valTimeIter - The current time iteration
+   * \param[in] valTimeStep - The current physical time step value
+   */
+  CHDF5FileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                  unsigned long valTimeIter, su2double valTimeStep);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CHDF5FileWriter() override;
+
+  /*!
+   * \brief Write sorted data to file in HDF5 format, and the XDMF descriptor.
+   */
+  void Write_Data() override;
+
+private:
+
+  /*!
+   * \brief Write the datasets to the HDF5 file.
+   * \param[in] create - Whether to create the file and datasets, or to open existing ones.
+   * \param[in] topology - Local part of the topology.
+   * \param[in] topologyOffset - Position of the local part in the global topology.
+   * \param[in] topologySize - Size of the global topology.
+   */
+  void WriteHDF5(bool create, const vector<int64_t>& topology,
+                 unsigned long topologyOffset, unsigned long topologySize) const;
+
+  /*!
+   * \brief Write the XDMF descriptor of the HDF5 file (called by the master).
+   * \param[in] topologySize - Size of the global topology.
+   */
+  void WriteXDMF(unsigned long topologySize) const;
+
+  /*!
+   * \brief Name of the dataset of a field ('/' and quotes are not allowed).
+   */
+  static string DatasetName(string fieldName);
+
+};
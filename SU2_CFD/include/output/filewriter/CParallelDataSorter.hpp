@@ -90,21 +90,28 @@ protected:
   unsigned long *Index;                //!< Index each point has in the send buffer
   su2double *connSend;                 //!< Send buffer holding the data that will be send to other processors
   passivedouble *passiveDoubleBuffer;  //!< Buffer holding the sorted, partitioned data as passivedouble types
-  su2double     *doubleBuffer;         //!< Buffer holding the sorted, partitioned data as su2double types
-  /// Pointer used to allocate the memory used for ::passiveDoubleBuffer and ::doubleBuffer.
+  /// Pointer used to allocate the memory used for ::passiveDoubleBuffer.
   char *dataBuffer;
-  unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
+  /*--- Redistribution plan, computed once by ::PrepareSendBuffers and reused by every ::SortOutputData. ---*/
+
+  vector<int> sendCounts, sendDispls;  //!< Number and position of the values sent to each processor
+  vector<int> recvCounts, recvDispls;  //!< Number and position of the values received from each processor
+  vector<unsigned long> sortedIndex;   //!< Position in the sorted data of each received point
+  vector<su2double> recvBuffer;        //!< Buffer receiving the unsorted data of the points of this processor
+
   vector<string> fieldNames;           //!< Vector with names of the output fields
 
   unsigned short nDim;                 //!< Spatial dimension of the data
 
   /*!
-   * \brief Prepare the send buffers by filling them with the global indices.
+   * \brief Prepare the send buffers and the redistribution plan (collective).
    * After calling this function, the data buffer for sending can be filled with the
-   * ::SetUnsorted_Data() routine.
+   * ::SetUnsorted_Data() routine, and sorted with ::SortOutputData().
+   * \note The global indices are communicated here, once, to determine the position of each received
+   *       point in the sorted data. Sorting then only requires one exchange of the send buffer.
    * \param[in] globalID - Vector containing the global indices of the points
    */
   void PrepareSendBuffers(std::vector<unsigned long>& globalID);
@@ -125,6 +132,7 @@ public:
 
   /*!
    * \brief Sort the output data for each grid node into a linear partitioning across all processors.
+   * \note The send buffer is exchanged with one Alltoallv and unpacked directly into the sorted positions.
    */
   virtual void SortOutputData();
 
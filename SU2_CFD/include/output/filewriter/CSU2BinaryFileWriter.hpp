@@ -27,9 +27,32 @@
 
 #pragma once
 #include "CFileWriter.hpp"
+#include <cstdint>
+
+/*!
+ * \brief Local data of the last keyframe written by CSU2BinaryFileWriter, used to write the next
+ *        compressed restarts as deltas (see SU2CompressedRestart).
+ */
+struct CRestartKeyframe {
+  string fileName;                      /*!< \brief Name of the keyframe file (without directory). */
+  unsigned long firstPoint = 0;         /*!< \brief Global index of the first point of this rank. */
+  vector<string> fieldNames;            /*!< \brief Fields of the keyframe. */
+  vector<passivedouble> data;           /*!< \brief Data of this rank, as given by the data sorter. */
+  vector<passivedouble> errorBound;     /*!< \brief Error bounds of the fields. */
+  vector<uint64_t> blockChecksum;       /*!< \brief Checksums of the blocks of this rank. */
+};
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  bool compress;                          /*!< \brief Write the compressed format (see SU2CompressedRestart). */
+  vector<passivedouble> lossyTolerance;   /*!< \brief Error bound of each field relative to its maximum magnitude. */
+  CRestartKeyframe* keyframe = nullptr;   /*!< \brief Last keyframe, updated when a keyframe is written. */
+  bool writeDelta = false;                /*!< \brief Whether to write the data relative to the keyframe. */
+
+  /*!
+   * \brief Write sorted data to file in the compressed SU2 binary format.
+   */
+  void Write_Data_Compressed();
 
 public:
 
@@ -42,8 +65,12 @@ public:
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompress - Whether to compress the data.
+   * \param[in] valLossyTolerance - Relative error bound of each field for lossy compression,
+   *            0 (or an empty vector) for lossless compression.
    */
-  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter, bool valCompress = false,
+                       vector<passivedouble> valLossyTolerance = {});
 
   /*!
    * \brief Destructor
@@ -55,4 +82,16 @@ public:
    */
   void Write_Data() override;
 
+  /*!
+   * \brief Write compressed files as keyframes or as deltas relative to the last keyframe.
+   * \note A keyframe is written instead of a delta if there is no compatible keyframe (e.g. the fields
+   *       changed or the keyframe file would be overwritten). The keyframe is updated when one is written.
+   * \param[in] valKeyframe - Last keyframe.
+   * \param[in] valWriteDelta - Whether to write a delta.
+   */
+  void SetKeyframe(CRestartKeyframe* valKeyframe, bool valWriteDelta) {
+    keyframe = valKeyframe;
+    writeDelta = valWriteDelta;
+  }
+
 };
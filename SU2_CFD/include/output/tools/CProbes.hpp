@@ -0,0 +1,129 @@
+/*!
+ * \file CProbes.hpp
+ * \brief Header file for the class CProbes.
+ *        The implementations are in the <i>CProbes.cpp</i> file.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include "../../../../Common/include/mpi_structure.hpp"
+
+class CConfig;
+class CGeometry;
+
+using namespace std;
+
+/*!
+ * \class CProbes
+ * \brief Point and line probes of the volume solution (PROBE_POINTS and PROBE_LINES).
+ * \note The probes are located once in the local elements with an ADT (CADTElemClass), the donor
+ *       points and interpolation weights are then cached. Each probe is evaluated by one rank and
+ *       the values of all probes are made available to all ranks with a single reduction.
+ *       Probes outside the grid take the value of the nearest point.
+ * \author agent
+ */
+class CProbes {
+private:
+
+  int rank, size;
+
+  unsigned short nDim = 0;
+  vector<string> names;               /*!< \brief Name of each probe. */
+  vector<su2double> coord;            /*!< \brief Coordinates of the probes, 3 per probe. */
+
+  bool located = false;               /*!< \brief Whether the probes have been located. */
+  vector<unsigned long> ownedProbe;   /*!< \brief Probes evaluated by this rank. */
+  vector<unsigned long> donorStart;   /*!< \brief Start of the donors of each owned probe (CSR format). */
+  vector<unsigned long> donorPoint;   /*!< \brief Local points of the donors. */
+  vector<su2double> donorWeight;      /*!< \brief Interpolation weights of the donors. */
+
+  vector<su2double> localValues;      /*!< \brief Values of the owned probes (0 for the others). */
+
+public:
+
+  /*!
+   * \brief Constructor, reads the probes from the config (PROBE_POINTS and the points of PROBE_LINES).
+   * \param[in] config - Definition of the particular problem.
+   */
+  CProbes(const CConfig* config);
+
+  /*!
+   * \brief Get the number of probes.
+   */
+  inline unsigned long GetnProbe() const { return names.size(); }
+
+  /*!
+   * \brief Get the names of the probes, points are named "probe_<i>" and the points of the lines "line<j>_<i>".
+   */
+  inline const vector<string>& GetNames() const { return names; }
+
+  /*!
+   * \brief Whether the probes have been located.
+   */
+  inline bool IsLocated() const { return located; }
+
+  /*!
+   * \brief Find the donor element of each probe and compute the interpolation weights (collective).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void Locate(CGeometry* geometry);
+
+  /*!
+   * \brief Discard the donors, the probes are located again on the next evaluation (e.g. after repartitioning).
+   */
+  inline void Clear() {
+    located = false;
+    ownedProbe.clear();
+    donorStart.clear();
+    donorPoint.clear();
+    donorWeight.clear();
+  }
+
+  /*!
+   * \brief Interpolate fields of the solution to all the probes (collective).
+   * \param[in] nField - Number of fields.
+   * \param[in] pointValue - Function object, pointValue(iPoint, iField) returns the value of a field at a point.
+   * \param[out] values - Values of the fields at the probes, nField per probe (the same on all ranks).
+   */
+  template<class F>
+  void Evaluate(unsigned short nField, const F& pointValue, vector<su2double>& values) {
+
+    localValues.assign(GetnProbe()*nField, 0.0);
+    values.resize(localValues.size());
+
+    for (unsigned long i = 0; i < ownedProbe.size(); i++) {
+      su2double* probeValues = &localValues[ownedProbe[i]*nField];
+
+      for (auto iDonor = donorStart[i]; iDonor < donorStart[i+1]; iDonor++)
+        for (unsigned short iField = 0; iField < nField; iField++)
+          probeValues[iField] += donorWeight[iDonor] * pointValue(donorPoint[iDonor], iField);
+    }
+
+    SU2_MPI::Allreduce(localValues.data(), values.data(), values.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  }
+
+};
@@ -0,0 +1,178 @@
+/*!
+ * \file CSurfaceSampler.hpp
+ * \brief Header file for the class CSurfaceSampler.
+ *        The implementations are in the <i>CSurfaceSampler.cpp</i> file.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include "../../../../Common/include/mpi_structure.hpp"
+
+class CConfig;
+class CGeometry;
+class CParallelDataSorter;
+
+using namespace std;
+
+/*!
+ * \brief Layout of the surface samples file (native byte order).
+ * \note The file is made of:
+ *       - A header of HEADER_SIZE 64-bit unsigned integers, see HEADER_WORD.
+ *       - The names of the fields and of the markers, NAME_SIZE characters each (null-padded).
+ *       - The global indices (64-bit unsigned integers) of the sampled vertices, followed by their
+ *         coordinates (nDim doubles per vertex).
+ *       - The same for the vertices onto which the probes were snapped.
+ *       - One record per sample, made of the iteration (64-bit unsigned integer), the time (double),
+ *         the values of the vertices (nField floats per vertex), the area-weighted averages over the
+ *         markers (nField doubles per marker), and the values of the probes (nField doubles per probe).
+ *       The records have a fixed size, any sample can be read without reading the previous ones.
+ */
+namespace SU2SurfaceSamples {
+  enum : uint64_t {
+    MAGIC_NUMBER = 535354,  /*!< \brief Hex codes of "SST" (SU2 surface time series), first word of the file. */
+    FORMAT_VERSION = 1,     /*!< \brief Version of the layout. */
+    HEADER_SIZE = 8,        /*!< \brief Number of words in the header (unused words are 0). */
+    NAME_SIZE = 64          /*!< \brief Fixed length of the field and marker names. */
+  };
+  enum HEADER_WORD {
+    MAGIC = 0,    /*!< \brief Magic number. */
+    FORMAT = 1,   /*!< \brief Format version. */
+    NDIM = 2,     /*!< \brief Number of dimensions. */
+    NFIELD = 3,   /*!< \brief Number of fields. */
+    NVERTEX = 4,  /*!< \brief Number of sampled vertices (0 if only the averages and probes are written). */
+    NMARKER = 5,  /*!< \brief Number of averaged markers. */
+    NPROBE = 6    /*!< \brief Number of probes. */
+  };
+}
+
+/*!
+ * \class CSurfaceSampler
+ * \brief Samples output fields on markers and streams them to a binary time series (see SU2SurfaceSamples).
+ * \note The values are taken directly from the unsorted data of the volume data sorter at the vertices
+ *       of the sampled markers, i.e. the volume data is never sorted nor communicated. Each rank
+ *       reduces its vertices to marker averages and probe values, and only the (small) surface data
+ *       is sent to the master, which appends one record to the file per sample.
+ * \author agent
+ */
+class CSurfaceSampler {
+private:
+
+  int rank, size;
+
+  unsigned short nDim;
+  string fileName;                    /*!< \brief Name of the samples file. */
+  ofstream file;                      /*!< \brief Samples file, only open on the master. */
+
+  vector<string> fieldNames;          /*!< \brief Sampled fields. */
+  vector<unsigned short> fieldIndex;  /*!< \brief Position of the sampled fields in the volume data. */
+  vector<string> markerNames;         /*!< \brief Sampled markers. */
+  vector<short> markerIndex;          /*!< \brief Index of the sampled markers in the local geometry (-1 if not present). */
+  vector<bool> sampledMarker;         /*!< \brief Whether each local marker is sampled. */
+
+  bool writeVertices;                 /*!< \brief Whether the values of the vertices are written, or only the reductions. */
+  vector<unsigned long> localPoints;  /*!< \brief Local points (owned, without repetitions) of the sampled markers. */
+  vector<int> nPointRank;             /*!< \brief Number of sampled points of each rank (on the master). */
+
+  unsigned long nProbe = 0;           /*!< \brief Number of probes. */
+  vector<long> probePoint;            /*!< \brief Local point of the vertex nearest to each probe, -1 if it belongs to another rank. */
+
+  vector<passivedouble> sendBuffer;   /*!< \brief Values of the local points. */
+  vector<float> recordBuffer;         /*!< \brief Values of all the sampled vertices (on the master). */
+
+  /*!
+   * \brief Find the vertex nearest to each probe (amongst the vertices of the sampled markers).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] probeIndex - Global index of the vertex nearest to each probe (valid on the master).
+   * \param[out] probeCoord - Coordinates of those vertices (valid on the master).
+   */
+  void LocateProbes(const CConfig* config, CGeometry* geometry,
+                    vector<uint64_t>& probeIndex, vector<passivedouble>& probeCoord);
+
+  /*!
+   * \brief Gather the data of the sampled points on the master.
+   * \note The data must be passive (not su2double), it is sent with the base MPI wrapper.
+   * \param[in] localData - Values of the local points, count entries per point.
+   * \param[in] count - Number of values per point.
+   * \param[in] datatype - MPI type of the values.
+   * \param[out] data - Values of all the sampled points (on the master).
+   */
+  template<class T>
+  void GatherPoints(const vector<T>& localData, int count, SU2_MPI::Datatype datatype, vector<T>& data) const;
+
+  /*!
+   * \brief Create the samples file and write the header, names, and locations (called by the master).
+   * \note On restarts, the samples are appended to an existing file with the same header.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] preamble - Bytes before the first record.
+   */
+  void OpenFile(const CConfig* config, const vector<char>& preamble);
+
+public:
+
+  /*!
+   * \brief File extension.
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Constructor, determines the sampled vertices and probes and prepares the samples file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] volumeFieldNames - Names of the fields of the volume output, in the order of the volume data.
+   */
+  CSurfaceSampler(CConfig* config, CGeometry* geometry, const vector<string>& volumeFieldNames);
+
+  /*!
+   * \brief Whether a sample is taken at an iteration.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Current (time) iteration.
+   */
+  bool SampleIteration(const CConfig* config, unsigned long iter) const;
+
+  /*!
+   * \brief Whether a (local) marker is sampled, used to load only the data of the sampled markers.
+   */
+  inline bool IsSampled(unsigned short iMarker) const { return sampledMarker[iMarker]; }
+
+  /*!
+   * \brief Get the local points of the sampled markers, used to load only the data of those points.
+   */
+  inline const vector<unsigned long>& GetLocalPoints() const { return localPoints; }
+
+  /*!
+   * \brief Sample the fields and append the record to the samples file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] dataSorter - Volume data sorter with the loaded (unsorted) data.
+   * \param[in] iter - Current (time) iteration.
+   */
+  void Sample(const CConfig* config, CGeometry* geometry, const CParallelDataSorter* dataSorter, unsigned long iter);
+
+};
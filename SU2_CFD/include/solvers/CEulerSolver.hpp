@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../variables/CEulerVariable.hpp"
+#include "../numerics/flow/convection/batched_fluxes.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
 /*!
@@ -45,7 +46,7 @@ protected:
   enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
   enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
 
-  unsigned long omp_chunk_size;  /*!< \brief Chunk size used in light point loops. */
+  unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Chunk size used in light point loops. */
 
   su2double
   Mach_Inf = 0.0,            /*!< \brief Mach number at the infinity. */
@@ -279,6 +280,46 @@ protected:
 
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  /*--- State and residual about which the Jacobian-free products of the Newton-Krylov mode are computed. ---*/
+
+  CSysVector<su2double> NewtonKrylovSol; /*!< \brief Solution at the start of the nonlinear iteration. */
+  CSysVector<su2double> NewtonKrylovRes; /*!< \brief Residual at the start of the nonlinear iteration. */
+  su2double NewtonKrylovSolNorm = 0.0;   /*!< \brief Norm of NewtonKrylovSol, sets the finite difference step. */
+  bool JacobianFreeResidual = false;     /*!< \brief True while the residual of a product is computed, the Jacobian is then not modified. */
+
+  const CBatchedConvectiveFlux* batchedConvFlux = nullptr; /*!< \brief Vectorized convective scheme, if in use. */
+
+  /*--- Overlap of the halo exchanges of the MUSCL data (gradients and limiters) with computation. The last
+   * exchange is deferred to the residual computation, where it takes place while the edges between owned
+   * points are computed. Only one exchange can be in progress at a time as the geometry buffers are used. ---*/
+
+  /*!
+   * \brief Sets of edges for the overlap of communication and computation.
+   */
+  enum class EdgeSet {ALL, INTERIOR, HALO};
+
+  bool OverlapComms = false;            /*!< \brief Whether the halo exchanges of the MUSCL data are overlapped. */
+  bool DeferredComm = false;            /*!< \brief There is a deferred halo exchange. */
+  MPI_QUANTITIES DeferredCommType = PRIMITIVE_GRADIENT; /*!< \brief Type of the deferred halo exchange. */
+  vector<bool> HaloEdge;                /*!< \brief Edges with (at least) one halo point. */
+
+  /*--- Task graph of the residual computation (RESIDUAL_TASK_BLOCK_SIZE). The points are divided in blocks (owned
+   * points first), and the edges in groups by the blocks of their points. Each task (block of points, group of edges,
+   * or marker) declares its dependencies on "tokens" of the blocks whose residual it updates, see TaskGraph_Residual. ---*/
+
+  bool UseTaskGraph = false;            /*!< \brief Whether the residual is computed by the task graph. */
+  bool TaskMUSCL = false;               /*!< \brief The MUSCL gradients and limiters are left for the task graph. */
+  unsigned long TaskBlockSize = 0;      /*!< \brief Number of points per block. */
+  unsigned long nTaskBlockDomain = 0;   /*!< \brief Number of blocks of owned points. */
+  unsigned long nTaskBlock = 0;         /*!< \brief Number of blocks (owned and halo). */
+  unsigned long nTaskEdgeGroupDomain = 0; /*!< \brief Number of groups of edges between owned points. */
+  vector<unsigned long> TaskEdges;      /*!< \brief Edges, sorted by group (in index order within groups). */
+  vector<unsigned long> TaskEdgeGroupPtr; /*!< \brief Start of each group in TaskEdges. */
+  vector<pair<unsigned long, unsigned long> > TaskEdgeGroupBlocks; /*!< \brief Blocks of the points of each group. */
+  vector<vector<unsigned long> > TaskMarkerBlocks; /*!< \brief Blocks of the owned points of each marker. */
+  vector<char> TaskTokens;              /*!< \brief Dependency tokens, of the blocks, markers, and marker colors. */
+  std::function<void(size_t,size_t)> TaskLimiter; /*!< \brief Limiters of a range of points (see computeLimitersRange). */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -295,12 +336,221 @@ protected:
   template<ENUM_TIME_INT IntegrationType>
   void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
 
+  /*!
+   * \brief Implementation of the implicit Euler iteration.
+   * \param[in] ComputeResidual - Residual computation for the Newton-Krylov mode, nullptr for the usual mode.
+   */
+  void Implicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                          const std::function<void()>* ComputeResidual);
+
+  /*!
+   * \brief Solve the linear system of the Newton-Krylov mode, with Jacobian-free products.
+   * \param[in] system - Linear solver (the template parameter is its scalar type).
+   * \param[in] ComputeResidual - Computes the residual (space integration) for the current solution.
+   * \return Number of linear solver iterations.
+   */
+  template<class ScalarType>
+  unsigned long NewtonKrylov_Solve(CSysSolve<ScalarType>& system, CGeometry *geometry, CSolver **solver_container,
+                                   CConfig *config, const std::function<void()>& ComputeResidual);
+
+  /*!
+   * \brief Finite difference approximation of the product of the Jacobian (including the pseudo-time
+   *        term) with a vector, v = (R(U+eps*u) - R(U)) / eps + Vol/dt * u.
+   * \note The solution is restored at the end, but not the primitive variables, gradients, etc.
+   * \param[in] ComputeResidual - Computes the residual (space integration) for the current solution.
+   * \param[in] u - Direction of the product.
+   * \param[out] v - Result of the product.
+   */
+  template<class ScalarType>
+  void JacobianFreeProduct(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                           const std::function<void()>& ComputeResidual,
+                           const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v);
+
+  /*!
+   * \brief Preprocess the current solution, and compute its residual, without modifying the Jacobian.
+   * \param[in] ComputeResidual - Computes the residual, if nullptr only the preprocessing is done.
+   */
+  void NewtonKrylov_Residual(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                             const std::function<void()>* ComputeResidual);
+
+  /*!
+   * \brief Whether the residual routines should add their contributions to the Jacobian.
+   * \note This replaces the check of the time integration scheme, as the Jacobian is left
+   *       untouched while the residuals of the Jacobian-free products are computed.
+   */
+  inline bool AssembleJacobian(const CConfig *config) const {
+    return (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !JacobianFreeResidual;
+  }
+
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
    * \param[in] geometry - Geometrical definition of the problem.
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief MUSCL reconstruction of the primitive (and secondary) variables at the two sides of an edge,
+   *        followed by the check of whether the reconstructed states are physical.
+   * \note If a state is not physical the point is flagged, the cell-average value should then be used.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] limiter - Apply the slope limiter.
+   * \param[in] van_albada - The limiter is the van Albada edge limiter (computed here).
+   * \param[in] consistent - Recompute the reconstructed quantities in a thermodynamically consistent way.
+   * \param[in] low_mach_corr - Apply the low-Mach number correction.
+   * \param[out] Primitive_i - Reconstructed primitive variables at iPoint.
+   * \param[out] Primitive_j - Reconstructed primitive variables at jPoint.
+   * \param[out] Secondary_i - Reconstructed secondary variables at iPoint.
+   * \param[out] Secondary_j - Reconstructed secondary variables at jPoint.
+   * \param[out] bad_i - The reconstruction is not usable at iPoint.
+   * \param[out] bad_j - The reconstruction is not usable at jPoint.
+   */
+  void MUSCL_Reconstruction(CGeometry *geometry, unsigned long iPoint, unsigned long jPoint,
+                            bool limiter, bool van_albada, bool consistent, bool low_mach_corr,
+                            su2double *Primitive_i, su2double *Primitive_j,
+                            su2double *Secondary_i, su2double *Secondary_j,
+                            bool &bad_i, bool &bad_j);
+
+  /*!
+   * \brief Compute the convective (and viscous) residuals with the vectorized scheme (batchedConvFlux).
+   * \note Batches of edges are formed within the color groups, hence this is thread-safe in the
+   *       same way as the scalar edge loops, after the flux computation the residual and Jacobian
+   *       updates are done edge by edge.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \return Number of non-physical MUSCL reconstructions (local to the thread).
+   */
+  unsigned long BatchedConvective_Residual(CGeometry *geometry, CSolver **solver_container,
+                                           CNumerics **numerics_container, CConfig *config,
+                                           unsigned short iMesh, EdgeSet edgeSet = EdgeSet::ALL);
+
+  /*!
+   * \brief Check if an edge belongs to a set of edges.
+   * \param[in] iEdge - Index of the edge.
+   * \param[in] edgeSet - Set of edges.
+   */
+  inline bool InEdgeSet(unsigned long iEdge, EdgeSet edgeSet) const {
+    return (edgeSet == EdgeSet::ALL) || (HaloEdge[iEdge] == (edgeSet == EdgeSet::HALO));
+  }
+
+  /*!
+   * \brief Start the deferred halo exchange (if any), master thread only.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitiateDeferredComms(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Complete the deferred halo exchange (if any), starting it if that was not done yet.
+   * \note All threads should call this function.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] started - Whether InitiateDeferredComms was called.
+   */
+  void CompleteDeferredComms(CGeometry *geometry, CConfig *config, bool started);
+
+  /*!
+   * \brief Compute gradients or limiters (of owned points) while the deferred halo exchange takes place,
+   *        then exchange the computed quantity or defer the exchange.
+   * \note The computation must not perform the MPI exchange itself. A deferred exchange of the same
+   *       quantity is superseded by the new one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Type of the exchange that is required after the computation.
+   * \param[in] defer - Defer that exchange.
+   * \param[in] compute - Function that performs the computation.
+   */
+  template<class ComputeFunc>
+  void OverlappedHaloComms(CGeometry *geometry, CConfig *config, MPI_QUANTITIES commType,
+                           bool defer, const ComputeFunc& compute);
+
+  /*!
+   * \brief Set up the blocks of points, groups of edges, and tokens of the task graph, if it is
+   *        requested and supported by the settings (the decision is the same on all ranks).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void SetupTaskGraph(CGeometry *geometry, CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Get the block of the task graph that contains a point.
+   */
+  inline unsigned long TaskBlock(unsigned long iPoint) const {
+    return (iPoint < nPointDomain)? iPoint/TaskBlockSize : nTaskBlockDomain + (iPoint-nPointDomain)/TaskBlockSize;
+  }
+
+  /*!
+   * \brief Get the first point of a block of the task graph.
+   */
+  inline unsigned long TaskBlockBegin(unsigned long iBlock) const {
+    return (iBlock < nTaskBlockDomain)? iBlock*TaskBlockSize : nPointDomain + (iBlock-nTaskBlockDomain)*TaskBlockSize;
+  }
+
+  /*!
+   * \brief Get the end of a block of the task graph.
+   */
+  inline unsigned long TaskBlockEnd(unsigned long iBlock) const {
+    return (iBlock < nTaskBlockDomain)? min(TaskBlockBegin(iBlock)+TaskBlockSize, nPointDomain) :
+                                        min(TaskBlockBegin(iBlock)+TaskBlockSize, nPoint);
+  }
+
+  /*!
+   * \brief Compute the gradients and limiters for the MUSCL reconstruction.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MUSCL_Preprocessing(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Compute the upwind (and viscous) residual of an edge, with the numerics of the calling thread.
+   * \note Used by the edge loops of Upwind_Residual and by the tasks of TaskGraph_Residual.
+   * \param[in] iEdge - Index of the edge.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \return Number of non-physical MUSCL reconstructions (0, 1, or 2).
+   */
+  unsigned long Upwind_EdgeResidual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Compute the centered (and viscous) residual of an edge, with the numerics of the calling thread.
+   * \note Used by the edge loops of Centered_Residual and by the tasks of TaskGraph_Residual.
+   * \param[in] iEdge - Index of the edge.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void Centered_EdgeResidual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                             CNumerics **numerics_container, CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Whether there are source terms computed point by point (see PointSource_Residual).
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool GetPointSources(const CConfig *config) const;
+
+  /*!
+   * \brief Compute the source terms of a range of owned points, with the numerics of the calling thread.
+   * \note The rotating frame GCL contribution is not included.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] iPointEnd - End of the range.
+   */
+  void PointSource_Residual(CGeometry *geometry, CNumerics **numerics_container, CConfig *config,
+                            unsigned long iPointBegin, unsigned long iPointEnd);
+
   /*!
    * \brief Preprocessing actions common to the Euler and NS solvers.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1086,6 +1336,19 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Update the solution using an implicit Euler scheme, with Jacobian-free products of the residual
+   *        in the linear solver (Newton-Krylov), the assembled Jacobian is only used as the preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] ComputeResidual - Computes the residual (space integration) for the current solution.
+   */
+  void ImplicitNewtonKrylov_Iteration(CGeometry *geometry,
+                                      CSolver **solver_container,
+                                      CConfig *config,
+                                      const std::function<void()>& ComputeResidual) final;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over a nonlinear iteration for stability.
    * \param[in] solver - Container vector with all the solutions.
@@ -2889,4 +3152,39 @@ public:
    */
   inline bool GetHasHybridParallel() const final { return true; }
 
+  /*!
+   * \brief The characteristic based boundary conditions, and the walls and symmetry planes, can be computed as tasks.
+   */
+  inline bool GetBC_TaskSafe(unsigned short KindBC) const final {
+    switch (KindBC) {
+      case EULER_WALL: case SYMMETRY_PLANE: case FAR_FIELD:
+      case INLET_FLOW: case OUTLET_FLOW: case SUPERSONIC_INLET: case SUPERSONIC_OUTLET:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /*!
+   * \brief Whether the residual is computed by the task graph (config option RESIDUAL_TASK_BLOCK_SIZE).
+   */
+  inline bool GetUseTaskGraph() const final { return UseTaskGraph; }
+
+  /*!
+   * \brief Compute the convective, viscous, and source residuals, and the task-safe weak boundary conditions
+   *        (and the MUSCL gradients and limiters if left by Preprocessing) as a graph of OpenMP tasks.
+   * \note The tasks are created by the master thread, which also does the halo exchanges while the tasks of
+   *       owned points execute, the other threads execute tasks at the barrier. The gradients and limiters
+   *       of all owned blocks are computed before the exchange of the halo values begins.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (all threads).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] WeakBC - Computes the weak boundary condition of a marker, with the numerics of the calling thread.
+   */
+  void TaskGraph_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
+                          CConfig *config, unsigned short iMesh,
+                          const std::function<void(unsigned short)>* WeakBC) final;
+
 };
@@ -39,6 +39,7 @@
 #include <set>
 #include <stdlib.h>
 #include <stdio.h>
+#include <functional>
 
 #include "../fluid_model.hpp"
 #include "../task_definition.hpp"
@@ -166,7 +167,7 @@ public:
   CSysVector<su2double> LinSysRes;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector<su2double> LinSysAux;    /*!< \brief vector to store iterative residual of implicit linear system. */
 #ifndef CODI_FORWARD_TYPE
-  CSysMatrix<passivedouble> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CSysMatrix<su2mixedfloat> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
   CSysSolve<passivedouble>  System;   /*!< \brief Linear solver/smoother. */
 #else
   CSysMatrix<su2double> Jacobian;
@@ -220,6 +221,15 @@ public:
                      CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Add the values of the halo points to the points that own them (reverse communication).
+   * \note Used by the multigrid restriction with MG_PARALLEL_AGGLOMERATION, where a coarse control volume
+   *       spans several ranks and each rank only sums its own children. Only one thread can call this routine.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] commType - SOLUTION, SOLUTION_OLD, EDDY_VISCOSITY, or RES_TRUNC_ERROR.
+   */
+  void AddHaloValues(CGeometry *geometry, unsigned short commType);
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI periodic communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1503,6 +1513,21 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief Update the solution using an implicit Euler scheme in Newton-Krylov mode, i.e. with
+   *        Jacobian-free products of the residual. By default the usual implicit iteration is used.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] ComputeResidual - Computes the residual (space integration) for the current solution.
+   */
+  inline virtual void ImplicitNewtonKrylov_Iteration(CGeometry *geometry,
+                                                     CSolver **solver_container,
+                                                     CConfig *config,
+                                                     const std::function<void()>& ComputeResidual) {
+    ImplicitEuler_Iteration(geometry, solver_container, config);
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Container vector with all the solutions.
@@ -3662,6 +3687,8 @@ public:
 
   /*!
    * \brief Read a native SU2 restart file in binary format.
+   * \note With MPI, each rank reads a contiguous range of points of the file (collectively), and then
+   *       sends the points to the ranks that own them, the file can be read with any number of ranks.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] val_filename - String name of the restart file.
@@ -3670,6 +3697,19 @@ public:
                                CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read a compressed native SU2 restart file (see SU2CompressedRestart).
+   * \note Each rank reads and decodes a range of blocks of the file (and of its keyframe for deltas),
+   *       and then sends the points to the ranks that need them. Called by Read_SU2_Restart_Binary
+   *       for compressed files.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file (with extension).
+   */
+  void Read_SU2_Restart_Compressed(CGeometry *geometry,
+                                   CConfig *config,
+                                   const string& val_filename);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3682,6 +3722,25 @@ public:
                                  bool adjoint_run,
                                  string val_filename);
 
+  /*!
+   * \brief Collect the solution of the owned points (and its time levels) in linear partitions, to
+   *        move it to a new partition of the grid without writing a restart file (LOAD_REBALANCE).
+   * \param[in] geometry - Geometrical definition of the problem (current partition).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] localCFL - Also move the local CFL numbers.
+   * \return Data of the points of the linear partition of this rank, by global index.
+   */
+  vector<passivedouble> GetMigrationData(CGeometry *geometry, const CConfig *config, bool localCFL) const;
+
+  /*!
+   * \brief Set the solution collected by GetMigrationData on the points of the new partition (collective).
+   * \param[in] geometry - Geometrical definition of the problem (new partition).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] localCFL - The local CFL numbers were also collected.
+   * \param[in,out] data - Data returned by GetMigrationData, it is released.
+   */
+  void SetMigrationData(CGeometry *geometry, CConfig *config, bool localCFL, vector<passivedouble>& data);
+
   /*!
    * \brief Load a inlet profile data from file into a particular solver.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4720,6 +4779,36 @@ public:
    */
   inline virtual bool GetHasHybridParallel() const { return false; }
 
+  /*!
+   * \brief Whether the weak boundary condition of a kind of marker can be computed by any thread
+   *        (as an OpenMP task) concurrently with the boundary conditions of other markers.
+   * \note This requires the boundary condition to only use local working memory and the numerics
+   *       given to it, to only update the residual and Jacobian of its own points, and to not communicate.
+   * \param[in] KindBC - Kind of boundary condition.
+   * \return Should return true if "yes", false if "no".
+   */
+  inline virtual bool GetBC_TaskSafe(unsigned short KindBC) const { return false; }
+
+  /*!
+   * \brief Whether the residual is computed by a task graph (see TaskGraph_Residual).
+   * \return Should return true if "yes", false if "no".
+   */
+  inline virtual bool GetUseTaskGraph() const { return false; }
+
+  /*!
+   * \brief Compute the convective, viscous, and source residuals, and the task-safe weak boundary
+   *        conditions, as a graph of OpenMP tasks. Called by all threads.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (all threads).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] WeakBC - Computes the weak boundary condition of a marker, with the numerics of the calling thread.
+   */
+  inline virtual void TaskGraph_Residual(CGeometry *geometry, CSolver **solver_container,
+                                         CNumerics **numerics_container, CConfig *config, unsigned short iMesh,
+                                         const std::function<void(unsigned short)>* WeakBC) { }
+
 protected:
   /*!
    * \brief Allocate the memory for the verification solution, if necessary.
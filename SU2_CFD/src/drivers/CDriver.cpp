@@ -30,6 +30,7 @@
 
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/geometry/meshreader/CPartitionedMeshReaderFVM.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
@@ -659,7 +660,7 @@ void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
-void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy){
+void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy, CGeometry *geometry_aux){
 
   if (!dummy){
     if (rank == MASTER_NODE)
@@ -674,7 +675,7 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
       }
     }
     else {
-      Geometrical_Preprocessing_FVM(config, geometry);
+      Geometrical_Preprocessing_FVM(config, geometry, geometry_aux);
     }
   } else {
     if (rank == MASTER_NODE)
@@ -770,7 +771,7 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
 
 }
 
-void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry) {
+void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geometry, CGeometry *geometry_aux) {
 
   unsigned short iZone = config->GetiZone(), iMGlevel;
   unsigned short requestedMGlevels = config->GetnMGLevels();
@@ -778,21 +779,22 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   bool fea = false;
 
   /*--- Definition of the geometry class to store the primal grid in the
-     partitioning process. ---*/
+     partitioning process (unless it is given, already colored). ---*/
 
-  CGeometry *geometry_aux = NULL;
+  if (geometry_aux == NULL) {
 
-  /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
+    /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
 
-  geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+    geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
 
-  /*--- Set the dimension --- */
+    /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
 
-  nDim = geometry_aux->GetnDim();
+    geometry_aux->SetColorGrid_Parallel(config);
+  }
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  /*--- Set the dimension --- */
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  nDim = geometry_aux->GetnDim();
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -822,15 +824,32 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee ordering (bandwidth of the matrices)
+   or a space-filling curve (locality of the edge loops) ---*/
+
+  const auto pointOrdering = config->GetKind_PointOrdering();
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (pointOrdering != NO_POINT_ORDERING) {
+    if (pointOrdering == RCM_ORDERING) {
+      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      geometry[MESH_0]->SetRCM_Ordering(config);
+    }
+    else {
+      if (rank == MASTER_NODE)
+        cout << "Renumbering points (" << ((pointOrdering == HILBERT_ORDERING)? "Hilbert" : "Morton")
+             << " space-filling curve)." << endl;
+      geometry[MESH_0]->SetSFC_Ordering(config);
+    }
 
-  /*--- recompute elements surrounding points, points surrounding points ---*/
+    /*--- recompute elements surrounding points, points surrounding points ---*/
 
-  if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-  geometry[MESH_0]->SetPoint_Connectivity();
+    if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+    geometry[MESH_0]->SetPoint_Connectivity();
+  }
+
+  /*--- Sort the edges by their (lower, higher) point ---*/
+
+  if (config->GetSortEdges()) geometry[MESH_0]->SortPoint_Connectivity();
 
   /*--- Compute elements surrounding elements ---*/
 
@@ -901,6 +920,11 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if ((config->GetnMGLevels() != 0) && (rank == MASTER_NODE))
     cout << "Setting the multigrid structure." << endl;
 
+  /*--- Create the data structure for MPI point-to-point communications, each coarse
+   level needs it before the control volumes are computed, and to agglomerate the next. ---*/
+
+  geometry[MESH_0]->PreprocessP2PComms(geometry[MESH_0], config);
+
   /*--- Loop over all the new grid ---*/
 
   for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
@@ -917,6 +941,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
     geometry[iMGlevel]->SetEdges();
     geometry[iMGlevel]->SetVertex(geometry[iMGlevel-1], config);
+    geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
 
     /*--- Create the control volume structures ---*/
 
@@ -965,12 +990,6 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   }
 
 
-  /*--- Create the data structure for MPI point-to-point communications. ---*/
-
-  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
-    geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
-
-
   /*--- Perform a few preprocessing routines and communications. ---*/
 
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
@@ -2946,6 +2965,96 @@ void CDriver::StaticMesh_Preprocessing(CConfig *config, CGeometry** geometry, CS
 
 }
 
+void CDriver::Repartition(const vector<passivedouble>& rankTime) {
+
+  /*--- Single zone problems, the members are used by the preprocessing routines. ---*/
+
+  iZone = ZONE_0;
+  iInst = INST_0;
+
+  CConfig *config = config_container[ZONE_0];
+  const auto kindSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------- Repartitioning the Grid -------------------------" << endl;
+
+  /*--- Complete the pending output, the data sorters depend on the partition. ---*/
+
+  output_container[ZONE_0]->ClearGeometryData();
+
+  /*--- Collect the solution of each solver in linear partitions (the local CFL of the flow solver). ---*/
+
+  vector<vector<passivedouble> > migrationData(MAX_SOLS);
+
+  for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+    auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (solver != nullptr)
+      migrationData[iSol] = solver->GetMigrationData(geometry_container[ZONE_0][INST_0][MESH_0], config, iSol == FLOW_SOL);
+  }
+
+  /*--- Move the grid back to linear partitions, recording the current rank of each point. ---*/
+
+  CPhysicalGeometry *geometry_aux = nullptr;
+  vector<int> previousOwner;
+  {
+    auto geometry = dynamic_cast<CPhysicalGeometry*>(geometry_container[ZONE_0][INST_0][MESH_0]);
+    CPartitionedMeshReaderFVM meshReader(config, ZONE_0, nZone, geometry);
+    geometry_aux = new CPhysicalGeometry(config, ZONE_0, nZone, &meshReader);
+    previousOwner = meshReader.GetPreviousOwner();
+  }
+
+  /*--- Delete everything that depends on the partition. ---*/
+
+  Numerics_Postprocessing(numerics_container[ZONE_0], solver_container[ZONE_0][INST_0],
+                          geometry_container[ZONE_0][INST_0], config, INST_0);
+  Integration_Postprocessing(integration_container[ZONE_0], geometry_container[ZONE_0][INST_0], config, INST_0);
+  Solver_Postprocessing(solver_container[ZONE_0], geometry_container[ZONE_0][INST_0], config, INST_0);
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+    delete geometry_container[ZONE_0][INST_0][iMesh];
+  delete [] geometry_container[ZONE_0][INST_0];
+
+  /*--- Adaptive repartitioning, and the usual preprocessing of the geometry. ---*/
+
+  geometry_aux->SetColorGrid_Parallel(config, previousOwner, rankTime);
+  vector<int>().swap(previousOwner);
+
+  Geometrical_Preprocessing(config, geometry_container[ZONE_0][INST_0], false, geometry_aux);
+
+  CGeometry **geometry = geometry_container[ZONE_0][INST_0];
+
+  /*--- New solvers, the solution is moved instead of being read from restart files. ---*/
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"-------------------- Solver Preprocessing ( Zone " << config->GetiZone() <<" ) --------------------" << endl;
+
+  CSolver ***solver = new CSolver**[config->GetnMGLevels()+1];
+  solver_container[ZONE_0][INST_0] = solver;
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+    solver[iMesh] = CSolverFactory::createSolverContainer(kindSolver, config, geometry[iMesh], iMesh);
+
+  Inlet_Preprocessing(solver, geometry, config);
+
+  for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+    if (solver[MESH_0][iSol] != nullptr)
+      solver[MESH_0][iSol]->SetMigrationData(geometry[MESH_0], config, iSol == FLOW_SOL, migrationData[iSol]);
+  }
+
+  /*--- Primitive variables and eddy viscosity, as after reading a restart. ---*/
+
+  solver[MESH_0][FLOW_SOL]->Preprocessing(geometry[MESH_0], solver[MESH_0], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  if (solver[MESH_0][TURB_SOL] != nullptr)
+    solver[MESH_0][TURB_SOL]->Postprocessing(geometry[MESH_0], solver[MESH_0], config, MESH_0);
+
+  Numerics_Preprocessing(config, geometry, solver, numerics_container[ZONE_0][INST_0]);
+
+  Integration_Preprocessing(config, solver[MESH_0], integration_container[ZONE_0][INST_0]);
+
+  StaticMesh_Preprocessing(config, geometry, surface_movement[ZONE_0]);
+
+}
+
 void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COutput **&output, COutput *&driver_output){
 
   /*--- Definition of the output class (one for each zone). The output class
@@ -38,6 +38,14 @@ CSinglezoneDriver::CSinglezoneDriver(char* confFile,
   /*--- Initialize the counter for TimeIter ---*/
   TimeIter = 0;
 
+  /*--- The iteration repartitions the grid between inner iterations if the load is imbalanced. ---*/
+
+  if (config_container[ZONE_0]->GetLoadRebalance()) {
+    iteration_container[ZONE_0][INST_0]->SetRepartition([this](const vector<passivedouble>& rankTime) {
+      Repartition(rankTime);
+    });
+  }
+
 }
 
 CSinglezoneDriver::~CSinglezoneDriver(void) {
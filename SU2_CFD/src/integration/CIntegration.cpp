@@ -28,6 +28,21 @@
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
+namespace {
+
+/*!
+ * \brief Wall time in seconds, only needed to monitor the load balance between MPI ranks.
+ */
+inline passivedouble WallTime() {
+#ifdef HAVE_MPI
+  return MPI_Wtime();
+#else
+  return 0.0;
+#endif
+}
+
+}
+
 
 CIntegration::CIntegration() {
   rank = SU2_MPI::GetRank();
@@ -43,12 +58,36 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
-  unsigned short iMarker, KindBC;
+  unsigned short iMarker;
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
   bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == DT_STEPPING_2ND));
 
+  /*--- The master thread measures the time of the computations that do not communicate
+   (all but the interface and periodic BCs) to monitor the load balance. ---*/
+
+  passivedouble startTime = 0.0;
+  SU2_OMP_MASTER
+  startTime = WallTime();
+
+  const bool taskGraph = solver_container[MainSolver]->GetUseTaskGraph();
+
+  if (taskGraph) {
+
+    /*--- Convective, viscous, and source residuals, and task-safe weak boundary conditions, as a graph of
+     tasks, the boundary conditions use the numerics of the thread that executes them. ---*/
+
+    const std::function<void(unsigned short)> WeakBC = [&](unsigned short iMarker) {
+      const int thread = omp_get_thread_num();
+      Weak_BC(geometry, solver_container, numerics[CONV_BOUND_TERM + thread*MAX_TERMS],
+              numerics[VISC_BOUND_TERM + thread*MAX_TERMS], config, MainSolver, iMarker);
+    };
+
+    solver_container[MainSolver]->TaskGraph_Residual(geometry, solver_container, numerics, config, iMesh, &WeakBC);
+  }
+  else {
+
   /*--- Compute inviscid residuals ---*/
 
   switch (config->GetKind_ConvNumScheme()) {
@@ -71,20 +110,27 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
 
+  }
+
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
   if (dual_time)
     solver_container[MainSolver]->SetResidual_DualTime(geometry, solver_container, config, iRKStep, iMesh, RunTime_EqSystem);
 
-  /// TODO: No boundary condition supports hybrid parallelism yet, master thread does all the work.
+  /*--- The master thread does the boundary conditions, the task-safe weak boundary
+   conditions are computed by all threads as OpenMP tasks (see Weak_BC_Tasks). ---*/
 
   SU2_OMP_MASTER
   {
 
+  ResidualTime += WallTime() - startTime;
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config);
 
+  startTime = WallTime();
+
   /*--- Compute Fourier Transformations for markers where NRBC_BOUNDARY is applied---*/
 
   if (config->GetBoolGiles() && config->GetSpatialFourier()){
@@ -93,62 +139,27 @@ void CIntegration::Space_Integration(CGeometry *geometry,
     solver_container[MainSolver]->PreprocessBC_Giles(geometry, config, numerics[CONV_BOUND_TERM], OUTFLOW);
   }
 
-  /*--- Weak boundary conditions ---*/
+  /*--- Weak boundary conditions, computed concurrently with OpenMP tasks
+   when multiple threads are available and the solver supports it. ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    KindBC = config->GetMarker_All_KindBC(iMarker);
-    switch (KindBC) {
-      case EULER_WALL:
-        solver_container[MainSolver]->BC_Euler_Wall(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ACTDISK_INLET:
-        solver_container[MainSolver]->BC_ActDisk_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ENGINE_INFLOW:
-        solver_container[MainSolver]->BC_Engine_Inflow(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case INLET_FLOW:
-        solver_container[MainSolver]->BC_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ACTDISK_OUTLET:
-        solver_container[MainSolver]->BC_ActDisk_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ENGINE_EXHAUST:
-        solver_container[MainSolver]->BC_Engine_Exhaust(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SUPERSONIC_INLET:
-        solver_container[MainSolver]->BC_Supersonic_Inlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case OUTLET_FLOW:
-        solver_container[MainSolver]->BC_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SUPERSONIC_OUTLET:
-        solver_container[MainSolver]->BC_Supersonic_Outlet(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case GILES_BOUNDARY:
-        solver_container[MainSolver]->BC_Giles(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case RIEMANN_BOUNDARY:
-        if (config->GetBoolTurbomachinery()){
-          solver_container[MainSolver]->BC_TurboRiemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        }
-        else{
-          solver_container[MainSolver]->BC_Riemann(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        }
-        break;
-      case FAR_FIELD:
-        solver_container[MainSolver]->BC_Far_Field(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case SYMMETRY_PLANE:
-        solver_container[MainSolver]->BC_Sym_Plane(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM], config, iMarker);
-        break;
-      case ELECTRODE_BOUNDARY:
-        solver_container[MainSolver]->BC_Electrode(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
-        break;
-      case DIELEC_BOUNDARY:
-        solver_container[MainSolver]->BC_Dielec(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
-        break;
-    }
+  bool anyTaskSafe = false;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    anyTaskSafe |= solver_container[MainSolver]->GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker));
+
+  if (taskGraph) {
+    /*--- The task-safe ones were computed by the task graph. ---*/
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+      if (!solver_container[MainSolver]->GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker)))
+        Weak_BC(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM],
+                config, MainSolver, iMarker);
+  }
+  else if (anyTaskSafe && (omp_get_num_threads() > 1)) {
+    Weak_BC_Tasks(geometry, solver_container, numerics, config, MainSolver);
+  }
+  else {
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+      Weak_BC(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM],
+              config, MainSolver, iMarker);
   }
 
   /*--- Strong boundary conditions (Navier-Stokes and Dirichlet type BCs) ---*/
@@ -174,6 +185,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         break;
     }
 
+  ResidualTime += WallTime() - startTime;
+
   /*--- Complete residuals for periodic boundary conditions. We loop over
    the periodic BCs in matching pairs so that, in the event that there are
    adjacent periodic markers, the repeated points will have their residuals
@@ -188,6 +201,108 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
 }
 
+void CIntegration::Weak_BC(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                           CNumerics *visc_numerics, CConfig *config, unsigned short MainSolver,
+                           unsigned short iMarker) const {
+
+  CSolver* solver = solver_container[MainSolver];
+  const auto KindBC = config->GetMarker_All_KindBC(iMarker);
+
+  switch (KindBC) {
+    case EULER_WALL:
+      solver->BC_Euler_Wall(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case ACTDISK_INLET:
+      solver->BC_ActDisk_Inlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case ENGINE_INFLOW:
+      solver->BC_Engine_Inflow(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case INLET_FLOW:
+      solver->BC_Inlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case ACTDISK_OUTLET:
+      solver->BC_ActDisk_Outlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case ENGINE_EXHAUST:
+      solver->BC_Engine_Exhaust(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case SUPERSONIC_INLET:
+      solver->BC_Supersonic_Inlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case OUTLET_FLOW:
+      solver->BC_Outlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case SUPERSONIC_OUTLET:
+      solver->BC_Supersonic_Outlet(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case GILES_BOUNDARY:
+      solver->BC_Giles(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case RIEMANN_BOUNDARY:
+      if (config->GetBoolTurbomachinery()){
+        solver->BC_TurboRiemann(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      }
+      else{
+        solver->BC_Riemann(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      }
+      break;
+    case FAR_FIELD:
+      solver->BC_Far_Field(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case SYMMETRY_PLANE:
+      solver->BC_Sym_Plane(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker);
+      break;
+    case ELECTRODE_BOUNDARY:
+      solver->BC_Electrode(geometry, solver_container, conv_numerics, config, iMarker);
+      break;
+    case DIELEC_BOUNDARY:
+      solver->BC_Dielec(geometry, solver_container, conv_numerics, config, iMarker);
+      break;
+  }
+
+}
+
+void CIntegration::Weak_BC_Tasks(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                 CConfig *config, unsigned short MainSolver) const {
+
+  const CSolver* solver = solver_container[MainSolver];
+  const auto& coloring = geometry->GetMarkerColoring(config);
+
+  for (auto color = 0ul; color < coloring.getOuterSize(); ++color) {
+
+    /*--- Markers of the same color do not share points, the task-safe ones
+     are computed by any thread, with the numerics of that thread. ---*/
+
+    for (auto k = 0ul; k < coloring.getNumNonZeros(color); ++k) {
+      const unsigned short iMarker = coloring.getInnerIdx(color, k);
+      if (!solver->GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker))) continue;
+
+      SU2_OMP_TASK
+      {
+        const int thread = omp_get_thread_num();
+        Weak_BC(geometry, solver_container, numerics[CONV_BOUND_TERM + thread*MAX_TERMS],
+                numerics[VISC_BOUND_TERM + thread*MAX_TERMS], config, MainSolver, iMarker);
+      }
+    }
+
+    /*--- The other markers are computed by this thread in the meantime. ---*/
+
+    for (auto k = 0ul; k < coloring.getNumNonZeros(color); ++k) {
+      const unsigned short iMarker = coloring.getInnerIdx(color, k);
+      if (solver->GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker))) continue;
+
+      Weak_BC(geometry, solver_container, numerics[CONV_BOUND_TERM], numerics[VISC_BOUND_TERM],
+              config, MainSolver, iMarker);
+    }
+
+    /*--- The next color may update the same points. ---*/
+
+    SU2_OMP_TASKWAIT
+  }
+
+}
+
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
 
@@ -135,6 +135,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const bool classical_rk4 = (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT);
+  const bool newton_krylov = config->GetNewtonKrylov() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (iMesh == MESH_0);
 
   /*--- Shorter names to refer to fine grid entities. ---*/
 
@@ -195,9 +196,27 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
 
-      /*--- Time integration, update solution using the old solution plus the solution increment ---*/
+      /*--- Time integration, update solution using the old solution plus the solution increment.
+       *    In Newton-Krylov mode the solver computes the residual (space integration) in the linear solver. ---*/
 
-      Time_Integration(geometry_fine, solver_container_fine, config, iRKStep, RunTime_EqSystem);
+      if (newton_krylov) {
+        auto ComputeResidual = [&]() {
+          /*--- The residuals of the Jacobian-free products are not counted in the load balance
+           measurements, only the residual of each nonlinear iteration is. ---*/
+          passivedouble residualTime = 0.0;
+          SU2_OMP_MASTER
+          residualTime = GetResidualTime();
+
+          Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
+
+          SU2_OMP_MASTER
+          SetResidualTime(residualTime);
+        };
+        solver_fine->ImplicitNewtonKrylov_Iteration(geometry_fine, solver_container_fine, config, ComputeResidual);
+      }
+      else {
+        Time_Integration(geometry_fine, solver_container_fine, config, iRKStep, RunTime_EqSystem);
+      }
 
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
 
@@ -297,10 +316,16 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
   const unsigned short nVar = sol_coarse->GetnVar();
 
+  /*--- With the parallel agglomeration the halo CVs also have children (on this rank), their partial
+   sums are added to the owners by a reverse communication, and then the halos receive the total. ---*/
+
+  const bool parallelAgglomeration = config->GetMG_ParallelAgglomeration();
+  const unsigned long nPointCoarse = parallelAgglomeration? geo_coarse->GetnPoint() : geo_coarse->GetnPointDomain();
+
   su2double *Solution = new su2double[nVar];
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
 
     Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
 
@@ -314,10 +339,12 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
     }
 
-    Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
+    if (Point_Coarse < geo_coarse->GetnPointDomain()) {
+      Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
 
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] += Solution_Coarse[iVar];
+      for (iVar = 0; iVar < nVar; iVar++)
+        Solution[iVar] += Solution_Coarse[iVar];
+    }
 
     for (iVar = 0; iVar < nVar; iVar++)
       sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
@@ -325,6 +352,12 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
   delete [] Solution;
 
+  if (parallelAgglomeration) {
+    SU2_OMP_MASTER
+    sol_coarse->AddHaloValues(geo_coarse, SOLUTION_OLD);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Remove any contributions from no-slip walls. ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -358,8 +391,8 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
   /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
       Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
       sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
@@ -475,10 +508,15 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   unsigned long Point_Fine, Point_Coarse;
   unsigned short iChildren;
 
+  /*--- With the parallel agglomeration the halo CVs may have children on this rank. ---*/
+
+  const unsigned long nPointCoarse = config->GetMG_ParallelAgglomeration()? geo_coarse->GetnPoint() :
+                                                                            geo_coarse->GetnPointDomain();
+
   /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
       Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
       sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
@@ -496,10 +534,15 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
 
+  /*--- With the parallel agglomeration the residuals restricted to the halo CVs are added to the owners. ---*/
+
+  const bool parallelAgglomeration = config->GetMG_ParallelAgglomeration();
+  const unsigned long nPointCoarse = parallelAgglomeration? geo_coarse->GetnPoint() : geo_coarse->GetnPointDomain();
+
   su2double *Residual = new su2double[nVar];
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
 
     sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
 
@@ -516,6 +559,12 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
   delete [] Residual;
 
+  if (parallelAgglomeration) {
+    SU2_OMP_MASTER
+    sol_coarse->AddHaloValues(geo_coarse, RES_TRUNC_ERROR);
+    SU2_OMP_BARRIER
+  }
+
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
@@ -557,12 +606,17 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   const unsigned short nDim = geo_fine->GetnDim();
   const bool grid_movement = config->GetGrid_Movement();
 
+  /*--- With the parallel agglomeration the halo CVs also have children (see GetProlongated_Correction). ---*/
+
+  const bool parallelAgglomeration = config->GetMG_ParallelAgglomeration();
+  const unsigned long nPointCoarse = parallelAgglomeration? geo_coarse->GetnPoint() : geo_coarse->GetnPointDomain();
+
   su2double *Solution = new su2double[nVar];
 
   /*--- Compute coarse solution from fine solution ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
 
     Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
 
@@ -584,6 +638,12 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
   delete [] Solution;
 
+  if (parallelAgglomeration) {
+    SU2_OMP_MASTER
+    sol_coarse->AddHaloValues(geo_coarse, SOLUTION);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Update the solution at the no-slip walls ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -118,12 +118,18 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
 
   unsigned short nVar = sol_coarse->GetnVar();
 
+  /*--- With the parallel agglomeration the halo CVs also have children on this rank, their partial
+   sums are added to the owners by a reverse communication. ---*/
+
+  const bool parallelAgglomeration = config->GetMG_ParallelAgglomeration();
+  const unsigned long nPointCoarse = parallelAgglomeration? geo_coarse->GetnPoint() : geo_coarse->GetnPointDomain();
+
   su2double *Solution = new su2double[nVar];
 
   /*--- Compute coarse solution from fine solution ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
 
     Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
 
@@ -144,6 +150,12 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
 
   delete [] Solution;
 
+  if (parallelAgglomeration) {
+    SU2_OMP_MASTER
+    sol_coarse->AddHaloValues(geo_coarse, SOLUTION);
+    SU2_OMP_BARRIER
+  }
+
   /*--- MPI the new interpolated solution ---*/
 
   SU2_OMP_MASTER
@@ -162,10 +174,15 @@ void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSys
   unsigned short iMarker, iChildren;
   su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
 
+  /*--- With the parallel agglomeration the halo CVs also have children (see SetRestricted_Solution). ---*/
+
+  const bool parallelAgglomeration = config->GetMG_ParallelAgglomeration();
+  const unsigned long nPointCoarse = parallelAgglomeration? geo_coarse->GetnPoint() : geo_coarse->GetnPointDomain();
+
   /*--- Compute coarse Eddy Viscosity from fine solution ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointCoarse, omp_get_num_threads()))
+  for (Point_Coarse = 0; Point_Coarse < nPointCoarse; Point_Coarse++) {
 
     Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
 
@@ -182,6 +199,12 @@ void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSys
 
   }
 
+  if (parallelAgglomeration) {
+    SU2_OMP_MASTER
+    sol_coarse->AddHaloValues(geo_coarse, EDDY_VISCOSITY);
+    SU2_OMP_BARRIER
+  }
+
   /*--- Update solution at the no slip wall boundary, only the first
    variable (nu_tilde -in SA and SA_NEG- and k -in SST-), to guarantee that the eddy viscoisty
    is zero on the surface ---*/
@@ -321,6 +321,13 @@ void CIteration::SetGrid_Movement(CGeometry **geometry,
     grid_movement->UpdateMultiGrid(geometry, config);
 
   }
+
+  /*--- Keep the wall distance of the turbulence models up to date, the incremental update
+   only searches again for the points near the parts of the mesh that moved (if any). ---*/
+
+  if (config->GetWallDistance_Incremental() && (config->GetKind_Turb_Model() != NONE))
+    geometry[MESH_0]->ComputeWall_Distance(config);
+
 }
 
 void CIteration::SetMesh_Deformation(CGeometry **geometry,
@@ -349,6 +356,12 @@ void CIteration::SetMesh_Deformation(CGeometry **geometry,
 
     solver[MESH_SOL]->DeformMesh(geometry, numerics[MESH_SOL], config);
 
+    /*--- Keep the wall distance of the turbulence models up to date, the incremental
+     update only searches again for the points near the parts of the mesh that moved. ---*/
+
+    if (config->GetWallDistance_Incremental() && (config->GetKind_Turb_Model() != NONE))
+      geometry[MESH_0]->ComputeWall_Distance(config);
+
     if (ActiveTape) {
       /*--- Start recording if it was stopped ---*/
       AD::StartRecording();
@@ -357,6 +370,52 @@ void CIteration::SetMesh_Deformation(CGeometry **geometry,
 
 }
 
+void CIteration::CheckLoadBalance(CIntegration **integration, const CConfig *config) {
+
+  const unsigned long freq = config->GetLoadImbalance_Freq();
+  if ((freq == 0) || (size == SINGLE_NODE) || (++nIter_LoadBalance < freq)) return;
+  nIter_LoadBalance = 0;
+
+  /*--- Time of this rank since the last check, for all the solvers. ---*/
+
+  passivedouble localTime = 0.0;
+  for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+    if (integration[iSol] == nullptr) continue;
+    localTime += integration[iSol]->GetResidualTime();
+    integration[iSol]->SetResidualTime(0.0);
+  }
+
+  /*--- Passive data, hence the base wrapper (no AD types). All ranks get the times
+   so that they all take the same decision about repartitioning. ---*/
+
+  vector<passivedouble> rankTime(size);
+  CBaseMPIWrapper::Allgather(&localTime, 1, MPI_DOUBLE, rankTime.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  const auto slowest = max_element(rankTime.begin(), rankTime.end());
+  passivedouble avgTime = 0.0;
+  for (auto time : rankTime) avgTime += time / size;
+
+  if (avgTime <= 0.0) return;
+  const passivedouble imbalance = *slowest / avgTime - 1.0;
+
+  if (imbalance <= SU2_TYPE::GetValue(config->GetLoadImbalance_Threshold())) return;
+
+  const bool rebalance = config->GetLoadRebalance() && Repartition;
+
+  if (rank == MASTER_NODE) {
+    cout << "WARNING: The residual computations are " << int(100.0*imbalance+0.5) << "% imbalanced, the slowest rank is "
+         << (slowest - rankTime.begin()) << "." << endl;
+    if (rebalance)
+      cout << "Repartitioning the grid after this iteration." << endl;
+    else
+      cout << "Consider LOAD_REBALANCE, or restarting with PARMETIS_EDGE_WEIGHT and/or PARMETIS_BOUNDARY_WEIGHT "
+           << "(the restart files can be read with any number of ranks)." << endl;
+  }
+
+  if (rebalance) rankResidualTime = rankTime;
+
+}
+
 
 
 void CIteration::Preprocess(COutput *output,
@@ -580,6 +639,10 @@ void CFluidIteration::Iterate(COutput *output,
                                                                      RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
   }
 
+  /*--- Monitor the load balance of the residual computations. ---*/
+
+  CheckLoadBalance(integration[val_iZone][val_iInst], config[val_iZone]);
+
   /*--- Adapt the CFL number using an exponential progression
    with under-relaxation approach. ---*/
 
@@ -793,6 +856,13 @@ void CFluidIteration::Solve(COutput *output,
 
     /*--- If the iteration has converged, break the loop ---*/
     if (StopCalc) break;
+
+    /*--- Move the problem to a new partition of the grid if the last check of the
+     load balance requested it (LOAD_REBALANCE), the containers are then new. ---*/
+    if (!rankResidualTime.empty()) {
+      Repartition(rankResidualTime);
+      rankResidualTime.clear();
+    }
   }
 
   if (multizone && steady) {
@@ -0,0 +1,970 @@
+/*!
+ * \file batched_fluxes.cpp
+ * \brief Implementations of the vectorized (batched) convective schemes.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../../include/numerics/flow/convection/batched_fluxes.hpp"
+
+/*--- The number of dimensions is a template parameter of the schemes so that all
+ *    loops have compile-time bounds, which allows the compiler to fully unroll them
+ *    and keep the (small) matrices in registers. The algebra follows the order of
+ *    operations of the scalar implementations. ---*/
+
+namespace {
+
+using Double = CBatchedConvectiveFlux::Double;
+using Input = CBatchedConvectiveFlux::Input;
+using Output = CBatchedConvectiveFlux::Output;
+constexpr size_t MAXNDIM = CBatchedConvectiveFlux::MAXNDIM;
+constexpr size_t MAXNVAR = CBatchedConvectiveFlux::MAXNVAR;
+
+/*!
+ * \brief Primitive variables of one side of the edges, plus derived quantities.
+ */
+template<size_t nDim>
+struct CFlowState {
+  Double velocity[MAXNDIM], pressure, density, enthalpy, energy;
+
+  CFlowState(const Double* V) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      velocity[iDim] = V[iDim+1];
+    pressure = V[nDim+1];
+    density  = V[nDim+2];
+    enthalpy = V[nDim+3];
+    energy = enthalpy - pressure/density;
+  }
+
+  /*!
+   * \brief Conservative variables.
+   */
+  void GetConservative(Double* U) const {
+    U[0] = density;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      U[iDim+1] = density*velocity[iDim];
+    U[nDim+1] = density*energy;
+  }
+};
+
+template<size_t nDim>
+inline Double dotProd(const Double* a, const Double* b) {
+  Double sum = a[0]*b[0];
+  for (size_t iDim = 1; iDim < nDim; ++iDim) sum += a[iDim]*b[iDim];
+  return sum;
+}
+
+/*!
+ * \brief Projected inviscid flux, see CNumerics::GetInviscidProjFlux.
+ */
+template<size_t nDim>
+void InviscidProjFlux(const Double& density, const Double* velocity, const Double& pressure,
+                      const Double& enthalpy, const Double* normal, Double* flux) {
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    const Double rhoU = density*velocity[iDim];
+    Double flux_d[MAXNVAR];
+
+    flux_d[0] = rhoU*normal[iDim];
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      flux_d[jDim+1] = (jDim == iDim)? (rhoU*velocity[jDim]+pressure)*normal[iDim] : rhoU*velocity[jDim]*normal[iDim];
+    flux_d[nDim+1] = rhoU*enthalpy*normal[iDim];
+
+    for (size_t iVar = 0; iVar < nDim+2; ++iVar) {
+      if (iDim == 0) flux[iVar] = flux_d[iVar];
+      else flux[iVar] += flux_d[iVar];
+    }
+  }
+}
+
+/*!
+ * \brief Projected inviscid flux Jacobian, see CNumerics::GetInviscidProjJac.
+ */
+template<size_t nDim>
+void InviscidProjJac(passivedouble gamma, const Double* velocity, const Double& energy,
+                     const Double* normal, passivedouble scale, Double (*jac)[MAXNVAR]) {
+  const passivedouble gm1 = gamma - 1.0;
+
+  const Double sqvel = dotProd<nDim>(velocity, velocity);
+  const Double projVel = dotProd<nDim>(velocity, normal);
+  const Double phi = 0.5*gm1*sqvel;
+  const Double a1 = gamma*energy - phi;
+
+  jac[0][0] = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    jac[0][iDim+1] = scale*normal[iDim];
+  jac[0][nDim+1] = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac[iDim+1][0] = scale*(normal[iDim]*phi - velocity[iDim]*projVel);
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      jac[iDim+1][jDim+1] = scale*(normal[jDim]*velocity[iDim] - gm1*normal[iDim]*velocity[jDim]);
+    jac[iDim+1][iDim+1] += scale*projVel;
+    jac[iDim+1][nDim+1] = scale*gm1*normal[iDim];
+  }
+
+  jac[nDim+1][0] = scale*projVel*(phi-a1);
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    jac[nDim+1][iDim+1] = scale*(normal[iDim]*a1 - gm1*velocity[iDim]*projVel);
+  jac[nDim+1][nDim+1] = scale*gamma*projVel;
+}
+
+/*!
+ * \brief Right eigenvectors of the projected flux Jacobian, see CNumerics::GetPMatrix.
+ */
+template<size_t nDim>
+void PMatrix(passivedouble gamma, const Double& density, const Double* velocity,
+             const Double& soundSpeed, const Double* normal, Double (*P)[MAXNVAR]) {
+  const passivedouble gm1 = gamma - 1.0;
+
+  const Double rhooc = density / soundSpeed;
+  const Double rhoxc = density * soundSpeed;
+  const Double sqvel = dotProd<nDim>(velocity, velocity);
+
+  if (nDim == 2) {
+    P[0][0] = 1.0;
+    P[0][1] = 0.0;
+    P[0][2] = 0.5*rhooc;
+    P[0][3] = 0.5*rhooc;
+
+    P[1][0] = velocity[0];
+    P[1][1] = density*normal[1];
+    P[1][2] = 0.5*(velocity[0]*rhooc + normal[0]*density);
+    P[1][3] = 0.5*(velocity[0]*rhooc - normal[0]*density);
+
+    P[2][0] = velocity[1];
+    P[2][1] = -density*normal[0];
+    P[2][2] = 0.5*(velocity[1]*rhooc + normal[1]*density);
+    P[2][3] = 0.5*(velocity[1]*rhooc - normal[1]*density);
+
+    P[3][0] = 0.5*sqvel;
+    P[3][1] = density*velocity[0]*normal[1] - density*velocity[1]*normal[0];
+    P[3][2] = 0.5*(0.5*sqvel*rhooc + density*velocity[0]*normal[0] + density*velocity[1]*normal[1] + rhoxc/gm1);
+    P[3][3] = 0.5*(0.5*sqvel*rhooc - density*velocity[0]*normal[0] - density*velocity[1]*normal[1] + rhoxc/gm1);
+  }
+  else {
+    const Double projVel = velocity[0]*normal[0] + velocity[1]*normal[1] + velocity[2]*normal[2];
+
+    P[0][0] = normal[0];
+    P[0][1] = normal[1];
+    P[0][2] = normal[2];
+    P[0][3] = 0.5*rhooc;
+    P[0][4] = 0.5*rhooc;
+
+    P[1][0] = velocity[0]*normal[0];
+    P[1][1] = velocity[0]*normal[1] - density*normal[2];
+    P[1][2] = velocity[0]*normal[2] + density*normal[1];
+    P[1][3] = 0.5*(velocity[0]*rhooc + density*normal[0]);
+    P[1][4] = 0.5*(velocity[0]*rhooc - density*normal[0]);
+
+    P[2][0] = velocity[1]*normal[0] + density*normal[2];
+    P[2][1] = velocity[1]*normal[1];
+    P[2][2] = velocity[1]*normal[2] - density*normal[0];
+    P[2][3] = 0.5*(velocity[1]*rhooc + density*normal[1]);
+    P[2][4] = 0.5*(velocity[1]*rhooc - density*normal[1]);
+
+    P[3][0] = velocity[2]*normal[0] - density*normal[1];
+    P[3][1] = velocity[2]*normal[1] + density*normal[0];
+    P[3][2] = velocity[2]*normal[2];
+    P[3][3] = 0.5*(velocity[2]*rhooc + density*normal[2]);
+    P[3][4] = 0.5*(velocity[2]*rhooc - density*normal[2]);
+
+    P[4][0] = 0.5*sqvel*normal[0] + density*velocity[1]*normal[2] - density*velocity[2]*normal[1];
+    P[4][1] = 0.5*sqvel*normal[1] - density*velocity[0]*normal[2] + density*velocity[2]*normal[0];
+    P[4][2] = 0.5*sqvel*normal[2] + density*velocity[0]*normal[1] - density*velocity[1]*normal[0];
+    P[4][3] = 0.5*(0.5*sqvel*rhooc + density*projVel + rhoxc/gm1);
+    P[4][4] = 0.5*(0.5*sqvel*rhooc - density*projVel + rhoxc/gm1);
+  }
+}
+
+/*!
+ * \brief Left eigenvectors of the projected flux Jacobian, see CNumerics::GetPMatrix_inv.
+ */
+template<size_t nDim>
+void PMatrixInv(passivedouble gamma, const Double& density, const Double* velocity,
+                const Double& soundSpeed, const Double* normal, Double (*invP)[MAXNVAR]) {
+  const passivedouble gm1 = gamma - 1.0;
+
+  const Double rhoxc = density * soundSpeed;
+  const Double c2 = soundSpeed * soundSpeed;
+  const Double sqvel = dotProd<nDim>(velocity, velocity);
+
+  if (nDim == 2) {
+    const Double k0orho = normal[0] / density;
+    const Double k1orho = normal[1] / density;
+    const Double gm1_o_c2 = gm1 / c2;
+    const Double gm1_o_rhoxc = gm1 / rhoxc;
+
+    invP[0][0] = 1.0 - 0.5*gm1_o_c2*sqvel;
+    invP[0][1] = gm1_o_c2*velocity[0];
+    invP[0][2] = gm1_o_c2*velocity[1];
+    invP[0][3] = -gm1_o_c2;
+
+    invP[1][0] = -k1orho*velocity[0] + k0orho*velocity[1];
+    invP[1][1] = k1orho;
+    invP[1][2] = -k0orho;
+    invP[1][3] = 0.0;
+
+    invP[2][0] = -k0orho*velocity[0] - k1orho*velocity[1] + 0.5*gm1_o_rhoxc*sqvel;
+    invP[2][1] = k0orho - gm1_o_rhoxc*velocity[0];
+    invP[2][2] = k1orho - gm1_o_rhoxc*velocity[1];
+    invP[2][3] = gm1_o_rhoxc;
+
+    invP[3][0] = k0orho*velocity[0] + k1orho*velocity[1] + 0.5*gm1_o_rhoxc*sqvel;
+    invP[3][1] = -k0orho - gm1_o_rhoxc*velocity[0];
+    invP[3][2] = -k1orho - gm1_o_rhoxc*velocity[1];
+    invP[3][3] = gm1_o_rhoxc;
+  }
+  else {
+    const Double projVel = normal[0]*velocity[0] + normal[1]*velocity[1] + normal[2]*velocity[2];
+
+    invP[0][0] = normal[0] - normal[2]*velocity[1]/density + normal[1]*velocity[2]/density - normal[0]*0.5*gm1*sqvel/c2;
+    invP[0][1] = normal[0]*gm1*velocity[0]/c2;
+    invP[0][2] = normal[2]/density + normal[0]*gm1*velocity[1]/c2;
+    invP[0][3] = -normal[1]/density + normal[0]*gm1*velocity[2]/c2;
+    invP[0][4] = -normal[0]*gm1/c2;
+
+    invP[1][0] = normal[1] + normal[2]*velocity[0]/density - normal[0]*velocity[2]/density - normal[1]*0.5*gm1*sqvel/c2;
+    invP[1][1] = -normal[2]/density + normal[1]*gm1*velocity[0]/c2;
+    invP[1][2] = normal[1]*gm1*velocity[1]/c2;
+    invP[1][3] = normal[0]/density + normal[1]*gm1*velocity[2]/c2;
+    invP[1][4] = -normal[1]*gm1/c2;
+
+    invP[2][0] = normal[2] - normal[1]*velocity[0]/density + normal[0]*velocity[1]/density - normal[2]*0.5*gm1*sqvel/c2;
+    invP[2][1] = normal[1]/density + normal[2]*gm1*velocity[0]/c2;
+    invP[2][2] = -normal[0]/density + normal[2]*gm1*velocity[1]/c2;
+    invP[2][3] = normal[2]*gm1*velocity[2]/c2;
+    invP[2][4] = -normal[2]*gm1/c2;
+
+    invP[3][0] = -projVel/density + 0.5*gm1*sqvel/rhoxc;
+    invP[3][1] = normal[0]/density - gm1*velocity[0]/rhoxc;
+    invP[3][2] = normal[1]/density - gm1*velocity[1]/rhoxc;
+    invP[3][3] = normal[2]/density - gm1*velocity[2]/rhoxc;
+    invP[3][4] = gm1/rhoxc;
+
+    invP[4][0] = projVel/density + 0.5*gm1*sqvel/rhoxc;
+    invP[4][1] = -normal[0]/density - gm1*velocity[0]/rhoxc;
+    invP[4][2] = -normal[1]/density - gm1*velocity[1]/rhoxc;
+    invP[4][3] = -normal[2]/density - gm1*velocity[2]/rhoxc;
+    invP[4][4] = gm1/rhoxc;
+  }
+}
+
+/*!
+ * \brief Compute the area and unit normal of the edges.
+ */
+template<size_t nDim>
+inline Double UnitNormal(const Double* normal, Double* unitNormal) {
+  const Double area = sqrt(dotProd<nDim>(normal, normal));
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    unitNormal[iDim] = normal[iDim]/area;
+  return area;
+}
+
+/*!
+ * \brief Roe-averaged density, velocity, and enthalpy, returns the squared speed of sound.
+ */
+template<size_t nDim>
+inline Double RoeAverages(passivedouble gamma, const CFlowState<nDim>& Vi, const CFlowState<nDim>& Vj,
+                          Double& roeDensity, Double* roeVelocity) {
+  const Double R = sqrt(fabs(Vj.density/Vi.density));
+  roeDensity = R*Vi.density;
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    roeVelocity[iDim] = (R*Vj.velocity[iDim] + Vi.velocity[iDim])/(R+1.0);
+  const Double sqvel = dotProd<nDim>(roeVelocity, roeVelocity);
+  const Double roeEnthalpy = (R*Vj.enthalpy + Vi.enthalpy)/(R+1.0);
+  return (gamma-1.0)*(roeEnthalpy - 0.5*sqvel);
+}
+
+/*!
+ * \class CBatchedUpwRoe_Flow
+ * \brief Roe's scheme, see CUpwRoeBase_Flow and CUpwRoe_Flow.
+ */
+template<size_t nDim>
+class CBatchedUpwRoe_Flow final : public CBatchedConvectiveFlux {
+private:
+  enum : size_t {nVar = nDim+2};
+  const bool implicit, dynamic_grid;
+  const passivedouble gamma, kappa, entropyFix;
+
+public:
+  CBatchedUpwRoe_Flow(const CConfig* config) :
+    implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+    dynamic_grid(config->GetDynamic_Grid()),
+    gamma(SU2_TYPE::GetValue(config->GetGamma())),
+    kappa(SU2_TYPE::GetValue(config->GetRoe_Kappa())),
+    entropyFix(SU2_TYPE::GetValue(config->GetEntropyFix_Coeff())) {}
+
+  void ComputeFlux(const Input& in, Output& out) const override {
+
+    Double unitNormal[MAXNDIM];
+    const Double area = UnitNormal<nDim>(in.normal, unitNormal);
+
+    const CFlowState<nDim> Vi(in.V_i), Vj(in.V_j);
+
+    /*--- Roe-averaged variables, where the speed of sound is not physical the jump
+     *    in the variables is too large and the fluxes are cleared (at the end). ---*/
+
+    Double roeDensity, roeVelocity[MAXNDIM];
+    const Double roeSoundSpeed2 = RoeAverages(gamma, Vi, Vj, roeDensity, roeVelocity);
+    const Double physical = (roeSoundSpeed2 > 0.0);
+    const Double roeSoundSpeed = sqrt(select(physical, roeSoundSpeed2, Double(1.0)));
+
+    Double P[MAXNVAR][MAXNVAR], invP[MAXNVAR][MAXNVAR];
+    PMatrix<nDim>(gamma, roeDensity, roeVelocity, roeSoundSpeed, unitNormal, P);
+    PMatrixInv<nDim>(gamma, roeDensity, roeVelocity, roeSoundSpeed, unitNormal, invP);
+
+    /*--- Projected velocity adjusted for mesh motion. ---*/
+
+    Double projVelocity = dotProd<nDim>(roeVelocity, unitNormal);
+    Double projGridVel = 0.0;
+
+    if (dynamic_grid) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        projGridVel += 0.5*(in.gridVel_i[iDim]+in.gridVel_j[iDim])*unitNormal[iDim];
+      projVelocity -= projGridVel;
+    }
+
+    /*--- Flow eigenvalues with Mavriplis' entropy correction. ---*/
+
+    Double lambda[MAXNVAR];
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      lambda[iDim] = projVelocity;
+    lambda[nVar-2] = projVelocity + roeSoundSpeed;
+    lambda[nVar-1] = projVelocity - roeSoundSpeed;
+
+    const Double maxLambda = fabs(projVelocity) + roeSoundSpeed;
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      lambda[iVar] = max(fabs(lambda[iVar]), entropyFix*maxLambda);
+
+    /*--- Central part of the flux and Jacobians. ---*/
+
+    Double U_i[MAXNVAR], U_j[MAXNVAR], projFlux_i[MAXNVAR], projFlux_j[MAXNVAR];
+    Vi.GetConservative(U_i);
+    Vj.GetConservative(U_j);
+
+    InviscidProjFlux<nDim>(Vi.density, Vi.velocity, Vi.pressure, Vi.enthalpy, in.normal, projFlux_i);
+    InviscidProjFlux<nDim>(Vj.density, Vj.velocity, Vj.pressure, Vj.enthalpy, in.normal, projFlux_j);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      out.flux[iVar] = kappa*(projFlux_i[iVar]+projFlux_j[iVar]);
+
+    if (implicit) {
+      InviscidProjJac<nDim>(gamma, Vi.velocity, Vi.energy, in.normal, kappa, out.jac_i);
+      InviscidProjJac<nDim>(gamma, Vj.velocity, Vj.energy, in.normal, kappa, out.jac_j);
+    }
+
+    /*--- Standard Roe "dissipation". ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double modJac = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar)
+          modJac += P[iVar][kVar]*lambda[kVar]*invP[kVar][jVar];
+
+        out.flux[iVar] -= (1.0-kappa)*modJac*(U_j[jVar]-U_i[jVar])*area;
+
+        if (implicit) {
+          out.jac_i[iVar][jVar] += (1.0-kappa)*modJac*area;
+          out.jac_j[iVar][jVar] -= (1.0-kappa)*modJac*area;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamic_grid) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        out.flux[iVar] -= projGridVel*area * 0.5*(U_i[iVar]+U_j[iVar]);
+
+        if (implicit) {
+          out.jac_i[iVar][iVar] -= 0.5*projGridVel*area;
+          out.jac_j[iVar][iVar] -= 0.5*projGridVel*area;
+        }
+      }
+    }
+
+    /*--- Clear the lanes with non-physical Roe state. ---*/
+
+    const Double zero = 0.0;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      out.flux[iVar] = select(physical, out.flux[iVar], zero);
+      if (implicit) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          out.jac_i[iVar][jVar] = select(physical, out.jac_i[iVar][jVar], zero);
+          out.jac_j[iVar][jVar] = select(physical, out.jac_j[iVar][jVar], zero);
+        }
+      }
+    }
+  }
+};
+
+/*!
+ * \class CBatchedUpwAUSMPLUSUP_Flow
+ * \brief AUSM+up scheme with Roe-approximated Jacobians, see CUpwAUSMPLUSUP_Flow.
+ */
+template<size_t nDim>
+class CBatchedUpwAUSMPLUSUP_Flow final : public CBatchedConvectiveFlux {
+private:
+  enum : size_t {nVar = nDim+2};
+  const bool implicit;
+  const passivedouble gamma, Minf;
+  const passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+public:
+  CBatchedUpwAUSMPLUSUP_Flow(const CConfig* config) :
+    implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+    gamma(SU2_TYPE::GetValue(config->GetGamma())),
+    Minf(SU2_TYPE::GetValue(config->GetMach())) {}
+
+  void ComputeFlux(const Input& in, Output& out) const override {
+
+    Double unitNormal[MAXNDIM];
+    const Double area = UnitNormal<nDim>(in.normal, unitNormal);
+
+    const CFlowState<nDim> Vi(in.V_i), Vj(in.V_j);
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double projVel_i = dotProd<nDim>(Vi.velocity, unitNormal);
+    const Double projVel_j = dotProd<nDim>(Vj.velocity, unitNormal);
+
+    const Double astarL = sqrt(2.0*(gamma-1.0)/(gamma+1.0)*Vi.enthalpy);
+    const Double astarR = sqrt(2.0*(gamma-1.0)/(gamma+1.0)*Vj.enthalpy);
+
+    const Double ahatL = astarL*astarL/max(astarL, projVel_i);
+    const Double ahatR = astarR*astarR/max(astarR,-projVel_j);
+
+    const Double aF = min(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers, both
+     *    the subsonic and supersonic versions are computed. ---*/
+
+    const Double mL = projVel_i/aF;
+    const Double mR = projVel_j/aF;
+
+    const Double MFsq = 0.5*(mL*mL+mR*mR);
+    const Double Mrefsq = min(1.0, max(MFsq, Minf*Minf));
+
+    const Double fa = 2.0*sqrt(Mrefsq)-Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4.0+5.0*fa*fa);
+    const passivedouble beta = 1.0/8.0;
+
+    Double mLP, betaLP, mRM, betaRM;
+    {
+      const Double p1 = 0.25*(mL+1.0)*(mL+1.0);
+      const Double p2 = (mL*mL-1.0)*(mL*mL-1.0);
+      const Double mLP_sup = 0.5*(mL+fabs(mL));
+      const Double subsonic = (fabs(mL) <= 1.0);
+      mLP = select(subsonic, p1 + beta*p2, mLP_sup);
+      betaLP = select(subsonic, p1*(2.0-mL) + alpha*mL*p2, mLP_sup/mL);
+    }
+    {
+      const Double p1 = 0.25*(mR-1.0)*(mR-1.0);
+      const Double p2 = (mR*mR-1.0)*(mR*mR-1.0);
+      const Double mRM_sup = 0.5*(mR-fabs(mR));
+      const Double subsonic = (fabs(mR) <= 1.0);
+      mRM = select(subsonic, -p1 - beta*p2, mRM_sup);
+      betaRM = select(subsonic, p1*(2.0+mR) - alpha*mR*p2, mRM_sup/mR);
+    }
+
+    /*--- Pressure and velocity diffusion terms. ---*/
+
+    const Double rhoF = 0.5*(Vi.density+Vj.density);
+    const Double Mp = -(Kp/fa)*max((1.0-sigma*MFsq),0.0)*(Vj.pressure-Vi.pressure)/(rhoF*aF*aF);
+
+    const Double Pu = -Ku*fa*betaLP*betaRM*2.0*rhoF*aF*(projVel_j-projVel_i);
+
+    /*--- Mass and pressure fluxes. ---*/
+
+    const Double mF = mLP + mRM + Mp;
+    const Double massFlux = aF * (max(mF,0.0)*Vi.density + min(mF,0.0)*Vj.density);
+    const Double dissFlux = fabs(massFlux);
+
+    const Double pressure = betaLP*Vi.pressure + betaRM*Vj.pressure + Pu;
+
+    /*--- F_{1/2} = ||A|| ( 0.5 * mdot * (psi_i+psi_j) - 0.5 * |mdot| * (psi_i-psi_j) + N * pf ) ---*/
+
+    out.flux[0] = massFlux*area;
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      out.flux[iDim+1] = (0.5*massFlux*(Vi.velocity[iDim]+Vj.velocity[iDim]) +
+                          0.5*dissFlux*(Vi.velocity[iDim]-Vj.velocity[iDim]) +
+                          unitNormal[iDim]*pressure) * area;
+
+    out.flux[nVar-1] = (0.5*massFlux*(Vi.enthalpy+Vj.enthalpy) +
+                        0.5*dissFlux*(Vi.enthalpy-Vj.enthalpy)) * area;
+
+    if (!implicit) return;
+
+    /*--- Approximate Jacobians (Roe's), see CUpwAUSMPLUS_SLAU_Base_Flow::ApproximateJacobian. ---*/
+
+    Double roeDensity, roeVelocity[MAXNDIM];
+    const Double roeSoundSpeed = sqrt(fabs(RoeAverages(gamma, Vi, Vj, roeDensity, roeVelocity)));
+    const Double projVelocity = dotProd<nDim>(roeVelocity, unitNormal);
+
+    Double P[MAXNVAR][MAXNVAR], invP[MAXNVAR][MAXNVAR], lambda[MAXNVAR];
+    PMatrix<nDim>(gamma, roeDensity, roeVelocity, roeSoundSpeed, unitNormal, P);
+    PMatrixInv<nDim>(gamma, roeDensity, roeVelocity, roeSoundSpeed, unitNormal, invP);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      lambda[iDim] = fabs(projVelocity);
+    lambda[nVar-2] = fabs(projVelocity + roeSoundSpeed);
+    lambda[nVar-1] = fabs(projVelocity - roeSoundSpeed);
+
+    InviscidProjJac<nDim>(gamma, Vi.velocity, Vi.energy, in.normal, 0.5, out.jac_i);
+    InviscidProjJac<nDim>(gamma, Vj.velocity, Vj.energy, in.normal, 0.5, out.jac_j);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double modJac = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar)
+          modJac += P[iVar][kVar]*lambda[kVar]*invP[kVar][jVar];
+        out.jac_i[iVar][jVar] += 0.5*modJac*area;
+        out.jac_j[iVar][jVar] -= 0.5*modJac*area;
+      }
+    }
+  }
+};
+
+/*!
+ * \class CBatchedUpwHLLC_Flow
+ * \brief HLLC scheme, see CUpwHLLC_Flow.
+ * \note The four wave configurations are evaluated for all lanes and the results blended.
+ *       This is simplified by noting that the star-state formulas of the "left" and "right"
+ *       branches are symmetric, they only depend on which side of the contact wave is "own"
+ *       (the side of the star state) and which side is "other".
+ */
+template<size_t nDim>
+class CBatchedUpwHLLC_Flow final : public CBatchedConvectiveFlux {
+private:
+  enum : size_t {nVar = nDim+2};
+  const bool implicit, dynamic_grid;
+  const passivedouble gamma, kappa;
+
+  /*!
+   * \brief Derivative of the contact wave speed w.r.t. the conservatives of one side.
+   */
+  void ContactSpeedDerivative(passivedouble sign, const CFlowState<nDim>& V, const Double& projVel,
+                              const Double& sqVel, const Double& s, const Double& sM, const Double& RHO,
+                              const Double* unitNormal, Double* dSm_dU) const {
+    const passivedouble gm1 = gamma - 1.0;
+    dSm_dU[0] = sign * ( - projVel * projVel + sM * s + 0.5 * gm1 * sqVel ) / RHO;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dSm_dU[iDim+1] = sign * ( unitNormal[iDim] * ( 2.0 * projVel - s - sM ) - gm1 * V.velocity[iDim] ) / RHO;
+    dSm_dU[nVar-1] = sign * gm1 / RHO;
+  }
+
+public:
+  CBatchedUpwHLLC_Flow(const CConfig* config) :
+    implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+    dynamic_grid(config->GetDynamic_Grid()),
+    gamma(SU2_TYPE::GetValue(config->GetGamma())),
+    kappa(SU2_TYPE::GetValue(config->GetRoe_Kappa())) {}
+
+  void ComputeFlux(const Input& in, Output& out) const override {
+
+    const passivedouble gm1 = gamma - 1.0;
+
+    Double unitNormal[MAXNDIM];
+    const Double area = UnitNormal<nDim>(in.normal, unitNormal);
+
+    const CFlowState<nDim> Vi(in.V_i), Vj(in.V_j);
+
+    const Double sqVel_i = dotProd<nDim>(Vi.velocity, Vi.velocity);
+    const Double sqVel_j = dotProd<nDim>(Vj.velocity, Vj.velocity);
+
+    Double soundSpeed_i = sqrt( (Vi.enthalpy - 0.5 * sqVel_i) * gm1 );
+    Double soundSpeed_j = sqrt( (Vj.enthalpy - 0.5 * sqVel_j) * gm1 );
+
+    Double projVel_i = dotProd<nDim>(Vi.velocity, unitNormal);
+    Double projVel_j = dotProd<nDim>(Vj.velocity, unitNormal);
+
+    /*--- Projected grid velocity. ---*/
+
+    Double projInterfaceVel = 0.0;
+
+    if (dynamic_grid) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        projInterfaceVel += 0.5 * ( in.gridVel_i[iDim] + in.gridVel_j[iDim] )*unitNormal[iDim];
+
+      soundSpeed_i -= projInterfaceVel;
+      soundSpeed_j += projInterfaceVel;
+
+      projVel_i -= projInterfaceVel;
+      projVel_j -= projInterfaceVel;
+    }
+
+    /*--- Roe's averaging. ---*/
+
+    const Double sqrtRho_i = sqrt(Vi.density), sqrtRho_j = sqrt(Vj.density);
+    const Double Rrho = sqrtRho_i + sqrtRho_j;
+
+    Double sqVelRoe = 0.0, roeProjVel = -projInterfaceVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double roeVel = ( Vi.velocity[iDim] * sqrtRho_i + Vj.velocity[iDim] * sqrtRho_j ) / Rrho;
+      sqVelRoe += roeVel * roeVel;
+      roeProjVel += roeVel * unitNormal[iDim];
+    }
+
+    const Double roeEnthalpy = ( sqrtRho_j * Vj.enthalpy + sqrtRho_i * Vi.enthalpy ) / Rrho;
+    const Double roeSoundSpeed = sqrt( gm1 * ( roeEnthalpy - 0.5 * sqVelRoe ) ) - projInterfaceVel;
+
+    /*--- Wave speeds. ---*/
+
+    const Double sL = min( roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i );
+    const Double sR = max( roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j );
+
+    const Double RHO = Vj.density * (sR - projVel_j) - Vi.density * (sL - projVel_i);
+    const Double sM = ( Vi.pressure - Vj.pressure - Vi.density * projVel_i * ( sL - projVel_i ) +
+                        Vj.density * projVel_j * ( sR - projVel_j ) ) / RHO;
+
+    const Double pStar = Vj.density * ( projVel_j - sR ) * ( projVel_j - sM ) + Vj.pressure;
+
+    /*--- Select the "own" side (the upwind side w.r.t. the contact) and detect supersonic lanes. ---*/
+
+    const Double leftOwn = (sM > 0.0);
+    const Double supersonic = select(leftOwn, Double(sL > 0.0), Double(sR < 0.0));
+
+    Double velocity[MAXNDIM];
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      velocity[iDim] = select(leftOwn, Vi.velocity[iDim], Vj.velocity[iDim]);
+    const Double density  = select(leftOwn, Vi.density, Vj.density);
+    const Double pressure = select(leftOwn, Vi.pressure, Vj.pressure);
+    const Double enthalpy = select(leftOwn, Vi.enthalpy, Vj.enthalpy);
+    const Double energy   = select(leftOwn, Vi.energy, Vj.energy);
+    const Double projVel  = select(leftOwn, projVel_i, projVel_j);
+    const Double s        = select(leftOwn, sL, sR);
+
+    /*--- Star state of the own side. ---*/
+
+    const Double rhoS = ( s - projVel ) / ( s - sM );
+
+    Double interState[MAXNVAR];
+    interState[0] = rhoS * density;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      interState[iDim+1] = rhoS * ( density * velocity[iDim] + ( pStar - pressure ) / ( s - projVel ) * unitNormal[iDim] );
+    interState[nVar-1] = rhoS * ( density * energy - ( pressure * projVel - pStar * sM ) / ( s - projVel ) );
+
+    /*--- Fluxes. ---*/
+
+    out.flux[0] = select(supersonic, density * projVel, sM * interState[0]);
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      out.flux[iDim+1] = select(supersonic, density * velocity[iDim] * projVel + pressure * unitNormal[iDim],
+                                sM * interState[iDim+1] + pStar * unitNormal[iDim]);
+    out.flux[nVar-1] = select(supersonic, enthalpy * density * projVel,
+                              sM * ( interState[nVar-1] + pStar ) + pStar * projInterfaceVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      out.flux[iVar] *= area;
+
+    if (!implicit) return;
+
+    /*--- Derivatives of the contact speed and of the star pressure w.r.t. each side,
+     *    these are the same for the left and right star states. ---*/
+
+    Double dSm_dU_i[MAXNVAR], dSm_dU_j[MAXNVAR], dpStar_dU_i[MAXNVAR], dpStar_dU_j[MAXNVAR];
+
+    ContactSpeedDerivative(1.0, Vi, projVel_i, sqVel_i, sL, sM, RHO, unitNormal, dSm_dU_i);
+    ContactSpeedDerivative(-1.0, Vj, projVel_j, sqVel_j, sR, sM, RHO, unitNormal, dSm_dU_j);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dpStar_dU_i[iVar] = Vi.density * (sR - projVel_j) * dSm_dU_i[iVar];
+      dpStar_dU_j[iVar] = Vj.density * (sL - projVel_i) * dSm_dU_j[iVar];
+    }
+
+    Double dSm_dU[MAXNVAR], dpStar_dU[MAXNVAR], dEStar_dU[MAXNVAR];
+    Double jacOwn[MAXNVAR][MAXNVAR], jacOther[MAXNVAR][MAXNVAR];
+
+    const Double EStar = interState[nVar-1];
+    const Double Omega = 1.0 / (s - sM);
+    const Double OmegaSM = Omega * sM;
+
+    /*--- Jacobian w.r.t. the own side. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dSm_dU[iVar] = select(leftOwn, dSm_dU_i[iVar], dSm_dU_j[iVar]);
+      dpStar_dU[iVar] = select(leftOwn, dpStar_dU_i[iVar], dpStar_dU_j[iVar]);
+    }
+
+    Double dPI_dU[MAXNVAR];
+    dPI_dU[0] = 0.5 * gm1 * dotProd<nDim>(velocity, velocity);
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dPI_dU[iDim+1] = - gm1 * velocity[iDim];
+    dPI_dU[nVar-1] = gm1;
+
+    Double drhoStar_dU[MAXNVAR];
+    drhoStar_dU[0] = Omega * ( s + interState[0] * dSm_dU[0] );
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      drhoStar_dU[iDim+1] = Omega * ( - unitNormal[iDim] + interState[0] * dSm_dU[iDim+1] );
+    drhoStar_dU[nVar-1] = Omega * interState[0] * dSm_dU[nVar-1];
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      dEStar_dU[iVar] = Omega * ( sM * dpStar_dU[iVar] + ( EStar + pStar ) * dSm_dU[iVar] );
+
+    dEStar_dU[0] += Omega * projVel * ( enthalpy - dPI_dU[0] );
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dEStar_dU[iDim+1] += Omega * ( - unitNormal[iDim] * enthalpy - projVel * dPI_dU[iDim+1] );
+    dEStar_dU[nVar-1] += Omega * ( s - projVel - projVel * dPI_dU[nVar-1] );
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      jacOwn[0][iVar] = sM * drhoStar_dU[iVar] + interState[0] * dSm_dU[iVar];
+
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        jacOwn[jDim+1][iVar] = ( OmegaSM + 1.0 ) * ( unitNormal[jDim] * dpStar_dU[iVar] + interState[jDim+1] * dSm_dU[iVar] );
+
+      jacOwn[jDim+1][0] += OmegaSM * velocity[jDim] * projVel;
+
+      jacOwn[jDim+1][jDim+1] += OmegaSM * (s - projVel);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        jacOwn[jDim+1][iDim+1] -= OmegaSM * velocity[jDim] * unitNormal[iDim];
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        jacOwn[jDim+1][iVar] -= OmegaSM * dPI_dU[iVar] * unitNormal[jDim];
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      jacOwn[nVar-1][iVar] = sM * ( dEStar_dU[iVar] + dpStar_dU[iVar] ) + ( EStar + pStar ) * dSm_dU[iVar];
+
+    /*--- Jacobian w.r.t. the other side. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dSm_dU[iVar] = select(leftOwn, dSm_dU_j[iVar], dSm_dU_i[iVar]);
+      dpStar_dU[iVar] = select(leftOwn, dpStar_dU_j[iVar], dpStar_dU_i[iVar]);
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      dEStar_dU[iVar] = Omega * ( sM * dpStar_dU[iVar] + ( EStar + pStar ) * dSm_dU[iVar] );
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      jacOther[0][iVar] = interState[0] * ( OmegaSM + 1.0 ) * dSm_dU[iVar];
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        jacOther[iDim+1][iVar] = ( OmegaSM + 1.0 ) * ( interState[iDim+1] * dSm_dU[iVar] + unitNormal[iDim] * dpStar_dU[iVar] );
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      jacOther[nVar-1][iVar] = sM * (dEStar_dU[iVar] + dpStar_dU[iVar]) + (EStar + pStar) * dSm_dU[iVar];
+
+    /*--- Supersonic lanes, the flux only depends on the own side. ---*/
+
+    Double jacSuper[MAXNVAR][MAXNVAR];
+    InviscidProjJac<nDim>(gamma, velocity, energy, unitNormal, 1.0, jacSuper);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        const Double own = select(supersonic, jacSuper[iVar][jVar], jacOwn[iVar][jVar]);
+        const Double other = select(supersonic, Double(0.0), jacOther[iVar][jVar]);
+
+        /*--- Scale = k because Flux ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+        out.jac_i[iVar][jVar] = select(leftOwn, own, other) * (area*kappa);
+        out.jac_j[iVar][jVar] = select(leftOwn, other, own) * (area*kappa);
+      }
+    }
+  }
+};
+
+/*!
+ * \class CBatchedCentJST_Flow
+ * \brief JST scheme, see CCentBase_Flow and CCentJST_Flow.
+ */
+template<size_t nDim>
+class CBatchedCentJST_Flow final : public CBatchedConvectiveFlux {
+private:
+  enum : size_t {nVar = nDim+2};
+  const bool implicit, dynamic_grid;
+  const passivedouble gamma, fixFactor, kappa2, kappa4;
+  const passivedouble param_p = 0.3;
+
+public:
+  CBatchedCentJST_Flow(const CConfig* config) :
+    implicit(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+    dynamic_grid(config->GetDynamic_Grid()),
+    gamma(SU2_TYPE::GetValue(config->GetGamma())),
+    fixFactor(SU2_TYPE::GetValue(config->GetCent_Jac_Fix_Factor())),
+    kappa2(SU2_TYPE::GetValue(config->GetKappa_2nd_Flow())),
+    kappa4(SU2_TYPE::GetValue(config->GetKappa_4th_Flow())) {}
+
+  void ComputeFlux(const Input& in, Output& out) const override {
+
+    const passivedouble gm1 = gamma - 1.0;
+
+    const CFlowState<nDim> Vi(in.V_i), Vj(in.V_j);
+    const Double soundSpeed_i = in.V_i[nDim+4], soundSpeed_j = in.V_j[nDim+4];
+
+    Double U_i[MAXNVAR], U_j[MAXNVAR];
+    Vi.GetConservative(U_i);
+    Vj.GetConservative(U_j);
+
+    /*--- Mean values of the variables and central flux. ---*/
+
+    const Double meanDensity = 0.5*(Vi.density+Vj.density);
+    const Double meanPressure = 0.5*(Vi.pressure+Vj.pressure);
+    const Double meanEnthalpy = 0.5*(Vi.enthalpy+Vj.enthalpy);
+    const Double meanEnergy = 0.5*(Vi.energy+Vj.energy);
+    Double meanVelocity[MAXNDIM];
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      meanVelocity[iDim] = 0.5*(Vi.velocity[iDim]+Vj.velocity[iDim]);
+
+    InviscidProjFlux<nDim>(meanDensity, meanVelocity, meanPressure, meanEnthalpy, in.normal, out.flux);
+
+    /*--- Jacobians, scale = 0.5 because ProjFlux ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+
+    if (implicit) {
+      InviscidProjJac<nDim>(gamma, meanVelocity, meanEnergy, in.normal, 0.5, out.jac_i);
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        for (size_t jVar = 0; jVar < nVar; ++jVar)
+          out.jac_j[iVar][jVar] = out.jac_i[iVar][jVar];
+    }
+
+    /*--- Adjustment due to grid motion. ---*/
+
+    Double projGridVel = 0.0;
+
+    if (dynamic_grid) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        projGridVel += 0.5*(in.gridVel_i[iDim]+in.gridVel_j[iDim])*in.normal[iDim];
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        out.flux[iVar] -= projGridVel * 0.5*(U_i[iVar] + U_j[iVar]);
+        if (implicit) {
+          out.jac_i[iVar][iVar] -= 0.5*projGridVel;
+          out.jac_j[iVar][iVar] -= 0.5*projGridVel;
+        }
+      }
+    }
+
+    /*--- Local spectral radius and stretching factor. ---*/
+
+    const Double area = sqrt(dotProd<nDim>(in.normal, in.normal));
+    const Double projVel_i = dotProd<nDim>(Vi.velocity, in.normal) - projGridVel;
+    const Double projVel_j = dotProd<nDim>(Vj.velocity, in.normal) - projGridVel;
+
+    const Double localLambda_i = fabs(projVel_i) + soundSpeed_i*area;
+    const Double localLambda_j = fabs(projVel_j) + soundSpeed_j*area;
+    const Double meanLambda = 0.5*(localLambda_i+localLambda_j);
+
+    const Double phi_i = pow(in.lambda_i/(4.0*meanLambda), param_p);
+    const Double phi_j = pow(in.lambda_j/(4.0*meanLambda), param_p);
+    const Double stretchingFactor = 4.0*phi_i*phi_j/(phi_i+phi_j);
+
+    /*--- Dissipation coefficients. ---*/
+
+    const Double sc2 = 3.0*(in.nNeighbor_i+in.nNeighbor_j)/(in.nNeighbor_i*in.nNeighbor_j);
+    const Double sc4 = sc2*sc2/4.0;
+
+    const Double epsilon2 = kappa2*0.5*(in.sensor_i+in.sensor_j)*sc2;
+    const Double epsilon4 = max(0.0, kappa4-epsilon2)*sc4;
+
+    /*--- Differences of conservatives (with enthalpy correction) and of Laplacians. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diffU = (iVar < nVar-1)? U_i[iVar]-U_j[iVar] : Vi.density*Vi.enthalpy-Vj.density*Vj.enthalpy;
+      const Double diffLapl = in.undivLapl_i[iVar]-in.undivLapl_j[iVar];
+      out.flux[iVar] += (epsilon2*diffU - epsilon4*diffLapl)*stretchingFactor*meanLambda;
+    }
+
+    if (!implicit) return;
+
+    /*--- Scalar dissipation Jacobians, see CCentBase_Flow::ScalarDissipationJacobian. ---*/
+
+    const Double cte_0 = (epsilon2 + epsilon4*(in.nNeighbor_i+1.0))*stretchingFactor*meanLambda;
+    const Double cte_1 = (epsilon2 + epsilon4*(in.nNeighbor_j+1.0))*stretchingFactor*meanLambda;
+
+    for (size_t iVar = 0; iVar < nVar-1; ++iVar) {
+      out.jac_i[iVar][iVar] += fixFactor*cte_0;
+      out.jac_j[iVar][iVar] -= fixFactor*cte_1;
+    }
+
+    out.jac_i[nVar-1][0] += fixFactor*cte_0*gm1*(0.5*dotProd<nDim>(Vi.velocity, Vi.velocity));
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      out.jac_i[nVar-1][iDim+1] -= fixFactor*cte_0*gm1*Vi.velocity[iDim];
+    out.jac_i[nVar-1][nVar-1] += fixFactor*cte_0*gamma;
+
+    out.jac_j[nVar-1][0] -= fixFactor*cte_1*gm1*(0.5*dotProd<nDim>(Vj.velocity, Vj.velocity));
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      out.jac_j[nVar-1][iDim+1] += fixFactor*cte_1*gm1*Vj.velocity[iDim];
+    out.jac_j[nVar-1][nVar-1] -= fixFactor*cte_1*gamma;
+  }
+};
+
+/*!
+ * \brief Instantiate a scheme for 2D or 3D.
+ */
+template<template<size_t> class Scheme>
+CBatchedConvectiveFlux* CreateScheme(unsigned short nDim, const CConfig* config) {
+  if (nDim == 2) return new Scheme<2>(config);
+  return new Scheme<3>(config);
+}
+
+} // namespace
+
+CBatchedConvectiveFlux* CBatchedConvectiveFlux::CreateFlux(unsigned short nDim, const CConfig* config,
+                                                           unsigned short iMesh) {
+
+  /*--- The batched schemes are not differentiable (AD) and are only for ideal gases. ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  return nullptr;
+#else
+  if (!config->GetUseVectorization()) return nullptr;
+
+  const bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config->GetKind_FluidModel() == IDEAL_GAS);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  if (!ideal_gas || config->Low_Mach_Correction()) return nullptr;
+
+  switch (config->GetKind_ConvNumScheme_Flow()) {
+    case SPACE_CENTERED:
+      /*--- On coarse grids Lax-Friedrich is used. ---*/
+      if ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0))
+        return CreateScheme<CBatchedCentJST_Flow>(nDim, config);
+      break;
+
+    case SPACE_UPWIND:
+      switch (config->GetKind_Upwind_Flow()) {
+        case ROE:
+          if (config->GetKind_RoeLowDiss() == NO_ROELOWDISS)
+            return CreateScheme<CBatchedUpwRoe_Flow>(nDim, config);
+          break;
+        case AUSMPLUSUP:
+          if (!(implicit && config->GetUse_Accurate_Jacobians()))
+            return CreateScheme<CBatchedUpwAUSMPLUSUP_Flow>(nDim, config);
+          break;
+        case HLLC:
+          return CreateScheme<CBatchedUpwHLLC_Flow>(nDim, config);
+        default:
+          break;
+      }
+      break;
+
+    default:
+      break;
+  }
+  return nullptr;
+#endif
+}
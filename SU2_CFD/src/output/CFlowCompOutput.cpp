@@ -272,6 +272,10 @@ void CFlowCompOutput::SetHistoryOutputFields(CConfig *config){
 
   AddAerodynamicCoefficients(config);
 
+  /*--- Add probe fields ---*/
+
+  AddProbeOutput(config);
+
   /*--- Add Cp diff fields ---*/
 
   Add_CpInverseDesignOutput(config);
@@ -675,6 +679,10 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   SetAerodynamicCoefficients(config, flow_solver);
 
+  /*--- Set probe fields ---*/
+
+  SetProbeOutput(config, geometry, flow_solver);
+
   /*--- Set Cp diff fields ---*/
 
   Set_CpInverseDesign(flow_solver, geometry, config);
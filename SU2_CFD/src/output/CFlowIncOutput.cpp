@@ -217,6 +217,10 @@ void CFlowIncOutput::SetHistoryOutputFields(CConfig *config){
 
   AddAerodynamicCoefficients(config);
 
+  /*--- Add probe fields ---*/
+
+  AddProbeOutput(config);
+
 }
 
 void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolver **solver) {
@@ -331,6 +335,10 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   SetAerodynamicCoefficients(config, flow_solver);
 
+  /*--- Set probe fields ---*/
+
+  SetProbeOutput(config, geometry, flow_solver);
+
 }
 
 
@@ -34,7 +34,19 @@ CFlowOutput::CFlowOutput(CConfig *config, unsigned short nDim, bool fem_output)
 }
 
 
-CFlowOutput::~CFlowOutput(void){}
+CFlowOutput::~CFlowOutput(void){
+
+  delete probes;
+
+}
+
+void CFlowOutput::ClearGeometryData() {
+
+  COutput::ClearGeometryData();
+
+  if (probes != nullptr) probes->Clear();
+
+}
 
 void CFlowOutput::AddAnalyzeSurfaceOutput(CConfig *config){
 
@@ -672,6 +684,66 @@ void CFlowOutput::SetAnalyzeSurface(CSolver *solver, CGeometry *geometry, CConfi
   std::cout << std::resetiosflags(std::cout.flags());
 }
 
+void CFlowOutput::AddProbeOutput(const CConfig *config){
+
+  if (config->GetnProbe_Points() + config->GetnProbe_Lines() == 0) return;
+
+  if (probes == nullptr) probes = new CProbes(config);
+
+  const auto& names = probes->GetNames();
+
+  /// BEGIN_GROUP: PROBES, DESCRIPTION: Flow variables at the probes set in PROBE_POINTS and PROBE_LINES.
+  /// DESCRIPTION: Density
+  AddHistoryOutputPerSurface("PROBE_DENSITY",     "Probe_Density",     ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// DESCRIPTION: Velocity x-component
+  AddHistoryOutputPerSurface("PROBE_VELOCITY-X",  "Probe_Velocity_x",  ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// DESCRIPTION: Velocity y-component
+  AddHistoryOutputPerSurface("PROBE_VELOCITY-Y",  "Probe_Velocity_y",  ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// DESCRIPTION: Velocity z-component
+  if (nDim == 3)
+    AddHistoryOutputPerSurface("PROBE_VELOCITY-Z","Probe_Velocity_z",  ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// DESCRIPTION: Pressure
+  AddHistoryOutputPerSurface("PROBE_PRESSURE",    "Probe_Pressure",    ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// DESCRIPTION: Temperature
+  AddHistoryOutputPerSurface("PROBE_TEMPERATURE", "Probe_Temperature", ScreenOutputFormat::SCIENTIFIC, "PROBES", names);
+  /// END_GROUP
+}
+
+void CFlowOutput::SetProbeOutput(const CConfig *config, CGeometry *geometry, CSolver *solver){
+
+  if (probes == nullptr) return;
+
+  /*--- Locate the probes once, the donors and weights are then reused. ---*/
+
+  if (!probes->IsLocated()) probes->Locate(geometry);
+
+  /*--- Density, velocity, pressure, temperature. ---*/
+
+  const unsigned short nField = nDim+3;
+  const CVariable* nodes = solver->GetNodes();
+
+  auto pointValue = [&](unsigned long iPoint, unsigned short iField) {
+    if (iField == 0) return nodes->GetDensity(iPoint);
+    if (iField <= nDim) return nodes->GetVelocity(iPoint, iField-1);
+    if (iField == nDim+1) return nodes->GetPressure(iPoint);
+    return nodes->GetTemperature(iPoint);
+  };
+
+  vector<su2double> values;
+  probes->Evaluate(nField, pointValue, values);
+
+  for (unsigned long iProbe = 0; iProbe < probes->GetnProbe(); iProbe++) {
+    const su2double* probeValues = &values[iProbe*nField];
+    SetHistoryOutputPerSurfaceValue("PROBE_DENSITY", probeValues[0], iProbe);
+    SetHistoryOutputPerSurfaceValue("PROBE_VELOCITY-X", probeValues[1], iProbe);
+    SetHistoryOutputPerSurfaceValue("PROBE_VELOCITY-Y", probeValues[2], iProbe);
+    if (nDim == 3)
+      SetHistoryOutputPerSurfaceValue("PROBE_VELOCITY-Z", probeValues[3], iProbe);
+    SetHistoryOutputPerSurfaceValue("PROBE_PRESSURE", probeValues[nDim+1], iProbe);
+    SetHistoryOutputPerSurfaceValue("PROBE_TEMPERATURE", probeValues[nDim+2], iProbe);
+  }
+}
+
 void CFlowOutput::AddAerodynamicCoefficients(CConfig *config){
 
   /// BEGIN_GROUP: AERO_COEFF, DESCRIPTION: Sum of the aerodynamic coefficients and forces on all surfaces (markers) set with MARKER_MONITORING.
@@ -37,10 +37,13 @@
 #include "../../include/output/filewriter/CParaviewVTMFileWriter.hpp"
 #include "../../include/output/filewriter/CTecplotFileWriter.hpp"
 #include "../../include/output/filewriter/CTecplotBinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CHDF5FileWriter.hpp"
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../include/output/tools/CSurfaceSampler.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
@@ -175,6 +178,14 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
 COutput::~COutput(void) {
 
+  /*--- Complete the background writes. ---*/
+
+  for (auto& writer : asyncWriters)
+    delete writer.second;
+
+  delete restartKeyframe;
+  delete surfaceSampler;
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -193,6 +204,28 @@ COutput::~COutput(void) {
 
 }
 
+void COutput::ClearGeometryData() {
+
+  for (auto& writer : asyncWriters)
+    delete writer.second;
+  asyncWriters.clear();
+
+  /*--- The next compressed restart is a keyframe. ---*/
+  delete restartKeyframe;
+  restartKeyframe = nullptr;
+  nRestartWritten = 0;
+
+  delete surfaceSampler;
+  surfaceSampler = nullptr;
+
+  delete volumeDataSorter;
+  volumeDataSorter = nullptr;
+
+  delete surfaceDataSorter;
+  surfaceDataSorter = nullptr;
+
+}
+
 
 
 void COutput::SetHistory_Output(CGeometry *geometry,
@@ -388,7 +421,40 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      if (config->GetRestart_Compression()) {
+
+        /*--- Error bounds of the fields that are stored with loss. ---*/
+
+        const vector<string>& fieldNames = volumeDataSorter->GetFieldNames();
+        vector<passivedouble> lossyTolerance(fieldNames.size(), 0.0);
+
+        for (unsigned short iField = 0; iField < config->GetnRestart_Lossy_Fields(); iField++) {
+          const string& lossyField = config->GetRestart_Lossy_Field(iField);
+          const auto it = find(fieldNames.begin(), fieldNames.end(), lossyField);
+          if (it == fieldNames.end())
+            SU2_MPI::Error("Field " + lossyField + " in RESTART_LOSSY_FIELDS is not written to the restart file.",
+                           CURRENT_FUNCTION);
+          lossyTolerance[it-fieldNames.begin()] = SU2_TYPE::GetValue(config->GetRestart_Lossy_Tol());
+        }
+
+        auto restartWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter, true, lossyTolerance);
+
+        /*--- In time-domain problems the restarts between keyframes are written as deltas,
+         i.e. relative to the last keyframe (each time step is written to a different file). ---*/
+
+        const unsigned long keyframeFreq = config->GetRestart_Keyframe_Freq();
+
+        if (config->GetTime_Domain() && (keyframeFreq > 1)) {
+          if (restartKeyframe == nullptr) restartKeyframe = new CRestartKeyframe;
+          restartWriter->SetKeyframe(restartKeyframe, (nRestartWritten % keyframeFreq) != 0);
+          nRestartWritten++;
+        }
+
+        fileWriter = restartWriter;
+      }
+      else {
+        fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      }
 
       break;
 
@@ -412,6 +478,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case MESH_BINARY:
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Set the mesh binary format ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "SU2 binary mesh" << fileName + CSU2BinaryMeshFileWriter::fileExt;
+      }
+
+      fileWriter = new CSU2BinaryMeshFileWriter(fileName, volumeDataSorter,
+                                                config->GetiZone(), config->GetnZone());
+
+      break;
+
     case TECPLOT_BINARY:
 
       if (fileName.empty())
@@ -714,6 +799,45 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case HDF5:
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Write HDF5 and the XDMF descriptor ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "HDF5" << fileName + CHDF5FileWriter::fileExt;
+      }
+
+      fileWriter = new CHDF5FileWriter(fileName, volumeDataSorter,
+                                       curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+
+      break;
+
+    case SURFACE_HDF5:
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      /*--- Write surface HDF5 and the XDMF descriptor ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "HDF5 surface" << fileName + CHDF5FileWriter::fileExt;
+      }
+
+      fileWriter = new CHDF5FileWriter(fileName, surfaceDataSorter,
+                                       curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+
+      break;
+
     default:
       fileWriter = NULL;
       break;
@@ -721,10 +845,35 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
   if (fileWriter != NULL){
 
+    /*--- Binary restarts and Paraview XML files can be written in the background (the
+     data is copied). The previous file of the same format is completed (by deleting
+     its writer) before the next is written, i.e. the output is double-buffered. ---*/
+
+    auto pending = asyncWriters.find(format);
+    if (pending != asyncWriters.end()) {
+      delete pending->second;
+      asyncWriters.erase(pending);
+    }
+
+    const bool async = config->GetOutput_Async() && ((format == RESTART_BINARY) ||
+                       (format == PARAVIEW_XML) || (format == SURFACE_PARAVIEW_XML));
+
     /*--- Write data to file ---*/
 
+    fileWriter->SetAsync(async);
     fileWriter->Write_Data();
 
+    if (async) {
+      asyncWriters[format] = fileWriter;
+
+      if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+        (*fileWritingTable) << " " << "(in background)";
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+      }
+      return;
+    }
+
     su2double BandWidth = fileWriter->Get_Bandwidth();
 
     /*--- Compute and store the bandwidth ---*/
@@ -762,6 +911,25 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
   if (writeFiles || config->GetTime_Domain())
     LoadDataIntoSorter(config, geometry, solver_container);
 
+  /*--- Sample the markers directly from the unsorted data, if it was not loaded above
+   *  only the points of the sampled markers are loaded. ---*/
+
+  if (config->GetnMarker_Sampling() > 0) {
+
+    if (femOutput)
+      SU2_MPI::Error("MARKER_SAMPLING is not available for the FEM solver.", CURRENT_FUNCTION);
+
+    if (surfaceSampler == nullptr)
+      surfaceSampler = new CSurfaceSampler(config, geometry, volumeFieldNames);
+
+    if (surfaceSampler->SampleIteration(config, iter)) {
+      if (!writeFiles && !config->GetTime_Domain())
+        LoadSampledDataIntoSorter(config, geometry, solver_container);
+
+      surfaceSampler->Sample(config, geometry, volumeDataSorter, iter);
+    }
+  }
+
   if (writeFiles){
 
     /*--- Partition and sort the data --- */
@@ -1624,6 +1792,47 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   }
 }
 
+void COutput::LoadSampledDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
+
+  /*--- Same as LoadDataIntoSorter but only for the points of the sampled markers (FVM). --- */
+
+  cachePosition = 0;
+  fieldIndexCache.clear();
+  curGetFieldIndex = 0;
+  fieldGetIndexCache.clear();
+
+  for (auto iPoint : surfaceSampler->GetLocalPoints()) {
+
+    buildFieldIndexCache = fieldIndexCache.empty();
+
+    LoadVolumeData(config, geometry, solver, iPoint);
+
+  }
+
+  cachePosition = 0;
+  fieldIndexCache.clear();
+  curGetFieldIndex = 0;
+  fieldGetIndexCache.clear();
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    if (config->GetSolid_Wall(iMarker) && surfaceSampler->IsSampled(iMarker)){
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++){
+
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+        if(geometry->node[iPoint]->GetDomain()){
+
+          buildFieldIndexCache = fieldIndexCache.empty();
+
+          LoadSurfaceData(config, geometry, solver, iPoint, iMarker, iVertex);
+
+        }
+      }
+    }
+  }
+}
+
 void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
 
   if (buildFieldIndexCache){
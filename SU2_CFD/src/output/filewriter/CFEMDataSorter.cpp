@@ -77,7 +77,6 @@ CFEMDataSorter::CFEMDataSorter(CConfig *config, CGeometry *geometry, const vecto
 CFEMDataSorter::~CFEMDataSorter(){
 
   if (Index != NULL)       delete [] Index;
-  if (idSend != NULL)      delete [] idSend;
   if (linearPartitioner != NULL) delete linearPartitioner;
 
 }
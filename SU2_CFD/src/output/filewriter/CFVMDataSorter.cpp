@@ -73,7 +73,6 @@ CFVMDataSorter::~CFVMDataSorter(){
   delete [] Local_Halo;
 
   if (Index != NULL)       delete [] Index;
-  if (idSend != NULL)      delete [] idSend;
   if (linearPartitioner != NULL) delete linearPartitioner;
 
 }
@@ -112,6 +111,11 @@ void CFVMDataSorter::SetHaloPoints(CGeometry *geometry, CConfig *config){
 
 void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
 
+  /*--- The connectivity does not change between outputs, it only needs to be sorted again
+   if the other mode (sorted or owned elements) is requested. ---*/
+
+  if (connectivitySorted && (val_sort == connectivityLinear)) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -128,6 +132,7 @@ void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool
   SetTotalElements();
 
   connectivitySorted = true;
+  connectivityLinear = val_sort;
 
 }
 
@@ -0,0 +1,287 @@
+/*!
+ * \file CHDF5FileWriter.cpp
+ * \brief Filewriter class for HDF5 files with an XDMF descriptor.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CHDF5FileWriter.hpp"
+#ifdef HAVE_HDF5
+  #include "hdf5.h"
+  #if defined(HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+    #define HAVE_PARALLEL_HDF5
+  #endif
+#endif
+#include <algorithm>
+
+const string CHDF5FileWriter::fileExt = ".h5";
+
+CHDF5FileWriter::CHDF5FileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                 unsigned long valTimeIter, su2double valTimeStep) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), timeIter(valTimeIter), timeStep(valTimeStep){}
+
+CHDF5FileWriter::~CHDF5FileWriter(){}
+
+string CHDF5FileWriter::DatasetName(string fieldName){
+
+  fieldName.erase(remove(fieldName.begin(), fieldName.end(), '"'), fieldName.end());
+  replace(fieldName.begin(), fieldName.end(), '/', '_');
+  return fieldName;
+}
+
+void CHDF5FileWriter::Write_Data(){
+
+  if (!dataSorter->GetConnectivitySorted()){
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  /*--- Set a timer for the file writing. ---*/
+
+#ifndef HAVE_MPI
+  startTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  startTime = MPI_Wtime();
+#endif
+
+#ifdef HAVE_HDF5
+
+  /*--- Local part of the topology, in XDMF "Mixed" format the type of each element is followed
+   by its nodes (0-based global indices), for poly-lines the number of nodes is also given. ---*/
+
+  vector<int64_t> topology;
+  topology.reserve(dataSorter->GetnConn() + 2*dataSorter->GetnElem());
+
+  auto addElements = [&](GEO_TYPE type, unsigned short nPoints, int64_t xdmfType){
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); iElem++) {
+      topology.push_back(xdmfType);
+      if (type == LINE) topology.push_back(nPoints);
+      for (unsigned short iNode = 0; iNode < nPoints; iNode++)
+        topology.push_back(int64_t(dataSorter->GetElem_Connectivity(type, iElem, iNode))-1);
+    }
+  };
+
+  addElements(LINE,          N_POINTS_LINE,          2);
+  addElements(TRIANGLE,      N_POINTS_TRIANGLE,      4);
+  addElements(QUADRILATERAL, N_POINTS_QUADRILATERAL, 5);
+  addElements(TETRAHEDRON,   N_POINTS_TETRAHEDRON,   6);
+  addElements(PYRAMID,       N_POINTS_PYRAMID,       7);
+  addElements(PRISM,         N_POINTS_PRISM,         8);
+  addElements(HEXAHEDRON,    N_POINTS_HEXAHEDRON,    9);
+
+  /*--- Position of the local part in the global topology. ---*/
+
+  unsigned long localSize = topology.size(), topologyOffset = 0, topologySize = 0;
+  vector<unsigned long> allSizes(size);
+  SU2_MPI::Allgather(&localSize, 1, MPI_UNSIGNED_LONG, allSizes.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) topologyOffset += allSizes[iRank];
+    topologySize += allSizes[iRank];
+  }
+
+  /*--- With parallel HDF5 all ranks create the file and write collectively, otherwise
+   the master creates the file and then each rank writes its part in turn. ---*/
+
+#ifdef HAVE_PARALLEL_HDF5
+  WriteHDF5(true, topology, topologyOffset, topologySize);
+#else
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (rank == iRank) WriteHDF5(iRank == MASTER_NODE, topology, topologyOffset, topologySize);
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+  }
+#endif
+
+  if (rank == MASTER_NODE) WriteXDMF(topologySize);
+
+#endif /* HAVE_HDF5 */
+
+  /*--- Compute and store the write time. ---*/
+
+#ifndef HAVE_MPI
+  stopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  stopTime = MPI_Wtime();
+#endif
+  usedTime = stopTime-startTime;
+
+  fileSize = Determine_Filesize(fileName);
+
+  /*--- Compute and store the bandwidth ---*/
+
+  bandwidth = fileSize/(1.0e6)/usedTime;
+}
+
+void CHDF5FileWriter::WriteHDF5(bool create, const vector<int64_t>& topology,
+                                unsigned long topologyOffset, unsigned long topologySize) const {
+#ifdef HAVE_HDF5
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const unsigned long myPoint = dataSorter->GetnPoints();
+  const unsigned long globalPoint = dataSorter->GetnPointsGlobal();
+  const unsigned long pointOffset = dataSorter->GetnPointCumulative(rank);
+
+  /*--- Open the file. ---*/
+
+  hid_t fileAccess = H5Pcreate(H5P_FILE_ACCESS);
+  hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
+#ifdef HAVE_PARALLEL_HDF5
+  H5Pset_fapl_mpio(fileAccess, MPI_COMM_WORLD, MPI_INFO_NULL);
+  H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  hid_t file = create? H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fileAccess) :
+                       H5Fopen(fileName.c_str(), H5F_ACC_RDWR, fileAccess);
+  if (file < 0)
+    SU2_MPI::Error(string("Unable to open HDF5 file ") + fileName, CURRENT_FUNCTION);
+
+  hid_t fields = create? H5Gcreate2(file, "Fields", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) :
+                         H5Gopen2(file, "Fields", H5P_DEFAULT);
+
+  /*--- Create (or open) a chunked 1D or 2D dataset and write the local rows to it. ---*/
+
+  auto writeDataset = [&](hid_t location, const string& name, hid_t type, const void* data,
+                          unsigned long localRows, unsigned long globalRows, unsigned long offset,
+                          unsigned long nCol) {
+
+    const int nDims = (nCol > 1)? 2 : 1;
+    const hsize_t dims[] = {globalRows, nCol};
+    const hsize_t count[] = {localRows, nCol};
+    const hsize_t start[] = {offset, 0};
+    const hsize_t memDims[] = {max<hsize_t>(localRows, 1), nCol};
+    const hsize_t chunk[] = {max<hsize_t>(min<hsize_t>(globalRows, chunkSize), 1), nCol};
+
+    hid_t fileSpace = H5Screate_simple(nDims, dims, nullptr);
+    hid_t dataset;
+
+    if (create) {
+      hid_t creation = H5Pcreate(H5P_DATASET_CREATE);
+      H5Pset_chunk(creation, nDims, chunk);
+      dataset = H5Dcreate2(location, name.c_str(), type, fileSpace, H5P_DEFAULT, creation, H5P_DEFAULT);
+      H5Pclose(creation);
+    }
+    else {
+      dataset = H5Dopen2(location, name.c_str(), H5P_DEFAULT);
+    }
+    if (dataset < 0)
+      SU2_MPI::Error(string("Unable to create HDF5 dataset ") + name, CURRENT_FUNCTION);
+
+    hid_t memSpace = H5Screate_simple(nDims, memDims, nullptr);
+
+    if (localRows > 0) {
+      H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+    }
+    else {
+      H5Sselect_none(fileSpace);
+      H5Sselect_none(memSpace);
+    }
+
+    if (H5Dwrite(dataset, type, memSpace, fileSpace, transfer, data) < 0)
+      SU2_MPI::Error(string("Writing HDF5 dataset ") + name + string(" failed"), CURRENT_FUNCTION);
+
+    H5Sclose(memSpace);
+    H5Sclose(fileSpace);
+    H5Dclose(dataset);
+  };
+
+  /*--- Coordinates, always 3 per point. ---*/
+
+  vector<passivedouble> buffer(myPoint*3, 0.0);
+
+  for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      buffer[iPoint*3+iDim] = dataSorter->GetData(iDim, iPoint);
+
+  writeDataset(file, "Geometry", H5T_NATIVE_DOUBLE, buffer.data(), myPoint, globalPoint, pointOffset, 3);
+
+  /*--- Elements. ---*/
+
+  writeDataset(file, "Topology", H5T_NATIVE_INT64, topology.data(), topology.size(), topologySize, topologyOffset, 1);
+
+  /*--- One dataset per field. ---*/
+
+  for (unsigned short iField = nDim; iField < fieldNames.size(); iField++) {
+
+    for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++)
+      buffer[iPoint] = dataSorter->GetData(iField, iPoint);
+
+    writeDataset(fields, DatasetName(fieldNames[iField]), H5T_NATIVE_DOUBLE, buffer.data(),
+                 myPoint, globalPoint, pointOffset, 1);
+  }
+
+  H5Gclose(fields);
+  H5Fclose(file);
+  H5Pclose(transfer);
+  H5Pclose(fileAccess);
+
+#endif /* HAVE_HDF5 */
+}
+
+void CHDF5FileWriter::WriteXDMF(unsigned long topologySize) const {
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const string nPoint = to_string(dataSorter->GetnPointsGlobal());
+
+  /*--- The datasets are referenced relative to the descriptor, which is next to the HDF5 file. ---*/
+
+  const string baseName = fileName.substr(0, fileName.size()-fileExt.size());
+  const string dataFile = fileName.substr(fileName.find_last_of('/')+1);
+
+  auto dataItem = [&](const string& dims, const string& type, const string& dataset) {
+    return "<DataItem Dimensions=\"" + dims + "\" NumberType=\"" + type + "\" Precision=\"8\" Format=\"HDF\">" +
+           dataFile + ":/" + dataset + "</DataItem>\n";
+  };
+
+  ofstream xdmf(baseName + ".xmf");
+  xdmf.precision(15);
+
+  xdmf << "<?xml version=\"1.0\" ?>\n";
+  xdmf << "<Xdmf Version=\"3.0\">\n";
+  xdmf << "<Domain>\n";
+  xdmf << "<Grid Name=\"SU2\" GridType=\"Uniform\">\n";
+
+  if (timeStep > 0.0)
+    xdmf << "<Time Value=\"" << SU2_TYPE::GetValue(timeStep)*timeIter << "\"/>\n";
+
+  xdmf << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << dataSorter->GetnElemGlobal() << "\">\n";
+  xdmf << dataItem(to_string(topologySize), "Int", "Topology");
+  xdmf << "</Topology>\n";
+
+  xdmf << "<Geometry GeometryType=\"XYZ\">\n";
+  xdmf << dataItem(nPoint + " 3", "Float", "Geometry");
+  xdmf << "</Geometry>\n";
+
+  for (unsigned short iField = nDim; iField < fieldNames.size(); iField++) {
+    const string name = DatasetName(fieldNames[iField]);
+    xdmf << "<Attribute Name=\"" << name << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+    xdmf << dataItem(nPoint, "Float", "Fields/" + name);
+    xdmf << "</Attribute>\n";
+  }
+
+  xdmf << "</Grid>\n";
+  xdmf << "</Domain>\n";
+  xdmf << "</Xdmf>\n";
+}
@@ -62,11 +62,11 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   connSend     = NULL;
   dataBuffer   = NULL;
   passiveDoubleBuffer = NULL;
-  doubleBuffer = NULL;
-  idSend       = NULL;
   nSends = 0;
   nRecvs = 0;
 
+  connectivitySorted = false;
+
   nLocalPointsBeforeSort  = 0;
   nGlobalPointBeforeSort = 0;
 
@@ -110,163 +110,24 @@ CParallelDataSorter::~CParallelDataSorter(){
 
 void CParallelDataSorter::SortOutputData() {
 
-  int VARS_PER_POINT = GlobalField_Counter;
-
-#ifdef HAVE_MPI
-  SU2_MPI::Request *send_req, *recv_req;
-  SU2_MPI::Status status;
-  int ind;
-#endif
-
-  /*--- Allocate the memory that we need for receiving the conn
-   values and then cue up the non-blocking receives. Note that
-   we do not include our own rank in the communications. We will
-   directly copy our own data later. ---*/
-
-
-  unsigned long *idRecv = new unsigned long[nPoint_Recv[size]]();
-
-#ifdef HAVE_MPI
-  /*--- We need double the number of messages to send both the conn.
-   and the global IDs. ---*/
-
-  send_req = new SU2_MPI::Request[2*nSends];
-  recv_req = new SU2_MPI::Request[2*nRecvs];
-
-  unsigned long iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
-      int ll     = VARS_PER_POINT*nPoint_Recv[ii];
-      int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
-      int count  = VARS_PER_POINT*kk;
-      int source = ii;
-      int tag    = ii + 1;
-      SU2_MPI::Irecv(&(doubleBuffer[ll]), count, MPI_DOUBLE, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
-      iMessage++;
-    }
-  }
-
-  /*--- Launch the non-blocking sends of the connectivity. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
-      int ll = VARS_PER_POINT*nPoint_Send[ii];
-      int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
-      int count  = VARS_PER_POINT*kk;
-      int dest = ii;
-      int tag    = rank + 1;
-      SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
-      iMessage++;
-    }
-  }
-
-  /*--- Repeat the process to communicate the global IDs. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
-      int ll     = nPoint_Recv[ii];
-      int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
-      int count  = kk;
-      int source = ii;
-      int tag    = ii + 1;
-      SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
-      iMessage++;
-    }
-  }
-
-  /*--- Launch the non-blocking sends of the global IDs. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
-      int ll = nPoint_Send[ii];
-      int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
-      int count  = kk;
-      int dest   = ii;
-      int tag    = rank + 1;
-      SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
-      iMessage++;
-    }
-  }
-#endif
-
-  /*--- Copy my own rank's data into the recv buffer directly. ---*/
-
-  int mm = VARS_PER_POINT*nPoint_Recv[rank];
-  int ll = VARS_PER_POINT*nPoint_Send[rank];
-  int kk = VARS_PER_POINT*nPoint_Send[rank+1];
+  const int VARS_PER_POINT = GlobalField_Counter;
 
-  for (int nn=ll; nn<kk; nn++, mm++) doubleBuffer[mm] = connSend[nn];
+  /*--- Exchange the send buffer, which was filled directly with SetUnsorted_Data, the counts
+   and displacements were computed once in PrepareSendBuffers. ---*/
 
-  mm = nPoint_Recv[rank];
-  ll = nPoint_Send[rank];
-  kk = nPoint_Send[rank+1];
+  SU2_MPI::Alltoallv(connSend, sendCounts.data(), sendDispls.data(), MPI_DOUBLE,
+                     recvBuffer.data(), recvCounts.data(), recvDispls.data(), MPI_DOUBLE,
+                     MPI_COMM_WORLD);
 
-  for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
+  /*--- Unpack into the sorted positions, extracting the underlying double values. ---*/
 
-  /*--- Wait for the non-blocking sends and recvs to complete. ---*/
-
-#ifdef HAVE_MPI
-  int number = 2*nSends;
-  for (int ii = 0; ii < number; ii++)
-    SU2_MPI::Waitany(number, send_req, &ind, &status);
-
-  number = 2*nRecvs;
-  for (int ii = 0; ii < number; ii++)
-    SU2_MPI::Waitany(number, recv_req, &ind, &status);
-
-  delete [] send_req;
-  delete [] recv_req;
-#endif
-
-  /*--- Note, passiveDoubleBuffer and doubleBuffer point to the same address.
-   * This is the reason why we have to do the following copy/reordering in two steps. ---*/
-
-  /*--- Step 1: Extract the underlying double value --- */
-
-  if (!std::is_same<su2double, passivedouble>::value){
-    for (int jj = 0; jj < VARS_PER_POINT*nPoint_Recv[size]; jj++){
-      const passivedouble tmpVal = SU2_TYPE::GetValue(doubleBuffer[jj]);
-      passiveDoubleBuffer[jj] = tmpVal;
-      /*--- For some AD datatypes a call of the destructor is
-       *  necessary to properly delete the AD type ---*/
-      doubleBuffer[jj].~su2double();
-    }
+  for (unsigned long iPoint = 0; iPoint < sortedIndex.size(); iPoint++) {
+    const su2double* source = &recvBuffer[iPoint*VARS_PER_POINT];
+    passivedouble* target = &passiveDoubleBuffer[sortedIndex[iPoint]*VARS_PER_POINT];
+    for (int iVar = 0; iVar < VARS_PER_POINT; iVar++)
+      target[iVar] = SU2_TYPE::GetValue(source[iVar]);
   }
 
-  /*--- Step 2: Reorder the data in the buffer --- */
-
-  passivedouble *tmpBuffer = new passivedouble[nPoint_Recv[size]];
-  for (int jj = 0; jj < VARS_PER_POINT; jj++){
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      tmpBuffer[idRecv[ii]] = passiveDoubleBuffer[ii*VARS_PER_POINT+jj];
-    }
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      passiveDoubleBuffer[ii*VARS_PER_POINT+jj] = tmpBuffer[ii];
-    }
-  }
-
-  delete [] tmpBuffer;
-
-  /*--- Store the total number of local points my rank has for
-   the current section after completing the communications. ---*/
-
-  nPoints = nPoint_Recv[size];
-
-  /*--- Reduce the total number of points we will write in the output files. ---*/
-
-  SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-
-  /*--- Free temporary memory from communications ---*/
-
-  delete [] idRecv;
 }
 
 void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalID){
@@ -321,19 +182,16 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
   connSend = NULL;
   connSend = new su2double[VARS_PER_POINT*nPoint_Send[size]]();
 
-  /*--- Allocate the data buffer to hold the sorted data. We have to make it large enough
-   * to hold passivedoubles and su2doubles ---*/
-  unsigned short maxSize = max(sizeof(passivedouble), sizeof(su2double));
-  dataBuffer = new char[VARS_PER_POINT*nPoint_Recv[size]*maxSize];
+  /*--- Allocate the data buffer to hold the sorted data, and the buffer to receive it. ---*/
 
-  /*--- doubleBuffer and passiveDouble buffer use the same memory allocated above using the dataBuffer. ---*/
-
-  doubleBuffer = reinterpret_cast<su2double*>(dataBuffer);
+  dataBuffer = new char[VARS_PER_POINT*nPoint_Recv[size]*sizeof(passivedouble)];
   passiveDoubleBuffer = reinterpret_cast<passivedouble*>(dataBuffer);
 
+  recvBuffer.resize(VARS_PER_POINT*nPoint_Recv[size]);
+
   /*--- Allocate arrays for sending the global ID. ---*/
 
-  idSend = new unsigned long[nPoint_Send[size]]();
+  vector<unsigned long> idSend(nPoint_Send[size]);
 
   /*--- Create an index variable to keep track of our index
    positions as we load up the send buffer. ---*/
@@ -375,6 +233,43 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
   delete [] index;
   delete [] idIndex;
+
+  /*--- Counts and displacements of the data exchanged with each processor, the
+   data of the points is contiguous in the send and receive buffers. ---*/
+
+  sendCounts.resize(size); sendDispls.resize(size);
+  recvCounts.resize(size); recvDispls.resize(size);
+
+  vector<int> idSendCounts(size), idSendDispls(size), idRecvCounts(size), idRecvDispls(size);
+
+  for (int ii = 0; ii < size; ii++) {
+    idSendCounts[ii] = nPoint_Send[ii+1] - nPoint_Send[ii];
+    idSendDispls[ii] = nPoint_Send[ii];
+    idRecvCounts[ii] = nPoint_Recv[ii+1] - nPoint_Recv[ii];
+    idRecvDispls[ii] = nPoint_Recv[ii];
+
+    sendCounts[ii] = VARS_PER_POINT*idSendCounts[ii];
+    sendDispls[ii] = VARS_PER_POINT*idSendDispls[ii];
+    recvCounts[ii] = VARS_PER_POINT*idRecvCounts[ii];
+    recvDispls[ii] = VARS_PER_POINT*idRecvDispls[ii];
+  }
+
+  /*--- Communicate the global IDs (minus offset), which are the positions of the
+   received points in the sorted data. This does not change between outputs. ---*/
+
+  sortedIndex.resize(nPoint_Recv[size]);
+
+  SU2_MPI::Alltoallv(idSend.data(), idSendCounts.data(), idSendDispls.data(), MPI_UNSIGNED_LONG,
+                     sortedIndex.data(), idRecvCounts.data(), idRecvDispls.data(), MPI_UNSIGNED_LONG,
+                     MPI_COMM_WORLD);
+
+  /*--- Store the total number of local points my rank has after sorting,
+   and reduce the total number of points we will write in the output files. ---*/
+
+  nPoints = nPoint_Recv[size];
+
+  SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
+                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 }
 
 unsigned long CParallelDataSorter::GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const {
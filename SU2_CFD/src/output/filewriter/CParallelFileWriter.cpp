@@ -59,13 +59,96 @@ CFileWriter::CFileWriter(string valFileName, string valFileExt):
 
 CFileWriter::~CFileWriter(){
 
+  WaitForCompletion();
+
+}
+
+void CFileWriter::SetAsync(bool async){
+
+#ifdef HAVE_MPI
+  asyncWrite = async;
+#endif
+
 }
 
+void CFileWriter::WaitForCompletion(){
+
+#ifdef HAVE_MPI
+
+  if (!asyncPending) return;
+
+  startTime = MPI_Wtime();
+
+  MPI_Waitall(int(asyncRequests.size()), asyncRequests.data(), MPI_STATUSES_IGNORE);
+
+  stopTime = MPI_Wtime();
+
+  usedTime += stopTime - startTime;
+
+  vector<MPI_Request>().swap(asyncRequests);
+  vector<vector<char> >().swap(asyncBuffers);
+
+  /*--- Close the file as for a synchronous write. ---*/
+
+  asyncPending = false;
+  asyncWrite = false;
+
+  CloseMPIFile();
+
+#endif
+
+}
+
+#ifdef HAVE_MPI
+bool CFileWriter::PostAsyncWrite(const void *data, unsigned long sizeInBytes,
+                                 unsigned long offsetInBytes, bool collective){
+
+  startTime = MPI_Wtime();
+
+  /*--- Copy the data, the moves of asyncBuffers do not change the address of
+   the copies. The file view is not used since it cannot be changed while
+   there are non-blocking operations pending. ---*/
+
+  const char* begin = static_cast<const char*>(data);
+  asyncBuffers.emplace_back(begin, begin+sizeInBytes);
+  asyncRequests.push_back(MPI_REQUEST_NULL);
+
+  char* buffer = asyncBuffers.back().data();
+  MPI_Request* request = &asyncRequests.back();
+
+  int ierr = MPI_SUCCESS;
+
+  if (collective) {
+#if (MPI_VERSION > 3) || ((MPI_VERSION == 3) && (MPI_SUBVERSION >= 1))
+    ierr = MPI_File_iwrite_at_all(fhw, offsetInBytes, buffer, int(sizeInBytes), MPI_BYTE, request);
+#else
+    ierr = MPI_File_iwrite_at(fhw, offsetInBytes, buffer, int(sizeInBytes), MPI_BYTE, request);
+#endif
+  }
+  else {
+    ierr = MPI_File_iwrite_at(fhw, offsetInBytes, buffer, int(sizeInBytes), MPI_BYTE, request);
+  }
+
+  stopTime = MPI_Wtime();
+
+  usedTime += stopTime - startTime;
+
+  return (ierr == MPI_SUCCESS);
+}
+#endif
+
 bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes,
                                         unsigned long totalSizeInBytes, unsigned long offsetInBytes){
   
 #ifdef HAVE_MPI
 
+  if (asyncWrite) {
+    const bool success = PostAsyncWrite(data, sizeInBytes, disp + offsetInBytes, true);
+    disp     += totalSizeInBytes;
+    fileSize += sizeInBytes;
+    return success;
+  }
+
   startTime = MPI_Wtime();
   
   MPI_Datatype filetype;
@@ -120,6 +203,15 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
   
 #ifdef HAVE_MPI
   
+  if (asyncWrite) {
+    bool success = true;
+    if (rank == processor)
+      success = PostAsyncWrite(data, sizeInBytes, disp, false);
+    disp     += sizeInBytes;
+    fileSize += sizeInBytes;
+    return success;
+  }
+
   startTime = MPI_Wtime();
   
   int ierr = MPI_SUCCESS;
@@ -164,6 +256,15 @@ bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
   
 #ifdef HAVE_MPI
 
+  if (asyncWrite) {
+    bool success = true;
+    if (rank == processor)
+      success = PostAsyncWrite(str.c_str(), str.size()*sizeof(char), disp, false);
+    disp     += str.size()*sizeof(char);
+    fileSize += str.size()*sizeof(char);
+    return success;
+  }
+
   startTime = MPI_Wtime();
   
   int ierr = MPI_SUCCESS;
@@ -255,6 +356,14 @@ bool CFileWriter::OpenMPIFile(){
 bool CFileWriter::CloseMPIFile(){
   
 #ifdef HAVE_MPI
+  /*--- For asynchronous writes the file is closed once the writes complete,
+   see WaitForCompletion. ---*/
+
+  if (asyncWrite) {
+    asyncPending = true;
+    return true;
+  }
+
   /*--- All ranks close the file after writing. ---*/
 
   MPI_File_close(&fhw);
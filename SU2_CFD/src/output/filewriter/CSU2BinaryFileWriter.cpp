@@ -26,11 +26,17 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../../../Common/include/omp_structure.hpp"
+#include <cmath>
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter)  :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           bool valCompress, vector<passivedouble> valLossyTolerance)  :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  compress(valCompress),
+  lossyTolerance(std::move(valLossyTolerance)){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -39,6 +45,11 @@ CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
 
 void CSU2BinaryFileWriter::Write_Data(){
 
+  if (compress) {
+    Write_Data_Compressed();
+    return;
+  }
+
   /*--- Local variables ---*/
 
   unsigned short iVar;
@@ -93,3 +104,162 @@ void CSU2BinaryFileWriter::Write_Data(){
   CloseMPIFile();
 
 }
+
+void CSU2BinaryFileWriter::Write_Data_Compressed(){
+
+  using namespace SU2CompressedRestart;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nVar = fieldNames.size();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  const unsigned long firstPoint = dataSorter->GetnPointCumulative(rank);
+  const passivedouble* data = dataSorter->GetData();
+
+  /*--- A delta needs a keyframe in another file, with the same fields and points on every rank. ---*/
+
+  const string baseName = fileName.substr(fileName.find_last_of('/')+1);
+
+  int localDelta = writeDelta && (keyframe != nullptr) && (keyframe->fileName != baseName) &&
+                   (keyframe->fieldNames == fieldNames) && (keyframe->firstPoint == firstPoint) &&
+                   (keyframe->data.size() == nPoint*nVar);
+  int delta = 0;
+  SU2_MPI::Allreduce(&localDelta, &delta, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  /*--- The absolute error bounds of the lossy fields are relative to the maximum magnitude
+   of the field. Fields with non-finite values are stored without loss, as are fields with
+   tolerances so small that the quantized values could overflow. Deltas use the error bounds
+   of the keyframe, since the quantized values are stored relative to those of the keyframe. ---*/
+
+  vector<passivedouble> errorBound(nVar, 0.0);
+
+  if (delta) {
+    errorBound = keyframe->errorBound;
+  }
+  else if (!lossyTolerance.empty()) {
+    vector<passivedouble> localMax(2*nVar, 0.0), globalMax(2*nVar, 0.0);
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+        const passivedouble val = data[iPoint*nVar+iVar];
+        if (std::isfinite(val)) localMax[iVar] = max(localMax[iVar], fabs(val));
+        else localMax[nVar+iVar] = 1.0;
+      }
+    }
+#ifdef HAVE_MPI
+    CBaseMPIWrapper::Allreduce(localMax.data(), globalMax.data(), 2*nVar, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    globalMax = localMax;
+#endif
+
+    for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+      if ((lossyTolerance[iVar] > 1e-15) && (globalMax[nVar+iVar] == 0.0))
+        errorBound[iVar] = lossyTolerance[iVar]*globalMax[iVar];
+    }
+  }
+
+  /*--- Split the local points into blocks and encode them. ---*/
+
+  const unsigned long nBlock = (nPoint + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  vector<vector<unsigned char> > blocks(nBlock);
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
+    const unsigned long begin = iBlock*BLOCK_SIZE;
+    const unsigned long nPointBlock = min<unsigned long>(BLOCK_SIZE, nPoint-begin);
+    const passivedouble* reference = delta? &keyframe->data[begin*nVar] : nullptr;
+    CompressionToolbox::EncodeBlock(&data[begin*nVar], nPointBlock, nVar, errorBound.data(), blocks[iBlock], reference);
+  }
+
+  /*--- Sizes and offsets of the blocks of each rank. ---*/
+
+  unsigned long sizeInBytesLocal = 0;
+  for (const auto& block : blocks) sizeInBytesLocal += block.size();
+
+  unsigned long localCounts[2] = {nBlock, sizeInBytesLocal};
+  vector<unsigned long> counts(2*size);
+  SU2_MPI::Allgather(localCounts, 2, MPI_UNSIGNED_LONG, counts.data(), 2, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  unsigned long nBlock_Global = 0, blockOffset = 0, sizeInBytesGlobal = 0, offsetInBytes = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) {
+      blockOffset += counts[2*iRank];
+      offsetInBytes += counts[2*iRank+1];
+    }
+    nBlock_Global += counts[2*iRank];
+    sizeInBytesGlobal += counts[2*iRank+1];
+  }
+
+  const unsigned long sizeInBytesHeader = 5*sizeof(int) + nVar*(CGNS_STRING_SIZE + sizeof(passivedouble)) +
+                                          (delta? static_cast<unsigned long>(KEYFRAME_NAME_SIZE) : 0ul) +
+                                          nBlock_Global*RECORD_SIZE*sizeof(uint64_t);
+
+  /*--- Index records of the local blocks. ---*/
+
+  vector<uint64_t> index(nBlock*RECORD_SIZE);
+  unsigned long blockPosition = sizeInBytesHeader + offsetInBytes;
+
+  for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
+    uint64_t* record = &index[iBlock*RECORD_SIZE];
+    record[FIRST_POINT] = firstPoint + iBlock*BLOCK_SIZE;
+    record[NPOINT] = min<unsigned long>(BLOCK_SIZE, nPoint-iBlock*BLOCK_SIZE);
+    record[OFFSET] = blockPosition;
+    record[SIZE] = blocks[iBlock].size();
+    record[CHECKSUM] = CompressionToolbox::Checksum(blocks[iBlock].data(), blocks[iBlock].size());
+    record[REFERENCE] = delta? keyframe->blockChecksum[iBlock] : 0;
+    blockPosition += blocks[iBlock].size();
+  }
+
+  /*--- Header, names, error bounds, and keyframe name, written by the master. ---*/
+
+  int var_buf[5] = {MAGIC_NUMBER, int(nVar), int(nPoint_Global), int(nBlock_Global), delta? DELTA : KEYFRAME};
+  char str_buf[CGNS_STRING_SIZE];
+
+  OpenMPIFile();
+
+  WriteMPIBinaryData(var_buf, 5*sizeof(int), MASTER_NODE);
+
+  for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  WriteMPIBinaryData(errorBound.data(), nVar*sizeof(passivedouble), MASTER_NODE);
+
+  if (delta) {
+    vector<char> name_buf(KEYFRAME_NAME_SIZE, '\0');
+    strncpy(name_buf.data(), keyframe->fileName.c_str(), KEYFRAME_NAME_SIZE-1);
+    WriteMPIBinaryData(name_buf.data(), KEYFRAME_NAME_SIZE, MASTER_NODE);
+  }
+
+  /*--- Collectively write the index and then the blocks, which are concatenated to avoid
+   one write per block. ---*/
+
+  WriteMPIBinaryDataAll(index.data(), index.size()*sizeof(uint64_t),
+                        nBlock_Global*RECORD_SIZE*sizeof(uint64_t), blockOffset*RECORD_SIZE*sizeof(uint64_t));
+
+  vector<unsigned char> buffer;
+  buffer.reserve(sizeInBytesLocal);
+  for (auto& block : blocks) {
+    buffer.insert(buffer.end(), block.begin(), block.end());
+    vector<unsigned char>().swap(block);
+  }
+
+  WriteMPIBinaryDataAll(buffer.data(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  CloseMPIFile();
+
+  /*--- Keep the data of the new keyframe for the next deltas. ---*/
+
+  if ((keyframe != nullptr) && !delta) {
+    keyframe->fileName = baseName;
+    keyframe->firstPoint = firstPoint;
+    keyframe->fieldNames = fieldNames;
+    keyframe->data.assign(data, data+nPoint*nVar);
+    keyframe->errorBound = errorBound;
+    keyframe->blockChecksum.resize(nBlock);
+    for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++)
+      keyframe->blockChecksum[iBlock] = index[iBlock*RECORD_SIZE+CHECKSUM];
+  }
+
+}
@@ -0,0 +1,224 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class for the SU2 native binary mesh format.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+#include <algorithm>
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                   unsigned short valiZone, unsigned short valnZone) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+
+
+CSU2BinaryMeshFileWriter::~CSU2BinaryMeshFileWriter(){
+
+}
+
+void CSU2BinaryMeshFileWriter::ReadBoundaryFile(vector<string>& names, vector<vector<uint64_t> >& conn) const {
+
+  const string str = "boundary.dat";
+
+  ifstream input_file(str.c_str(), ios::in);
+
+  if (!input_file.is_open()){
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  /*--- Same format as the markers of the ASCII mesh file, plus the SEND_TO line. ---*/
+
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    if (text_line.find("NMARK=",0) == string::npos) continue;
+
+    text_line.erase(0,6);
+    const unsigned long nMarker = atoi(text_line.c_str());
+    names.resize(nMarker);
+    conn.resize(nMarker);
+
+    for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++) {
+
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      for (auto c : {' ', '\r', '\n'})
+        text_line.erase(remove(text_line.begin(), text_line.end(), c), text_line.end());
+      names[iMarker] = text_line;
+
+      getline(input_file, text_line);
+      text_line.erase(0,13);
+      const unsigned long nElem_Bound = atoi(text_line.c_str());
+
+      /*--- Skip SEND_TO. ---*/
+      getline(input_file, text_line);
+
+      conn[iMarker].resize(nElem_Bound*SU2_CONN_SIZE, 0);
+
+      for (unsigned long iElem = 0; iElem < nElem_Bound; iElem++) {
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+
+        uint64_t* elem = &conn[iMarker][iElem*SU2_CONN_SIZE];
+        bound_line >> elem[1];
+        const auto nNodes = CSU2BinaryMeshReaderFVM::GetNodesPerElement(elem[1]);
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          bound_line >> elem[SU2_CONN_SKIP+iNode];
+      }
+    }
+    break;
+  }
+
+  input_file.close();
+
+}
+
+void CSU2BinaryMeshFileWriter::Write_Data(){
+
+  using namespace SU2BinaryMesh;
+
+  if (nZone > 1) {
+    SU2_MPI::Error("The SU2 binary mesh format stores a single zone, use MESH_OUT_FORMAT= SU2 for multizone meshes.",
+                   CURRENT_FUNCTION);
+  }
+
+  const GEO_TYPE elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+
+  const unsigned long nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+
+  /*--- Number of local elements, and global index of the first one. ---*/
+
+  unsigned long nElem = 0;
+  for (auto type : elemTypes) nElem += dataSorter->GetnElem(type);
+
+  vector<unsigned long> nElemRank(size);
+  SU2_MPI::Allgather(&nElem, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  unsigned long elemOffset = 0, nElemGlobal = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) elemOffset += nElemRank[iRank];
+    nElemGlobal += nElemRank[iRank];
+  }
+
+  /*--- Fixed size records for the coordinates and the elements. ---*/
+
+  vector<passivedouble> coords(nPoint*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned long iDim = 0; iDim < nDim; iDim++)
+      coords[iPoint*nDim+iDim] = dataSorter->GetData(iDim, iPoint);
+
+  vector<uint64_t> conn(nElem*SU2_CONN_SIZE, 0);
+  unsigned long iElemLocal = 0;
+  for (auto type : elemTypes) {
+    const auto nNodes = CSU2BinaryMeshReaderFVM::GetNodesPerElement(type);
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); iElem++) {
+      uint64_t* elem = &conn[iElemLocal*SU2_CONN_SIZE];
+      elem[0] = elemOffset + iElemLocal;
+      elem[1] = type;
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+        elem[SU2_CONN_SKIP+iNode] = dataSorter->GetElem_Connectivity(type, iElem, iNode) - 1;
+      iElemLocal++;
+    }
+  }
+
+  /*--- Header and markers, assembled by the master. ---*/
+
+  uint64_t header[HEADER_SIZE] = {0};
+  header[MAGIC]          = MAGIC_NUMBER;
+  header[FORMAT]         = FORMAT_VERSION;
+  header[NDIM]           = nDim;
+  header[NPOINT]         = nPointGlobal;
+  header[NELEM]          = nElemGlobal;
+  header[OFFSET_COORDS]  = HEADER_SIZE*sizeof(uint64_t);
+  header[OFFSET_ELEMS]   = header[OFFSET_COORDS] + nPointGlobal*nDim*sizeof(passivedouble);
+  header[OFFSET_MARKERS] = header[OFFSET_ELEMS] + nElemGlobal*SU2_CONN_SIZE*sizeof(uint64_t);
+
+  vector<char> markerBlock;
+
+  if (rank == MASTER_NODE) {
+
+    vector<string> names;
+    vector<vector<uint64_t> > markerConn;
+    ReadBoundaryFile(names, markerConn);
+
+    const unsigned long nMarker = names.size();
+    header[NMARKER] = nMarker;
+
+    /*--- Table of names, sizes, and offsets, followed by the connectivity of each marker. ---*/
+
+    unsigned long blockSize = nMarker*MARKER_RECORD_SIZE;
+    for (const auto& markerElems : markerConn) blockSize += markerElems.size()*sizeof(uint64_t);
+    markerBlock.resize(blockSize, '\0');
+
+    uint64_t offset = header[OFFSET_MARKERS] + nMarker*MARKER_RECORD_SIZE;
+
+    for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++) {
+
+      if (names[iMarker].size() >= MARKER_NAME_SIZE) {
+        SU2_MPI::Error("Marker name " + names[iMarker] + " is too long for the SU2 binary mesh format.", CURRENT_FUNCTION);
+      }
+
+      char* record = &markerBlock[iMarker*MARKER_RECORD_SIZE];
+      const uint64_t nElem_Bound = markerConn[iMarker].size()/SU2_CONN_SIZE;
+
+      memcpy(record, names[iMarker].c_str(), names[iMarker].size());
+      memcpy(record + MARKER_NAME_SIZE, &nElem_Bound, sizeof(uint64_t));
+      memcpy(record + MARKER_NAME_SIZE + sizeof(uint64_t), &offset, sizeof(uint64_t));
+
+      const unsigned long nBytes = markerConn[iMarker].size()*sizeof(uint64_t);
+      if (nBytes > 0)
+        memcpy(&markerBlock[offset - header[OFFSET_MARKERS]], markerConn[iMarker].data(), nBytes);
+      offset += nBytes;
+    }
+  }
+
+  /*--- All ranks need the size of the marker block to keep the file displacement consistent. ---*/
+
+  unsigned long markerBlockSize = markerBlock.size();
+  SU2_MPI::Bcast(&markerBlockSize, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Write the sections in order, the points and elements collectively. ---*/
+
+  OpenMPIFile();
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  const unsigned long pointSize = nDim*sizeof(passivedouble);
+  WriteMPIBinaryDataAll(coords.data(), nPoint*pointSize, nPointGlobal*pointSize,
+                        dataSorter->GetnPointCumulative(rank)*pointSize);
+
+  const unsigned long elemSize = SU2_CONN_SIZE*sizeof(uint64_t);
+  WriteMPIBinaryDataAll(conn.data(), nElem*elemSize, nElemGlobal*elemSize, elemOffset*elemSize);
+
+  WriteMPIBinaryData(markerBlock.data(), markerBlockSize, MASTER_NODE);
+
+  CloseMPIFile();
+
+}
@@ -0,0 +1,174 @@
+/*!
+ * \file CProbes.cpp
+ * \brief Point and line probes of the volume solution.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CProbes.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../../Common/include/adt_structure.hpp"
+
+CProbes::CProbes(const CConfig* config) {
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  /*--- Points, 3 coordinates each. ---*/
+
+  if (config->GetnProbe_Points() % 3 != 0)
+    SU2_MPI::Error("PROBE_POINTS must contain 3 coordinates (x, y, z) per probe.", CURRENT_FUNCTION);
+
+  const su2double* points = config->GetProbe_Points();
+
+  for (unsigned short iProbe = 0; iProbe < config->GetnProbe_Points()/3; iProbe++) {
+    names.push_back("probe_" + to_string(iProbe));
+    coord.insert(coord.end(), points+3*iProbe, points+3*(iProbe+1));
+  }
+
+  /*--- Lines, start and end coordinates followed by the number of points (including the ends). ---*/
+
+  if (config->GetnProbe_Lines() % 7 != 0)
+    SU2_MPI::Error("PROBE_LINES must contain 7 values (x0, y0, z0, x1, y1, z1, number of points) per line.",
+                   CURRENT_FUNCTION);
+
+  const su2double* lines = config->GetProbe_Lines();
+
+  for (unsigned short iLine = 0; iLine < config->GetnProbe_Lines()/7; iLine++) {
+    const su2double* line = lines+7*iLine;
+    const long nPoint = SU2_TYPE::Int(line[6]);
+    if (nPoint < 2)
+      SU2_MPI::Error("The lines in PROBE_LINES must have at least 2 points.", CURRENT_FUNCTION);
+
+    for (long iPoint = 0; iPoint < nPoint; iPoint++) {
+      names.push_back("line" + to_string(iLine) + "_" + to_string(iPoint));
+      const su2double t = su2double(iPoint) / (nPoint-1);
+      for (unsigned short iDim = 0; iDim < 3; iDim++)
+        coord.push_back((1.0-t)*line[iDim] + t*line[3+iDim]);
+    }
+  }
+}
+
+void CProbes::Locate(CGeometry* geometry) {
+
+  nDim = geometry->GetnDim();
+  const auto nProbe = GetnProbe();
+
+  /*--- Local ADT of the elements of this rank (including the ones of the halo layer). ---*/
+
+  vector<su2double> elemCoord(nDim*geometry->GetnPoint());
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      elemCoord[iPoint*nDim+iDim] = geometry->node[iPoint]->GetCoord(iDim);
+
+  vector<unsigned long> elemConn, elemID;
+  vector<unsigned short> elemType, elemMarker;
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    elemType.push_back(geometry->elem[iElem]->GetVTK_Type());
+    elemMarker.push_back(0);
+    elemID.push_back(iElem);
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      elemConn.push_back(geometry->elem[iElem]->GetNode(iNode));
+  }
+
+  CADTElemClass elemADT(nDim, elemCoord, elemConn, elemType, elemMarker, elemID, false);
+
+  /*--- Containing element of each probe, the lowest rank that finds one owns the probe. ---*/
+
+  vector<unsigned long> donorElem(nProbe);
+  vector<su2double> weights(nProbe*8);
+  vector<int> localOwner(nProbe, size), owner(nProbe);
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    unsigned short markerID;
+    int rankID;
+    su2double parCoord[3];
+    if (elemADT.DetermineContainingElement(&coord[3*iProbe], markerID, donorElem[iProbe], rankID,
+                                           parCoord, &weights[8*iProbe]))
+      localOwner[iProbe] = rank;
+  }
+  SU2_MPI::Allreduce(localOwner.data(), owner.data(), nProbe, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  donorStart.push_back(0);
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    if (owner[iProbe] != rank) continue;
+
+    const auto iElem = donorElem[iProbe];
+    ownedProbe.push_back(iProbe);
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
+      donorPoint.push_back(geometry->elem[iElem]->GetNode(iNode));
+      donorWeight.push_back(weights[8*iProbe+iNode]);
+    }
+    donorStart.push_back(donorPoint.size());
+  }
+
+  /*--- Probes outside the grid take the value of the nearest (owned) point. ---*/
+
+  vector<unsigned long> outside;
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++)
+    if (owner[iProbe] == size) outside.push_back(iProbe);
+
+  if (!outside.empty()) {
+
+    vector<unsigned long> pointID(geometry->GetnPointDomain());
+    for (unsigned long iPoint = 0; iPoint < pointID.size(); iPoint++) pointID[iPoint] = iPoint;
+
+    CADTPointsOnlyClass pointADT(nDim, pointID.size(), elemCoord.data(), pointID.data(), false);
+
+    vector<passivedouble> localDist(outside.size()), minDist(outside.size());
+    vector<unsigned long> nearest(outside.size());
+
+    for (unsigned long i = 0; i < outside.size(); i++) {
+      su2double dist;
+      int rankID;
+      pointADT.DetermineNearestNode(&coord[3*outside[i]], dist, nearest[i], rankID);
+      localDist[i] = SU2_TYPE::GetValue(dist);
+    }
+#ifdef HAVE_MPI
+    CBaseMPIWrapper::Allreduce(localDist.data(), minDist.data(), outside.size(), MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+#else
+    minDist = localDist;
+#endif
+
+    vector<int> localNearOwner(outside.size()), nearOwner(outside.size());
+    for (unsigned long i = 0; i < outside.size(); i++)
+      localNearOwner[i] = (localDist[i] == minDist[i])? rank : size;
+    SU2_MPI::Allreduce(localNearOwner.data(), nearOwner.data(), outside.size(), MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+    for (unsigned long i = 0; i < outside.size(); i++) {
+      if (rank == MASTER_NODE)
+        cout << "WARNING: " << names[outside[i]] << " is outside the grid, the value of the nearest point is used." << endl;
+
+      if (nearOwner[i] != rank) continue;
+      ownedProbe.push_back(outside[i]);
+      donorPoint.push_back(nearest[i]);
+      donorWeight.push_back(1.0);
+      donorStart.push_back(donorPoint.size());
+    }
+  }
+
+  located = true;
+}
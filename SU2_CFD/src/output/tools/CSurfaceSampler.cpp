@@ -0,0 +1,389 @@
+/*!
+ * \file CSurfaceSampler.cpp
+ * \brief In-situ sampling of the output fields on markers.
+ * \author agent
+ * \version 7.0.3 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CSurfaceSampler.hpp"
+#include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstring>
+
+const string CSurfaceSampler::fileExt = ".bin";
+
+CSurfaceSampler::CSurfaceSampler(CConfig* config, CGeometry* geometry, const vector<string>& volumeFieldNames) {
+
+  using namespace SU2SurfaceSamples;
+
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  nDim = geometry->GetnDim();
+  fileName = config->GetMultizone_FileName(config->GetSampling_FileName(), config->GetiZone(), fileExt);
+  writeVertices = config->GetSampling_Vertex_Data();
+
+  if (config->GetSampling_Freq() == 0)
+    SU2_MPI::Error("SAMPLING_FREQ must be greater than 0.", CURRENT_FUNCTION);
+
+  /*--- Position of the sampled fields in the volume data. ---*/
+
+  if (config->GetnSampling_Fields() == 0)
+    SU2_MPI::Error("No fields specified in SAMPLING_FIELDS.", CURRENT_FUNCTION);
+
+  for (unsigned short iField = 0; iField < config->GetnSampling_Fields(); iField++) {
+    const string field = config->GetSampling_Field(iField);
+    const auto it = find(volumeFieldNames.begin(), volumeFieldNames.end(), field);
+    if (it == volumeFieldNames.end())
+      SU2_MPI::Error("Field " + field + " in SAMPLING_FIELDS is not part of the volume output (see VOLUME_OUTPUT).",
+                     CURRENT_FUNCTION);
+    fieldNames.push_back(field);
+    fieldIndex.push_back(it - volumeFieldNames.begin());
+  }
+  const auto nField = fieldNames.size();
+
+  /*--- Sampled markers, they may not be present on every rank. ---*/
+
+  sampledMarker.assign(config->GetnMarker_All(), false);
+
+  for (unsigned short iSample = 0; iSample < config->GetnMarker_Sampling(); iSample++) {
+    markerNames.push_back(config->GetMarker_Sampling(iSample));
+    markerIndex.push_back(-1);
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_TagBound(iMarker) == markerNames.back()) {
+        sampledMarker[iMarker] = true;
+        markerIndex.back() = iMarker;
+      }
+    }
+
+    int found = (markerIndex.back() >= 0), foundAny = 0;
+    SU2_MPI::Allreduce(&found, &foundAny, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (!foundAny)
+      SU2_MPI::Error("Marker " + markerNames.back() + " in MARKER_SAMPLING does not exist.", CURRENT_FUNCTION);
+  }
+  const auto nMarker = markerNames.size();
+
+  /*--- Owned points of the sampled markers, without repetitions (corners of two markers). ---*/
+
+  vector<bool> isSampled(geometry->GetnPointDomain(), false);
+
+  for (auto iMarker : markerIndex) {
+    if (iMarker < 0) continue;
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->node[iPoint]->GetDomain() && !isSampled[iPoint]) {
+        isSampled[iPoint] = true;
+        localPoints.push_back(iPoint);
+      }
+    }
+  }
+  sort(localPoints.begin(), localPoints.end());
+
+  int nLocalPoint = localPoints.size();
+  nPointRank.resize(size);
+  SU2_MPI::Gather(&nLocalPoint, 1, MPI_INT, nPointRank.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Global indices and coordinates of the sampled vertices. ---*/
+
+  vector<unsigned long> pointIndex;
+  vector<passivedouble> pointCoord;
+
+  if (writeVertices) {
+    vector<unsigned long> localIndex;
+    vector<passivedouble> localCoord;
+
+    for (auto iPoint : localPoints) {
+      localIndex.push_back(geometry->node[iPoint]->GetGlobalIndex());
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        localCoord.push_back(SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim)));
+    }
+    GatherPoints(localIndex, 1, MPI_UNSIGNED_LONG, pointIndex);
+    GatherPoints(localCoord, nDim, MPI_DOUBLE, pointCoord);
+  }
+
+  vector<uint64_t> probeIndex;
+  vector<passivedouble> probeCoord;
+  LocateProbes(config, geometry, probeIndex, probeCoord);
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Header, names, and locations of the vertices and probes. ---*/
+
+  uint64_t header[HEADER_SIZE] = {0};
+  header[MAGIC] = MAGIC_NUMBER;
+  header[FORMAT] = FORMAT_VERSION;
+  header[NDIM] = nDim;
+  header[NFIELD] = nField;
+  header[NVERTEX] = pointIndex.size();
+  header[NMARKER] = nMarker;
+  header[NPROBE] = nProbe;
+
+  vector<char> preamble(reinterpret_cast<const char*>(header), reinterpret_cast<const char*>(header+HEADER_SIZE));
+
+  auto appendName = [&preamble](const string& name) {
+    char buffer[NAME_SIZE] = {'\0'};
+    strncpy(buffer, name.c_str(), NAME_SIZE-1);
+    preamble.insert(preamble.end(), buffer, buffer+NAME_SIZE);
+  };
+  auto appendArray = [&preamble](const void* data, size_t sizeInBytes) {
+    const char* bytes = static_cast<const char*>(data);
+    preamble.insert(preamble.end(), bytes, bytes+sizeInBytes);
+  };
+
+  for (const auto& name : fieldNames) appendName(name);
+  for (const auto& name : markerNames) appendName(name);
+
+  vector<uint64_t> pointIndex64(pointIndex.begin(), pointIndex.end());
+  appendArray(pointIndex64.data(), pointIndex64.size()*sizeof(uint64_t));
+  appendArray(pointCoord.data(), pointCoord.size()*sizeof(passivedouble));
+  appendArray(probeIndex.data(), probeIndex.size()*sizeof(uint64_t));
+  appendArray(probeCoord.data(), probeCoord.size()*sizeof(passivedouble));
+
+  OpenFile(config, preamble);
+
+  recordBuffer.resize(pointIndex.size()*nField);
+}
+
+void CSurfaceSampler::LocateProbes(const CConfig* config, CGeometry* geometry,
+                                   vector<uint64_t>& probeIndex, vector<passivedouble>& probeCoord) {
+
+  if (config->GetnSampling_Probes() % 3 != 0)
+    SU2_MPI::Error("SAMPLING_PROBES must contain 3 coordinates (x, y, z) per probe.", CURRENT_FUNCTION);
+
+  nProbe = config->GetnSampling_Probes() / 3;
+  if (nProbe == 0) return;
+
+  const su2double* probes = config->GetSampling_Probes();
+
+  /*--- Nearest local vertex to each probe. ---*/
+
+  vector<passivedouble> localDist(nProbe, numeric_limits<passivedouble>::max()), minDist(nProbe);
+  vector<long> nearest(nProbe, -1);
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    for (auto iPoint : localPoints) {
+      passivedouble dist = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        dist += pow(SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim) - probes[3*iProbe+iDim]), 2);
+      if (dist < localDist[iProbe]) {
+        localDist[iProbe] = dist;
+        nearest[iProbe] = iPoint;
+      }
+    }
+  }
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Allreduce(localDist.data(), minDist.data(), nProbe, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+#else
+  minDist = localDist;
+#endif
+
+  /*--- Each probe belongs to one rank, ties are resolved in favor of the lowest. ---*/
+
+  vector<int> localOwner(nProbe), owner(nProbe);
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++)
+    localOwner[iProbe] = (nearest[iProbe] >= 0 && localDist[iProbe] == minDist[iProbe])? rank : size;
+
+  SU2_MPI::Allreduce(localOwner.data(), owner.data(), nProbe, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  probePoint.assign(nProbe, -1);
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    if (owner[iProbe] == size)
+      SU2_MPI::Error("The markers in MARKER_SAMPLING have no vertices to place the probes.", CURRENT_FUNCTION);
+    if (owner[iProbe] == rank) probePoint[iProbe] = nearest[iProbe];
+  }
+
+  /*--- Global index and coordinates of the vertices, for the header of the file. ---*/
+
+  vector<passivedouble> localLoc(nProbe*(nDim+1), 0.0), loc(nProbe*(nDim+1));
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    const auto iPoint = probePoint[iProbe];
+    if (iPoint < 0) continue;
+    localLoc[iProbe*(nDim+1)] = geometry->node[iPoint]->GetGlobalIndex();
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      localLoc[iProbe*(nDim+1)+1+iDim] = SU2_TYPE::GetValue(geometry->node[iPoint]->GetCoord(iDim));
+  }
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Reduce(localLoc.data(), loc.data(), loc.size(), MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  loc = localLoc;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    probeIndex.push_back(static_cast<uint64_t>(loc[iProbe*(nDim+1)]));
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      probeCoord.push_back(loc[iProbe*(nDim+1)+1+iDim]);
+  }
+}
+
+template<class T>
+void CSurfaceSampler::GatherPoints(const vector<T>& localData, int count, SU2_MPI::Datatype datatype,
+                                   vector<T>& data) const {
+
+  if (rank != MASTER_NODE) {
+    CBaseMPIWrapper::Send(const_cast<T*>(localData.data()), localData.size(), datatype, MASTER_NODE, rank, MPI_COMM_WORLD);
+    return;
+  }
+
+  /*--- The master receives the data of each rank after its own. ---*/
+
+  unsigned long nPoint = 0;
+  for (int iRank = 0; iRank < size; iRank++) nPoint += nPointRank[iRank];
+
+  data.resize(nPoint*count);
+  copy(localData.begin(), localData.end(), data.begin());
+
+  unsigned long offset = localData.size();
+  for (int iRank = 1; iRank < size; iRank++) {
+    SU2_MPI::Status status;
+    CBaseMPIWrapper::Recv(&data[offset], nPointRank[iRank]*count, datatype, iRank, iRank, MPI_COMM_WORLD, &status);
+    offset += nPointRank[iRank]*count;
+  }
+}
+
+void CSurfaceSampler::OpenFile(const CConfig* config, const vector<char>& preamble) {
+
+  /*--- On restarts, the samples are appended to the file of the previous run if it has the same layout. ---*/
+
+  if (config->GetRestart()) {
+    ifstream previous(fileName, ios::binary);
+    vector<char> previousPreamble(preamble.size());
+
+    if (previous.read(previousPreamble.data(), previousPreamble.size()) && (previousPreamble == preamble)) {
+      previous.close();
+      file.open(fileName, ios::binary | ios::app);
+      if (!file.is_open())
+        SU2_MPI::Error("Unable to open the surface samples file " + fileName, CURRENT_FUNCTION);
+      return;
+    }
+  }
+
+  file.open(fileName, ios::binary | ios::trunc);
+  if (!file.is_open())
+    SU2_MPI::Error("Unable to open the surface samples file " + fileName, CURRENT_FUNCTION);
+
+  file.write(preamble.data(), preamble.size());
+  file.flush();
+}
+
+bool CSurfaceSampler::SampleIteration(const CConfig* config, unsigned long iter) const {
+  return (iter % config->GetSampling_Freq() == 0);
+}
+
+void CSurfaceSampler::Sample(const CConfig* config, CGeometry* geometry, const CParallelDataSorter* dataSorter,
+                             unsigned long iter) {
+
+  const auto nField = fieldIndex.size();
+  const auto nMarker = markerNames.size();
+
+  auto GetValue = [&](unsigned long iPoint, unsigned long iField) {
+    return SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(iPoint, fieldIndex[iField]));
+  };
+
+  /*--- Area-weighted sums over the markers (and the areas), followed by the values of the probes. ---*/
+
+  vector<passivedouble> localReduced(nMarker*(nField+1) + nProbe*nField, 0.0), reduced(localReduced.size());
+
+  for (unsigned long iSample = 0; iSample < nMarker; iSample++) {
+    const auto iMarker = markerIndex[iSample];
+    if (iMarker < 0) continue;
+
+    passivedouble* sums = &localReduced[iSample*(nField+1)];
+
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!geometry->node[iPoint]->GetDomain()) continue;
+
+      const su2double* normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      passivedouble area = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) area += pow(SU2_TYPE::GetValue(normal[iDim]), 2);
+      area = sqrt(area);
+
+      for (unsigned long iField = 0; iField < nField; iField++) sums[iField] += area * GetValue(iPoint, iField);
+      sums[nField] += area;
+    }
+  }
+
+  for (unsigned long iProbe = 0; iProbe < nProbe; iProbe++) {
+    const auto iPoint = probePoint[iProbe];
+    if (iPoint < 0) continue;
+    for (unsigned long iField = 0; iField < nField; iField++)
+      localReduced[nMarker*(nField+1) + iProbe*nField + iField] = GetValue(iPoint, iField);
+  }
+
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Reduce(localReduced.data(), reduced.data(), reduced.size(), MPI_DOUBLE, MPI_SUM,
+                          MASTER_NODE, MPI_COMM_WORLD);
+#else
+  reduced = localReduced;
+#endif
+
+  /*--- Values of the vertices. ---*/
+
+  vector<passivedouble> pointData;
+
+  if (writeVertices) {
+    sendBuffer.resize(localPoints.size()*nField);
+    for (unsigned long i = 0; i < localPoints.size(); i++)
+      for (unsigned long iField = 0; iField < nField; iField++)
+        sendBuffer[i*nField+iField] = GetValue(localPoints[i], iField);
+
+    GatherPoints(sendBuffer, nField, MPI_DOUBLE, pointData);
+  }
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Append the record. ---*/
+
+  copy(pointData.begin(), pointData.end(), recordBuffer.begin());
+
+  for (unsigned long iSample = 0; iSample < nMarker; iSample++) {
+    passivedouble* sums = &reduced[iSample*(nField+1)];
+    const passivedouble area = sums[nField];
+    for (unsigned long iField = 0; iField < nField; iField++)
+      sums[iField] = (area > 0.0)? sums[iField] / area : 0.0;
+  }
+
+  const uint64_t iteration = iter;
+  const passivedouble physicalTime = SU2_TYPE::GetValue(config->GetPhysicalTime() * config->GetTime_Ref());
+
+  file.write(reinterpret_cast<const char*>(&iteration), sizeof(uint64_t));
+  file.write(reinterpret_cast<const char*>(&physicalTime), sizeof(passivedouble));
+  file.write(reinterpret_cast<const char*>(recordBuffer.data()), recordBuffer.size()*sizeof(float));
+
+  for (unsigned long iSample = 0; iSample < nMarker; iSample++)
+    file.write(reinterpret_cast<const char*>(&reduced[iSample*(nField+1)]), nField*sizeof(passivedouble));
+
+  file.write(reinterpret_cast<const char*>(&reduced[nMarker*(nField+1)]), nProbe*nField*sizeof(passivedouble));
+
+  /*--- Flush so that the samples can be monitored (and are not lost) while the solver runs. ---*/
+
+  file.flush();
+}
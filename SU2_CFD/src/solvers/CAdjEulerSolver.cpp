@@ -1597,6 +1597,8 @@ void CAdjEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solve
         solver_container[iMesh][ADJFLOW_SOL]->GetNodes()->SetSolution(iPoint, Solution);
 
       }
+      if (config->GetMG_ParallelAgglomeration())
+        solver_container[iMesh][ADJFLOW_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
       solver_container[iMesh][ADJFLOW_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
       solver_container[iMesh][ADJFLOW_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
     }
@@ -1716,9 +1718,9 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Points in edge, normal, and neighbors---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    iPoint = geometry->GetEdgeNode(iEdge,0);
+    jPoint = geometry->GetEdgeNode(iEdge,1);
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
     numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
     /*--- Adjoint variables w/o reconstruction ---*/
@@ -1747,7 +1749,7 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
     /*--- Mesh motion ---*/
 
     if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+      numerics->SetGridVel(geometry->GetPointGridVel(iPoint), geometry->GetPointGridVel(jPoint));
     }
 
     /*--- Compute residuals ---*/
@@ -1794,9 +1796,9 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
     /*--- Points in edge and normal vectors ---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    iPoint = geometry->GetEdgeNode(iEdge,0);
+    jPoint = geometry->GetEdgeNode(iEdge,1);
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
     /*--- Adjoint variables w/o reconstruction ---*/
 
@@ -1813,7 +1815,7 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
     /*--- Grid velocities for dynamic meshes ---*/
 
     if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+      numerics->SetGridVel(geometry->GetPointGridVel(iPoint), geometry->GetPointGridVel(jPoint));
     }
 
     /*--- High order reconstruction using MUSCL strategy ---*/
@@ -2034,8 +2036,8 @@ void CAdjEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *confi
   nodes->SetUnd_LaplZero();
 
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    iPoint = geometry->GetEdgeNode(iEdge,0);
+    jPoint = geometry->GetEdgeNode(iEdge,1);
 
     for (iVar = 0; iVar < nVar; iVar++)
       Diff[iVar] = nodes->GetSolution(iPoint,iVar) - nodes->GetSolution(jPoint,iVar);
@@ -4882,6 +4884,8 @@ void CAdjEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
       }
       solver[iMesh][ADJFLOW_SOL]->GetNodes()->SetSolution(iPoint,Solution);
     }
+    if (config->GetMG_ParallelAgglomeration())
+      solver[iMesh][ADJFLOW_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
     solver[iMesh][ADJFLOW_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
     solver[iMesh][ADJFLOW_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
     solver[iMesh][ADJFLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
@@ -429,11 +429,11 @@ void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Points in edge, coordinates and normal vector---*/
 
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    iPoint = geometry->GetEdgeNode(iEdge,0);
+    jPoint = geometry->GetEdgeNode(iEdge,1);
 
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetCoord(geometry->GetPointCoord(iPoint), geometry->GetPointCoord(jPoint));
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction and adjoint variables w/o reconstruction---*/
 
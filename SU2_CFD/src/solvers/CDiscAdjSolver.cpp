@@ -1072,6 +1072,14 @@ void CDiscAdjSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfi
       }
       solver[iMesh][ADJFLOW_SOL]->GetNodes()->SetSolution(iPoint, Solution);
     }
+
+    /*--- With the parallel agglomeration the halos hold the contribution of the local children. ---*/
+
+    if (config->GetMG_ParallelAgglomeration()) {
+      solver[iMesh][ADJFLOW_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
+      solver[iMesh][ADJFLOW_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
+      solver[iMesh][ADJFLOW_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
+    }
   }
 
   /*--- Delete the class memory that is used to load the restart. ---*/
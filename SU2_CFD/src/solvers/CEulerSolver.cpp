@@ -29,6 +29,7 @@
 #include "../../include/solvers/CEulerSolver.hpp"
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
@@ -208,6 +209,15 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- Newton-Krylov mode (only on the finest grid), the right hand side needs
+   *    to be copied since the residual evaluations overwrite LinSysRes. ---*/
+
+  if (config->GetNewtonKrylov() && (iMesh == MESH_0)) {
+    LinSysAux.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    NewtonKrylovSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    NewtonKrylovRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
 #ifdef HAVE_OMP
   /*--- Get the edge coloring. If the expected parallel efficiency becomes too low setup the
    *    reducer strategy. Where one loop is performed over edges followed by a point loop to
@@ -259,6 +269,34 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
 #endif
 
+  /*--- Vectorized convective scheme, if requested and available for the problem settings. ---*/
+
+  batchedConvFlux = CBatchedConvectiveFlux::CreateFlux(nDim, config, iMesh);
+
+  if (config->GetUseVectorization() && (batchedConvFlux == nullptr) && (iMesh == MESH_0) && (rank == MASTER_NODE)) {
+    cout << "WARNING: Vectorization is not available for the selected convective scheme and settings,\n"
+         << "         the standard (scalar) implementation will be used." << endl;
+  }
+
+  /*--- Overlap the halo exchanges of the MUSCL data with computation, this requires the edges that
+   *    touch halo points to be identified. Not used by the adjoint solvers, as the tapes would then
+   *    depend on the order of the exchanges. ---*/
+
+  OverlapComms = (iMesh == MESH_0) && config->GetMUSCL_Flow() &&
+                 (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+                 !config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint();
+
+  if (OverlapComms) {
+    HaloEdge.resize(geometry->GetnEdge());
+    for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); ++iEdge)
+      HaloEdge[iEdge] = (geometry->GetEdgeNode(iEdge,0) >= nPointDomain) ||
+                        (geometry->GetEdgeNode(iEdge,1) >= nPointDomain);
+  }
+
+  /*--- Task graph of the residual computation, if requested. ---*/
+
+  SetupTaskGraph(geometry, config, iMesh);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
@@ -580,6 +618,8 @@ CEulerSolver::~CEulerSolver(void) {
   delete [] CEquivArea_Inv;
   delete [] CNearFieldOF_Inv;
 
+  delete batchedConvFlux;
+
   delete [] Inflow_MassFlow;
   delete [] Exhaust_MassFlow;
   delete [] Exhaust_Area;
@@ -2523,7 +2563,7 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit         = AssembleJacobian(config);
   bool center           = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
   bool center_jst       = (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0);
   bool engine           = ((config->GetnMarker_EngineInflow() != 0) || (config->GetnMarker_EngineExhaust() != 0));
@@ -2623,38 +2663,51 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh,
                                  unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long InnerIter = config->GetInnerIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool muscl            = (config->GetMUSCL_Flow() || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == ROE));
-  bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
   bool center           = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
-  bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
 
   /*--- Common preprocessing steps. ---*/
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
-  /*--- Upwind second order reconstruction ---*/
+  /*--- Upwind second order reconstruction, left for the task graph if in use. ---*/
 
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
+    if (UseTaskGraph) {
+      SU2_OMP_MASTER
+      TaskMUSCL = true;
+      SU2_OMP_BARRIER
+    }
+    else {
+      MUSCL_Preprocessing(geometry, config);
+    }
+  }
+
+}
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+void CEulerSolver::MUSCL_Preprocessing(CGeometry *geometry, CConfig *config) {
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                          (config->GetInnerIter() <= config->GetLimiterIter());
+  const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
-    /*--- Limiter computation ---*/
+  /*--- Gradient computation for MUSCL reconstruction. ---*/
 
-    if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
-      SetPrimitive_Limiter(geometry, config);
+  switch (config->GetKind_Gradient_Method_Recon()) {
+    case GREEN_GAUSS:
+      SetPrimitive_Gradient_GG(geometry, config, true); break;
+    case LEAST_SQUARES:
+    case WEIGHTED_LEAST_SQUARES:
+      SetPrimitive_Gradient_LS(geometry, config, true); break;
+    default: break;
   }
 
+  /*--- Limiter computation ---*/
+
+  if (limiter && !van_albada)
+    SetPrimitive_Limiter(geometry, config);
+
 }
 
 unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
@@ -2726,10 +2779,9 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     for (unsigned short iNeigh = 0; iNeigh < node_i->GetnPoint(); ++iNeigh)
     {
       jPoint = node_i->GetPoint(iNeigh);
-      auto node_j = geometry->node[jPoint];
 
       iEdge = node_i->GetEdge(iNeigh);
-      Normal = geometry->edge[iEdge]->GetNormal();
+      Normal = geometry->GetEdgeNormal(iEdge);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2); Area = sqrt(Area);
 
       /*--- Mean Values ---*/
@@ -2740,8 +2792,8 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
       /*--- Adjustment for grid movement ---*/
 
       if (dynamic_grid) {
-        const su2double *GridVel_i = node_i->GetGridVel();
-        const su2double *GridVel_j = node_j->GetGridVel();
+        const su2double *GridVel_i = geometry->GetPointGridVel(iPoint);
+        const su2double *GridVel_j = geometry->GetPointGridVel(jPoint);
 
         for (iDim = 0; iDim < nDim; iDim++)
           Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
@@ -2796,7 +2848,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
         /*--- Adjustment for grid movement ---*/
 
         if (dynamic_grid) {
-          const su2double *GridVel = geometry->node[iPoint]->GetGridVel();
+          const su2double *GridVel = geometry->GetPointGridVel(iPoint);
 
           for (iDim = 0; iDim < nDim; iDim++)
             Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
@@ -2945,12 +2997,13 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  const bool jst_scheme = (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0);
-
-  /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+  const bool implicit = AssembleJacobian(config);
 
+  /*--- Vectorized scheme, computes several edges at once. ---*/
+  if (batchedConvFlux != nullptr) {
+    BatchedConvective_Residual(geometry, solver_container, numerics_container, config, iMesh);
+  }
+  else {
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring)
   {
@@ -2958,63 +3011,128 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
 
-    auto iEdge = color.indices[k];
+    Centered_EdgeResidual(color.indices[k], geometry, solver_container, numerics_container, config, iMesh);
+  }
+  } // end color loop
+  }
 
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit)
+      Jacobian.SetDiagonalAsColumnSum();
+  }
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+}
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+void CEulerSolver::Centered_EdgeResidual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                         CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-    /*--- Set primitive variables w/o reconstruction ---*/
+  const bool implicit = AssembleJacobian(config);
+  const bool jst_scheme = (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0);
 
-    numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+  /*--- Pick the numerics object of the thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-    /*--- Set the largest convective eigenvalue ---*/
+  /*--- Points in edge, set normal vectors, and number of neighbors ---*/
 
-    numerics->SetLambda(nodes->GetLambda(iPoint), nodes->GetLambda(jPoint));
+  auto iPoint = geometry->GetEdgeNode(iEdge,0);
+  auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
-    /*--- Set undivided laplacian an pressure based sensor ---*/
+  numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+  numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
-    if (jst_scheme) {
-      numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint),
-                                       nodes->GetUndivided_Laplacian(jPoint));
-      numerics->SetSensor(nodes->GetSensor(iPoint),
-                          nodes->GetSensor(jPoint));
-    }
+  /*--- Set primitive variables w/o reconstruction ---*/
 
-    /*--- Grid movement ---*/
+  numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
 
-    if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    }
+  /*--- Set the largest convective eigenvalue ---*/
 
-    /*--- Compute residuals, and Jacobians ---*/
+  numerics->SetLambda(nodes->GetLambda(iPoint), nodes->GetLambda(jPoint));
 
-    auto residual = numerics->ComputeResidual(config);
+  /*--- Set undivided laplacian an pressure based sensor ---*/
 
-    /*--- Update convective and artificial dissipation residuals. ---*/
+  if (jst_scheme) {
+    numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint),
+                                     nodes->GetUndivided_Laplacian(jPoint));
+    numerics->SetSensor(nodes->GetSensor(iPoint),
+                        nodes->GetSensor(jPoint));
+  }
 
-    if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
-      if (implicit)
-        Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
-    }
-    else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+  /*--- Grid movement ---*/
+
+  if (dynamic_grid) {
+    numerics->SetGridVel(geometry->GetPointGridVel(iPoint), geometry->GetPointGridVel(jPoint));
+  }
+
+  /*--- Compute residuals, and Jacobians ---*/
+
+  auto residual = numerics->ComputeResidual(config);
+
+  /*--- Update convective and artificial dissipation residuals. ---*/
+
+  if (ReducerStrategy) {
+    EdgeFluxes.SetBlock(iEdge, residual);
+    if (implicit)
+      Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+  }
+  else {
+    LinSysRes.AddBlock(iPoint, residual);
+    LinSysRes.SubtractBlock(jPoint, residual);
+    if (implicit)
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+
+  /*--- Viscous contribution. ---*/
+
+  Viscous_Residual(iEdge, geometry, solver_container,
+                   numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+
+}
+
+void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
+                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
+
+  const bool implicit = AssembleJacobian(config);
+
+  /*--- Non-physical counter. ---*/
+  unsigned long counter_local = 0;
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+
+  /*--- If the halo exchange of the MUSCL data was deferred (see OverlappedHaloComms), the edges
+   *    between owned points are computed while it takes place, and the other edges after. ---*/
+  const bool overlap = DeferredComm;
+  const EdgeSet edgeSets[] = {overlap? EdgeSet::INTERIOR : EdgeSet::ALL, EdgeSet::HALO};
+
+  InitiateDeferredComms(geometry, config);
+
+  for (auto iSet = 0u; iSet < (overlap? 2u : 1u); ++iSet)
+  {
+  const auto edgeSet = edgeSets[iSet];
+
+  if (edgeSet == EdgeSet::HALO) CompleteDeferredComms(geometry, config, true);
+
+  /*--- Vectorized scheme, computes several edges at once. ---*/
+  if (batchedConvFlux != nullptr) {
+    counter_local += BatchedConvective_Residual(geometry, solver_container, numerics_container, config, iMesh, edgeSet);
+  }
+  else {
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
-    /*--- Viscous contribution. ---*/
+    if (!InEdgeSet(iEdge, edgeSet)) continue;
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    counter_local += Upwind_EdgeResidual(iEdge, geometry, solver_container, numerics_container, config, iMesh);
   }
   } // end color loop
+  }
+  } // end edge set loop
 
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
@@ -3022,13 +3140,31 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
       Jacobian.SetDiagonalAsColumnSum();
   }
 
+  /*--- Warning message about non-physical reconstructions. ---*/
+
+  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
+    /*--- Add counter results for all threads. ---*/
+    SU2_OMP_ATOMIC
+    ErrorCounter += counter_local;
+    SU2_OMP_BARRIER
+
+    /*--- Add counter results for all ranks. ---*/
+    SU2_OMP_MASTER
+    {
+      counter_local = ErrorCounter;
+      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+      config->SetNonphysical_Reconstr(ErrorCounter);
+    }
+    SU2_OMP_BARRIER
+  }
+
 }
 
-void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
-                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
+unsigned long CEulerSolver::Upwind_EdgeResidual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                                CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
   const auto InnerIter        = config->GetInnerIter();
-  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit         = AssembleJacobian(config);
   const bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR) ||
                                 (config->GetKind_FluidModel() == IDEAL_GAS);
 
@@ -3041,233 +3177,669 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                                 (InnerIter <= config->GetLimiterIter());
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
-  /*--- Non-physical counter. ---*/
-  unsigned long counter_local = 0;
-  SU2_OMP_MASTER
-  ErrorCounter = 0;
+  unsigned long counter = 0;
 
-  /*--- Pick one numerics object per thread. ---*/
+  /*--- Pick the numerics object of the thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
+  unsigned short iDim;
+
+  /*--- Points in edge and normal vectors ---*/
+
+  auto iPoint = geometry->GetEdgeNode(iEdge,0);
+  auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+  numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+
+  auto Coord_i = geometry->GetPointCoord(iPoint);
+  auto Coord_j = geometry->GetPointCoord(jPoint);
+
+  /*--- Roe Turkel preconditioning ---*/
+
+  if (roe_turkel) {
+    su2double sqvel = 0.0;
+    for (iDim = 0; iDim < nDim; iDim ++)
+      sqvel += pow(config->GetVelocity_FreeStream()[iDim], 2);
+    numerics->SetVelocity2_Inf(sqvel);
+  }
+
+  /*--- Grid movement ---*/
+
+  if (dynamic_grid) {
+    numerics->SetGridVel(geometry->GetPointGridVel(iPoint),
+                         geometry->GetPointGridVel(jPoint));
+  }
+
+  /*--- Get primitive and secondary variables ---*/
+
+  auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
+  auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
+
+  /*--- Local arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
 
-    /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-  for(auto k = 0ul; k < color.size; ++k) {
+  /*--- Set them with or without high order reconstruction using MUSCL strategy. ---*/
 
-    auto iEdge = color.indices[k];
+  if (!muscl) {
+
+    numerics->SetPrimitive(V_i, V_j);
+    numerics->SetSecondary(S_i, S_j);
+
+  }
+  else {
+    /*--- Reconstruction ---*/
 
-    unsigned short iDim, iVar;
+    bool bad_i = false, bad_j = false;
 
-    /*--- Points in edge and normal vectors ---*/
+    MUSCL_Reconstruction(geometry, iPoint, jPoint, limiter, van_albada, !ideal_gas || low_mach_corr,
+                         low_mach_corr, Primitive_i, Primitive_j, Secondary_i, Secondary_j, bad_i, bad_j);
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    counter += bad_i+bad_j;
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
+    numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
+
+  }
 
-    auto Coord_i = geometry->node[iPoint]->GetCoord();
-    auto Coord_j = geometry->node[jPoint]->GetCoord();
+  /*--- Roe Low Dissipation Scheme ---*/
 
-    /*--- Roe Turkel preconditioning ---*/
+  if (kind_dissipation != NO_ROELOWDISS) {
 
-    if (roe_turkel) {
-      su2double sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += pow(config->GetVelocity_FreeStream()[iDim], 2);
-      numerics->SetVelocity2_Inf(sqvel);
+    numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
+                             nodes->GetRoe_Dissipation(jPoint));
+
+    if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+      numerics->SetSensor(nodes->GetSensor(iPoint),
+                          nodes->GetSensor(jPoint));
+    }
+    if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+      numerics->SetCoord(Coord_i, Coord_j);
     }
+  }
+
+  /*--- Compute the residual ---*/
+
+  auto residual = numerics->ComputeResidual(config);
 
-    /*--- Grid movement ---*/
+  /*--- Set the final value of the Roe dissipation coefficient ---*/
 
-    if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
-                           geometry->node[jPoint]->GetGridVel());
+  if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
+    nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
+    nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
+  }
+
+  /*--- Update residual value ---*/
+
+  if (ReducerStrategy) {
+    EdgeFluxes.SetBlock(iEdge, residual);
+    if (implicit)
+      Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+  }
+  else {
+    LinSysRes.AddBlock(iPoint, residual);
+    LinSysRes.SubtractBlock(jPoint, residual);
+
+    /*--- Set implicit computation ---*/
+    if (implicit)
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+
+  /*--- Viscous contribution. ---*/
+
+  Viscous_Residual(iEdge, geometry, solver_container,
+                   numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+
+  return counter;
+}
+
+void CEulerSolver::SetupTaskGraph(CGeometry *geometry, CConfig *config, unsigned short iMesh) {
+
+  TaskBlockSize = config->GetResidualTaskBlockSize();
+  if (TaskBlockSize == 0) return;
+
+  /*--- Not available with the reducer strategy or the vectorized schemes (they have their own edge loops), the
+   *    adjoints (the tapes would depend on the order of the tasks), periodic boundaries (the gradients, limiters,
+   *    and residuals need periodic communications), and rotating frames (GCL contribution to the sources).
+   *    The decision must be the same on all ranks as it changes the order of the collective operations. ---*/
+
+  int supported = !ReducerStrategy && (batchedConvFlux == nullptr) &&
+                  !config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint() &&
+                  (config->GetnMarker_Periodic() == 0) && !config->GetRotating_Frame();
+  int allSupported = supported;
+  SU2_MPI::Allreduce(&supported, &allSupported, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  if (!allSupported) {
+    if ((iMesh == MESH_0) && (rank == MASTER_NODE)) {
+      cout << "WARNING: The task graph of the residual (RESIDUAL_TASK_BLOCK_SIZE) is not available with the adjoint\n"
+           << "         solvers, periodic boundaries, rotating frames, vectorization, or the fallback strategy of\n"
+           << "         the edge loops (see EDGE_COLORING_GROUP_SIZE), the residual loops will be used instead." << endl;
     }
+    TaskBlockSize = 0;
+    return;
+  }
 
-    /*--- Get primitive and secondary variables ---*/
+  UseTaskGraph = true;
 
-    auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
-    auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
+  /*--- Blocks of owned points followed by blocks of halo points. ---*/
 
-    /*--- Set them with or without high order reconstruction using MUSCL strategy. ---*/
+  nTaskBlockDomain = roundUpDiv(nPointDomain, TaskBlockSize);
+  nTaskBlock = nTaskBlockDomain + roundUpDiv(nPoint-nPointDomain, TaskBlockSize);
 
-    if (!muscl) {
+  /*--- Group the edges by the blocks of their points, the groups of edges between owned points first. ---*/
 
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
+  const auto nEdge = geometry->GetnEdge();
+  vector<pair<unsigned long, unsigned long> > edgeBlocks(nEdge);
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto iBlock = TaskBlock(geometry->GetEdgeNode(iEdge,0));
+    const auto jBlock = TaskBlock(geometry->GetEdgeNode(iEdge,1));
+    edgeBlocks[iEdge] = make_pair(min(iBlock,jBlock), max(iBlock,jBlock));
+  }
+
+  auto haloGroup = [&](const pair<unsigned long, unsigned long>& blocks) {
+    return blocks.second >= nTaskBlockDomain;
+  };
 
+  TaskEdges.resize(nEdge);
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) TaskEdges[iEdge] = iEdge;
+
+  stable_sort(TaskEdges.begin(), TaskEdges.end(), [&](unsigned long iEdge, unsigned long jEdge) {
+    const auto& a = edgeBlocks[iEdge];
+    const auto& b = edgeBlocks[jEdge];
+    if (haloGroup(a) != haloGroup(b)) return haloGroup(b);
+    return a < b;
+  });
+
+  TaskEdgeGroupPtr.clear();
+  TaskEdgeGroupBlocks.clear();
+  nTaskEdgeGroupDomain = 0;
+
+  for (auto k = 0ul; k < nEdge; ++k) {
+    const auto& blocks = edgeBlocks[TaskEdges[k]];
+    if (TaskEdgeGroupBlocks.empty() || (TaskEdgeGroupBlocks.back() != blocks)) {
+      TaskEdgeGroupPtr.push_back(k);
+      TaskEdgeGroupBlocks.push_back(blocks);
+      nTaskEdgeGroupDomain += !haloGroup(blocks);
     }
-    else {
-      /*--- Reconstruction ---*/
+  }
+  TaskEdgeGroupPtr.push_back(nEdge);
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+  /*--- Blocks of the points of each marker. ---*/
 
-      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+  TaskMarkerBlocks.resize(nMarker);
 
-      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+  for (auto iMarker = 0u; iMarker < nMarker; ++iMarker) {
+    auto& blocks = TaskMarkerBlocks[iMarker];
+    blocks.clear();
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex)
+      blocks.push_back(TaskBlock(geometry->vertex[iMarker][iVertex]->GetNode()));
+    sort(blocks.begin(), blocks.end());
+    blocks.erase(unique(blocks.begin(), blocks.end()), blocks.end());
+  }
 
-      if (limiter) {
-        Limiter_i = nodes->GetLimiter_Primitive(iPoint);
-        Limiter_j = nodes->GetLimiter_Primitive(jPoint);
-      }
+  /*--- Tokens of the blocks (residual and MUSCL data), markers, and marker colors (plus one). ---*/
+
+  const auto nColor = geometry->GetMarkerColoring(config).getOuterSize();
+  TaskTokens.assign(2*nTaskBlock + nMarker + nColor + 1, 0);
 
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+}
 
-        su2double Project_Grad_i = 0.0;
-        su2double Project_Grad_j = 0.0;
+void CEulerSolver::TaskGraph_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
+                                      CConfig *config, unsigned short iMesh,
+                                      const std::function<void(unsigned short)>* WeakBC) {
+
+  const bool upwind     = (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+  const bool muscl      = TaskMUSCL;
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                          (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE) &&
+                          (config->GetInnerIter() <= config->GetLimiterIter());
+  const bool greenGauss = (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS);
+  const bool weighted   = (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES);
+  const bool sources    = GetPointSources(config);
+
+  /*--- The preprocessing of some limiters is collective, the master keeps its copy for the tasks. ---*/
+
+  if (muscl && limiter) {
+    auto limiterFunc = computeLimitersRange(static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow()),
+                                            *geometry, *config, 0, nPrimVarGrad, nodes->GetPrimitive(),
+                                            nodes->GetGradient_Reconstruction(), nodes->GetSolution_Min(),
+                                            nodes->GetSolution_Max(), nodes->GetLimiter_Primitive());
+    SU2_OMP_MASTER
+    TaskLimiter = limiterFunc;
+  }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  SU2_OMP_BARRIER
+
+  /*--- The master thread creates the tasks, and does the halo exchanges (MPI is only used by the master
+   *    thread), the other threads execute tasks at the barrier. Each task declares the blocks of points
+   *    whose residual it updates (inout), and the data it requires (in), tasks execute as soon as the
+   *    tasks they depend on are complete. Without OpenMP the tasks execute in the order of creation. ---*/
+
+  SU2_OMP_MASTER
+  {
+    char* blockToken = TaskTokens.data();
+    char* gradToken = blockToken + nTaskBlock;
+    char* markerToken = gradToken + nTaskBlock;
+    char* colorToken = markerToken + nMarker;
+
+    if (muscl) {
+
+      /*--- Gradients and limiters of the blocks of owned points, the limiters of a point only require
+       *    its own gradients, the gradients only require the primitive variables. ---*/
+
+      for (auto iBlock = 0ul; iBlock < nTaskBlockDomain; ++iBlock) {
+        SU2_OMP_TASK_(depend(out: gradToken[iBlock]))
+        {
+          const auto pointBegin = TaskBlockBegin(iBlock);
+          const auto pointEnd = TaskBlockEnd(iBlock);
+          auto& gradient = nodes->GetGradient_Reconstruction();
+
+          if (greenGauss)
+            computeGradientsGreenGaussRange(*geometry, *config, nodes->GetPrimitive(), 0,
+                                            nPrimVarGrad, gradient, pointBegin, pointEnd);
+          else
+            computeGradientsLeastSquaresRange(*geometry, weighted, nodes->GetPrimitive(), 0, nPrimVarGrad,
+                                              gradient, nodes->GetRmatrix(), pointBegin, pointEnd);
+          if (limiter)
+            TaskLimiter(pointBegin, pointEnd);
         }
+      }
+    }
+    else if (DeferredComm) {
+      InitiateComms(geometry, config, DeferredCommType);
+    }
 
-        if (limiter) {
-          if (van_albada) {
-            su2double V_ij = V_j[iVar] - V_i[iVar];
-            Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
-            Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
-          }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+    /*--- Groups of edges between owned points, after the MUSCL data of their blocks. ---*/
+
+    for (auto iGroup = 0ul; iGroup < nTaskEdgeGroupDomain; ++iGroup) {
+      const auto iBlock = TaskEdgeGroupBlocks[iGroup].first;
+      const auto jBlock = TaskEdgeGroupBlocks[iGroup].second;
+
+      SU2_OMP_TASK_(depend(in: gradToken[iBlock], gradToken[jBlock]) depend(inout: blockToken[iBlock], blockToken[jBlock]))
+      {
+        unsigned long counter = 0;
+        for (auto k = TaskEdgeGroupPtr[iGroup]; k < TaskEdgeGroupPtr[iGroup+1]; ++k) {
+          if (upwind)
+            counter += Upwind_EdgeResidual(TaskEdges[k], geometry, solver_container, numerics_container, config, iMesh);
+          else
+            Centered_EdgeResidual(TaskEdges[k], geometry, solver_container, numerics_container, config, iMesh);
         }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+        if (counter) {
+          SU2_OMP_ATOMIC
+          ErrorCounter += counter;
         }
-
       }
+    }
+
+    /*--- The exchange of the MUSCL data requires the gradients (then limiters) of all owned points,
+     *    the edges between owned points are also complete after this wait. ---*/
+
+    if (muscl) {
+      SU2_OMP_TASKWAIT
+      InitiateComms(geometry, config, PRIMITIVE_GRADIENT);
+    }
 
-      /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
+    /*--- Source terms of the blocks of owned points. ---*/
 
-      if (!ideal_gas || low_mach_corr) {
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
+    if (sources) {
+      for (auto iBlock = 0ul; iBlock < nTaskBlockDomain; ++iBlock) {
+        SU2_OMP_TASK_(depend(inout: blockToken[iBlock]))
+        PointSource_Residual(geometry, numerics_container, config, TaskBlockBegin(iBlock), TaskBlockEnd(iBlock));
       }
+    }
 
-      /*--- Low-Mach number correction. ---*/
+    /*--- Halo exchanges, while the tasks above execute. ---*/
 
-      if (low_mach_corr) {
-        LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
+    if (muscl) {
+      CompleteComms(geometry, config, PRIMITIVE_GRADIENT);
+      if (limiter) {
+        InitiateComms(geometry, config, PRIMITIVE_LIMITER);
+        CompleteComms(geometry, config, PRIMITIVE_LIMITER);
       }
+    }
+    else if (DeferredComm) {
+      CompleteComms(geometry, config, DeferredCommType);
+      DeferredComm = false;
+    }
 
-      /*--- Check for non-physical solutions after reconstruction. If found, use the
-       cell-average value of the solution. This is a locally 1st order approximation,
-       which is typically only active during the start-up of a calculation. ---*/
+    /*--- Groups of edges with halo points. ---*/
 
-      bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
-      bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
+    for (auto iGroup = nTaskEdgeGroupDomain; iGroup < TaskEdgeGroupBlocks.size(); ++iGroup) {
+      const auto iBlock = TaskEdgeGroupBlocks[iGroup].first;
+      const auto jBlock = TaskEdgeGroupBlocks[iGroup].second;
 
-      su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      su2double sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += pow(RoeVelocity, 2);
+      SU2_OMP_TASK_(depend(inout: blockToken[iBlock], blockToken[jBlock]))
+      {
+        unsigned long counter = 0;
+        for (auto k = TaskEdgeGroupPtr[iGroup]; k < TaskEdgeGroupPtr[iGroup+1]; ++k) {
+          if (upwind)
+            counter += Upwind_EdgeResidual(TaskEdges[k], geometry, solver_container, numerics_container, config, iMesh);
+          else
+            Centered_EdgeResidual(TaskEdges[k], geometry, solver_container, numerics_container, config, iMesh);
+        }
+        if (counter) {
+          SU2_OMP_ATOMIC
+          ErrorCounter += counter;
+        }
       }
-      su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+    }
 
-      bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+    /*--- Task-safe weak boundary conditions. A marker waits for the tasks of the blocks of its points (one
+     *    join task per block), and for the markers of the previous colors (one join task per marker). ---*/
 
-      bool bad_i = neg_sound_speed || neg_pres_or_rho_i;
-      bool bad_j = neg_sound_speed || neg_pres_or_rho_j;
+    const auto& coloring = geometry->GetMarkerColoring(config);
 
-      nodes->SetNon_Physical(iPoint, bad_i);
-      nodes->SetNon_Physical(jPoint, bad_j);
+    for (auto color = 0ul; color < coloring.getOuterSize(); ++color) {
 
-      /*--- Get updated state, in case the point recovered after the set. ---*/
-      bad_i = nodes->GetNon_Physical(iPoint);
-      bad_j = nodes->GetNon_Physical(jPoint);
+      for (auto k = 0ul; k < coloring.getNumNonZeros(color); ++k) {
+        const unsigned short iMarker = coloring.getInnerIdx(color, k);
+        if (!GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker))) continue;
+
+        for (auto iBlock : TaskMarkerBlocks[iMarker]) {
+          SU2_OMP_TASK_(depend(in: blockToken[iBlock]) depend(inout: markerToken[iMarker]))
+          {}
+        }
 
-      counter_local += bad_i+bad_j;
+        SU2_OMP_TASK_(depend(in: colorToken[color]) depend(inout: markerToken[iMarker]))
+        (*WeakBC)(iMarker);
+      }
 
-      numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
-      numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
+      for (auto k = 0ul; k < coloring.getNumNonZeros(color); ++k) {
+        const unsigned short iMarker = coloring.getInnerIdx(color, k);
+        if (!GetBC_TaskSafe(config->GetMarker_All_KindBC(iMarker))) continue;
 
+        SU2_OMP_TASK_(depend(in: markerToken[iMarker]) depend(inout: colorToken[color+1]))
+        {}
+      }
     }
 
-    /*--- Roe Low Dissipation Scheme ---*/
+    SU2_OMP_TASKWAIT
 
-    if (kind_dissipation != NO_ROELOWDISS) {
+    TaskMUSCL = false;
+  }
+  SU2_OMP_BARRIER
 
-      numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
-                               nodes->GetRoe_Dissipation(jPoint));
+  /*--- Warning message about non-physical reconstructions. ---*/
 
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        numerics->SetSensor(nodes->GetSensor(iPoint),
-                            nodes->GetSensor(jPoint));
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        numerics->SetCoord(Coord_i, Coord_j);
-      }
+  if (upwind && (iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
+    SU2_OMP_MASTER
+    {
+      unsigned long counter_local = ErrorCounter;
+      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+      config->SetNonphysical_Reconstr(ErrorCounter);
     }
+    SU2_OMP_BARRIER
+  }
 
-    /*--- Compute the residual ---*/
+}
 
-    auto residual = numerics->ComputeResidual(config);
+void CEulerSolver::MUSCL_Reconstruction(CGeometry *geometry, unsigned long iPoint, unsigned long jPoint,
+                                        bool limiter, bool van_albada, bool consistent, bool low_mach_corr,
+                                        su2double *Primitive_i, su2double *Primitive_j,
+                                        su2double *Secondary_i, su2double *Secondary_j,
+                                        bool &bad_i, bool &bad_j) {
 
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
+  unsigned short iDim, iVar;
 
-    if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
-      nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
-      nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
-    }
+  auto Coord_i = geometry->GetPointCoord(iPoint);
+  auto Coord_j = geometry->GetPointCoord(jPoint);
 
-    /*--- Update residual value ---*/
+  auto V_i = nodes->GetPrimitive(iPoint);
+  auto V_j = nodes->GetPrimitive(jPoint);
 
-    if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
-      if (implicit)
-        Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+  su2double Vector_ij[MAXNDIM] = {0.0};
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+  }
+
+  auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+  auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+  su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+
+  if (limiter) {
+    Limiter_i = nodes->GetLimiter_Primitive(iPoint);
+    Limiter_j = nodes->GetLimiter_Primitive(jPoint);
+  }
+
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+
+    su2double Project_Grad_i = 0.0;
+    su2double Project_Grad_j = 0.0;
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+      Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
     }
-    else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
 
-      /*--- Set implicit computation ---*/
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+    if (limiter) {
+      if (van_albada) {
+        su2double V_ij = V_j[iVar] - V_i[iVar];
+        Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
+        Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
+      }
+      Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+      Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
     }
+    else {
+      Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+      Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+    }
+
+  }
 
-    /*--- Viscous contribution. ---*/
+  /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+  if (consistent) {
+    ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
+    ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
   }
-  } // end color loop
 
-  if (ReducerStrategy) {
-    SumEdgeFluxes(geometry);
-    if (implicit)
-      Jacobian.SetDiagonalAsColumnSum();
+  /*--- Low-Mach number correction. ---*/
+
+  if (low_mach_corr) {
+    LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
   }
 
-  /*--- Warning message about non-physical reconstructions. ---*/
+  /*--- Check for non-physical solutions after reconstruction. If found, use the
+   cell-average value of the solution. This is a locally 1st order approximation,
+   which is typically only active during the start-up of a calculation. ---*/
 
-  if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-    /*--- Add counter results for all threads. ---*/
-    SU2_OMP_ATOMIC
-    ErrorCounter += counter_local;
-    SU2_OMP_BARRIER
+  bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
+  bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
 
-    /*--- Add counter results for all ranks. ---*/
-    SU2_OMP_MASTER
-    {
-      counter_local = ErrorCounter;
-      SU2_MPI::Reduce(&counter_local, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-      config->SetNonphysical_Reconstr(ErrorCounter);
+  su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
+  su2double sq_vel = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
+    sq_vel += pow(RoeVelocity, 2);
+  }
+  su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+
+  bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+
+  bad_i = neg_sound_speed || neg_pres_or_rho_i;
+  bad_j = neg_sound_speed || neg_pres_or_rho_j;
+
+  nodes->SetNon_Physical(iPoint, bad_i);
+  nodes->SetNon_Physical(jPoint, bad_j);
+
+  /*--- Get updated state, in case the point recovered after the set. ---*/
+  bad_i = nodes->GetNon_Physical(iPoint);
+  bad_j = nodes->GetNon_Physical(jPoint);
+
+}
+
+unsigned long CEulerSolver::BatchedConvective_Residual(CGeometry *geometry, CSolver **solver_container,
+                                                       CNumerics **numerics_container, CConfig *config,
+                                                       unsigned short iMesh, EdgeSet edgeSet) {
+
+  constexpr size_t BatchSize = CBatchedConvectiveFlux::BatchSize;
+  constexpr size_t MAXNVAR_CONV = CBatchedConvectiveFlux::MAXNVAR;
+
+  const bool implicit   = AssembleJacobian(config);
+  const bool centered   = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
+  const bool muscl      = !centered && config->GetMUSCL_Flow() && (iMesh == MESH_0);
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                          (config->GetInnerIter() <= config->GetLimiterIter());
+  const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
+
+  unsigned long counter_local = 0;
+
+  /*--- Static arrays for the batch state and fluxes, for the MUSCL reconstruction, and
+   *    for the flux and Jacobians of one edge (thread safety). ---*/
+
+  CBatchedConvectiveFlux::Input input;
+  CBatchedConvectiveFlux::Output output;
+
+  su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
+  su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
+
+  su2double Flux[MAXNVAR_CONV] = {0.0};
+  su2double Jacobian_i[MAXNVAR_CONV][MAXNVAR_CONV] = {{0.0}}, Jacobian_j[MAXNVAR_CONV][MAXNVAR_CONV] = {{0.0}};
+  su2double *Jac_i[MAXNVAR_CONV], *Jac_j[MAXNVAR_CONV];
+  for (auto iVar = 0ul; iVar < MAXNVAR_CONV; ++iVar) {
+    Jac_i[iVar] = Jacobian_i[iVar];
+    Jac_j[iVar] = Jacobian_j[iVar];
+  }
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  const auto nBatch = roundUpDiv(color.size, BatchSize);
+
+  /*--- Chunk size (in edges) is at least OMP_MIN_SIZE and a multiple of the color group size,
+   *    it is also a multiple of the batch size so that groups are not split across threads. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize*(color.groupSize%BatchSize? BatchSize : 1))/BatchSize)
+  for (auto iBatch = 0ul; iBatch < nBatch; ++iBatch) {
+
+    /*--- Edges of the batch that belong to the set being computed. ---*/
+
+    const auto kBegin = iBatch*BatchSize;
+    const auto kEnd = min<unsigned long>(kBegin+BatchSize, color.size);
+
+    unsigned long edges[BatchSize], nLane = 0;
+    for (auto k = kBegin; k < kEnd; ++k) {
+      auto iEdge = color.indices[k];
+      if (InEdgeSet(iEdge, edgeSet)) edges[nLane++] = iEdge;
+    }
+    if (nLane == 0) continue;
+
+    /*--- Gather the state of the edges in the batch, an incomplete batch is padded
+     *    with copies of its first edge (without reconstruction to avoid side effects). ---*/
+
+    for (auto iLane = 0ul; iLane < BatchSize; ++iLane) {
+
+      const bool padding = (iLane >= nLane);
+      auto iEdge = edges[padding? 0 : iLane];
+
+      auto iPoint = geometry->GetEdgeNode(iEdge,0);
+      auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+      auto Normal = geometry->GetEdgeNormal(iEdge);
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        input.normal[iDim][iLane] = SU2_TYPE::GetValue(Normal[iDim]);
+
+      /*--- Primitive variables with or without MUSCL reconstruction. ---*/
+
+      su2double *V_i = nodes->GetPrimitive(iPoint), *V_j = nodes->GetPrimitive(jPoint);
+
+      if (muscl && !padding) {
+        bool bad_i = false, bad_j = false;
+
+        MUSCL_Reconstruction(geometry, iPoint, jPoint, limiter, van_albada, false, false,
+                             Primitive_i, Primitive_j, Secondary_i, Secondary_j, bad_i, bad_j);
+
+        counter_local += bad_i+bad_j;
+
+        if (!bad_i) V_i = Primitive_i;
+        if (!bad_j) V_j = Primitive_j;
+      }
+
+      for (auto iVar = 0u; iVar < nDim+5u; ++iVar) {
+        input.V_i[iVar][iLane] = SU2_TYPE::GetValue(V_i[iVar]);
+        input.V_j[iVar][iLane] = SU2_TYPE::GetValue(V_j[iVar]);
+      }
+
+      /*--- Grid movement. ---*/
+
+      if (dynamic_grid) {
+        auto GridVel_i = geometry->GetPointGridVel(iPoint);
+        auto GridVel_j = geometry->GetPointGridVel(jPoint);
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          input.gridVel_i[iDim][iLane] = SU2_TYPE::GetValue(GridVel_i[iDim]);
+          input.gridVel_j[iDim][iLane] = SU2_TYPE::GetValue(GridVel_j[iDim]);
+        }
+      }
+
+      /*--- Spectral radius, neighbors, undivided Laplacian, and sensor (JST). ---*/
+
+      if (centered) {
+        input.lambda_i[iLane] = SU2_TYPE::GetValue(nodes->GetLambda(iPoint));
+        input.lambda_j[iLane] = SU2_TYPE::GetValue(nodes->GetLambda(jPoint));
+        input.nNeighbor_i[iLane] = geometry->node[iPoint]->GetnNeighbor();
+        input.nNeighbor_j[iLane] = geometry->node[jPoint]->GetnNeighbor();
+        input.sensor_i[iLane] = SU2_TYPE::GetValue(nodes->GetSensor(iPoint));
+        input.sensor_j[iLane] = SU2_TYPE::GetValue(nodes->GetSensor(jPoint));
+
+        auto Und_Lapl_i = nodes->GetUndivided_Laplacian(iPoint);
+        auto Und_Lapl_j = nodes->GetUndivided_Laplacian(jPoint);
+        for (auto iVar = 0u; iVar < nVar; ++iVar) {
+          input.undivLapl_i[iVar][iLane] = SU2_TYPE::GetValue(Und_Lapl_i[iVar]);
+          input.undivLapl_j[iVar][iLane] = SU2_TYPE::GetValue(Und_Lapl_j[iVar]);
+        }
+      }
+    }
+
+    /*--- Compute the fluxes of the batch. ---*/
+
+    batchedConvFlux->ComputeFlux(input, output);
+
+    /*--- Update the residuals and Jacobians edge by edge. ---*/
+
+    for (auto iLane = 0ul; iLane < nLane; ++iLane) {
+
+      auto iEdge = edges[iLane];
+
+      auto iPoint = geometry->GetEdgeNode(iEdge,0);
+      auto jPoint = geometry->GetEdgeNode(iEdge,1);
+
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        Flux[iVar] = output.flux[iVar][iLane];
+        if (implicit) {
+          for (auto jVar = 0u; jVar < nVar; ++jVar) {
+            Jacobian_i[iVar][jVar] = output.jac_i[iVar][jVar][iLane];
+            Jacobian_j[iVar][jVar] = output.jac_j[iVar][jVar][iLane];
+          }
+        }
+      }
+
+      CNumerics::ResidualType<> residual(Flux, Jac_i, Jac_j);
+
+      if (ReducerStrategy) {
+        EdgeFluxes.SetBlock(iEdge, residual);
+        if (implicit)
+          Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+      }
+      else {
+        LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.SubtractBlock(jPoint, residual);
+        if (implicit)
+          Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+      }
+
+      /*--- Viscous contribution. ---*/
+
+      Viscous_Residual(iEdge, geometry, solver_container,
+                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
     }
-    SU2_OMP_BARRIER
   }
+  } // end color loop
 
+  return counter_local;
 }
 
 void CEulerSolver::SumEdgeFluxes(CGeometry* geometry) {
@@ -3351,7 +3923,42 @@ void CEulerSolver::LowMachPrimitiveCorrection(CFluidModel *fluidModel, unsigned
 void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  if (!GetPointSources(config)) return;
+
+  /*--- Include the residual contribution from GCL due to the static
+   mesh movement that is set for rotating frame. ---*/
+
+  if (config->GetRotating_Frame()) {
+    SU2_OMP_MASTER
+    SetRotatingFrame_GCL(geometry, config);
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Loop over chunks of points, each computes all the source terms of its points. ---*/
+
+  const auto nChunk = roundUpDiv(nPointDomain, omp_chunk_size);
+
+  SU2_OMP_FOR_DYN(1)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    PointSource_Residual(geometry, numerics_container, config, iChunk*omp_chunk_size,
+                         min((iChunk+1)*omp_chunk_size, nPointDomain));
+  }
+
+}
+
+bool CEulerSolver::GetPointSources(const CConfig *config) const {
+
+  const bool mms = VerificationSolution && VerificationSolution->IsManufacturedSolution();
+
+  return config->GetBody_Force() || config->GetRotating_Frame() || config->GetAxisymmetric() ||
+         (config->GetGravityForce() == YES) || (config->GetTime_Marching() == HARMONIC_BALANCE) ||
+         config->GetWind_Gust() || mms;
+}
+
+void CEulerSolver::PointSource_Residual(CGeometry *geometry, CNumerics **numerics_container, CConfig *config,
+                                        unsigned long iPointBegin, unsigned long iPointEnd) {
+
+  const bool implicit         = AssembleJacobian(config);
   const bool rotating_frame   = config->GetRotating_Frame();
   const bool axisymmetric     = config->GetAxisymmetric();
   const bool gravity          = (config->GetGravityForce() == YES);
@@ -3359,7 +3966,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool windgust         = config->GetWind_Gust();
   const bool body_force       = config->GetBody_Force();
 
-  /*--- Pick one numerics object per thread. ---*/
+  /*--- Pick the numerics object of the thread. ---*/
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
   unsigned short iVar;
@@ -3368,8 +3975,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (body_force) {
 
     /*--- Loop over all points ---*/
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
@@ -3389,16 +3995,8 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
   if (rotating_frame) {
 
-    /*--- Include the residual contribution from GCL due to the static
-     mesh movement that is set for rotating frame. ---*/
-
-    SU2_OMP_MASTER
-    SetRotatingFrame_GCL(geometry, config);
-    SU2_OMP_BARRIER
-
     /*--- Loop over all points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
@@ -3422,8 +4020,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (axisymmetric) {
 
     /*--- loop over points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
@@ -3449,8 +4046,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (gravity) {
 
     /*--- loop over points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
@@ -3471,8 +4067,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (harmonic_balance) {
 
     /*--- loop over points ---*/
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Get control volume ---*/
       su2double Volume = geometry->node[iPoint]->GetVolume();
@@ -3487,8 +4082,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (windgust) {
 
     /*--- Loop over all points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
       /*--- Load the wind gust ---*/
       numerics->SetWindGust(nodes->GetWindGust(iPoint), nodes->GetWindGust(iPoint));
@@ -3524,8 +4118,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       if (config->GetTime_Marching()) time = config->GetPhysicalTime();
 
       /*--- Loop over points ---*/
-      SU2_OMP_FOR_DYN(omp_chunk_size)
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
 
         /*--- Get control volume size. ---*/
         su2double Volume = geometry->node[iPoint]->GetVolume();
@@ -3577,7 +4170,7 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       auto jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
 
       auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
-      auto Normal = geometry->edge[iEdge]->GetNormal();
+      auto Normal = geometry->GetEdgeNormal(iEdge);
       su2double Area = 0.0;
       for (unsigned short iDim = 0; iDim < nDim; iDim++) Area += pow(Normal[iDim],2);
       Area = sqrt(Area);
@@ -3590,8 +4183,8 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       /*--- Adjustment for grid movement ---*/
 
       if (dynamic_grid) {
-        const su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-        const su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+        const su2double *GridVel_i = geometry->GetPointGridVel(iPoint);
+        const su2double *GridVel_j = geometry->GetPointGridVel(jPoint);
 
         for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
@@ -3631,7 +4224,7 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
       /*--- Adjustment for grid movement ---*/
 
       if (dynamic_grid) {
-        auto GridVel = geometry->node[iPoint]->GetGridVel();
+        auto GridVel = geometry->GetPointGridVel(iPoint);
         for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Mean_ProjVel -= GridVel[iDim]*Normal[iDim];
       }
@@ -4598,7 +5191,18 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+  Implicit_Iteration(geometry, solver_container, config, nullptr);
+}
+
+void CEulerSolver::ImplicitNewtonKrylov_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                                  const std::function<void()>& ComputeResidual) {
+  Implicit_Iteration(geometry, solver_container, config, &ComputeResidual);
+}
 
+void CEulerSolver::Implicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                      const std::function<void()>* ComputeResidual) {
+
+  const bool newton_krylov = (ComputeResidual != nullptr);
   const bool adjoint = config->GetContinuous_Adjoint();
   const bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   const bool low_mach_prec = config->Low_Mach_Preconditioning();
@@ -4625,6 +5229,23 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  /*--- Store the state and residual about which the Jacobian-free products
+   *    are computed, before the residual becomes the right hand side. ---*/
+
+  if (newton_krylov) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        NewtonKrylovSol(iPoint,iVar) = nodes->GetSolution(iPoint,iVar);
+        NewtonKrylovRes(iPoint,iVar) = LinSysRes(iPoint,iVar);
+      }
+    }
+    const su2double solNorm = NewtonKrylovSol.norm();
+    SU2_OMP_MASTER
+    NewtonKrylovSolNorm = solNorm;
+    SU2_OMP_BARRIER
+  }
+
   /*--- Build implicit system ---*/
 
   SU2_OMP(for schedule(static,omp_chunk_size) nowait)
@@ -4704,7 +5325,8 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
   /*--- Solve or smooth the linear system. ---*/
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  auto iter = newton_krylov? NewtonKrylov_Solve(System, geometry, solver_container, config, *ComputeResidual) :
+                             System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   SU2_OMP_MASTER
   {
     SetIterLinSolver(iter);
@@ -4750,6 +5372,125 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 }
 
+template<class ScalarType>
+unsigned long CEulerSolver::NewtonKrylov_Solve(CSysSolve<ScalarType>& system, CGeometry *geometry, CSolver **solver_container,
+                                               CConfig *config, const std::function<void()>& ComputeResidual) {
+
+  /*--- The residual evaluations overwrite LinSysRes, therefore the right hand side is copied. ---*/
+
+  SU2_OMP_BARRIER
+  LinSysAux = LinSysRes;
+
+  const auto product = CMatrixFreeVectorProduct<ScalarType>(
+    [&](const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v) {
+      JacobianFreeProduct(geometry, solver_container, config, ComputeResidual, u, v);
+    });
+
+  const auto iter = system.Solve(Jacobian, LinSysAux, LinSysSol, geometry, config, &product);
+
+  /*--- The primitive variables, gradients, etc. are those of the last perturbed state, they
+   *    are recomputed for the current solution as they are used by other solvers and the output. ---*/
+
+  NewtonKrylov_Residual(geometry, solver_container, config, nullptr);
+
+  return iter;
+}
+
+template<class ScalarType>
+void CEulerSolver::JacobianFreeProduct(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                       const std::function<void()>& ComputeResidual,
+                                       const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v) {
+
+  /*--- Finite difference step, relative to the magnitude of the solution and of the direction. ---*/
+
+  const su2double norm_u = u.norm();
+
+  if (norm_u == 0.0) {
+    v = ScalarType(0.0);
+    return;
+  }
+
+  const su2double eps = config->GetNewtonKrylov_Epsilon() * (1.0 + NewtonKrylovSolNorm) / norm_u;
+
+  /*--- Perturb the solution and update the halos. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, NewtonKrylovSol(iPoint,iVar) + eps*u(iPoint,iVar));
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Residual of the perturbed state. ---*/
+
+  NewtonKrylov_Residual(geometry, solver_container, config, &ComputeResidual);
+
+  /*--- Finite difference plus pseudo-time term (as in the assembled system), and restore the solution. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, NewtonKrylovSol(iPoint,iVar));
+
+    if (iPoint >= nPointDomain) {
+      v.SetBlock_Zero(iPoint);
+    }
+    else if (nodes->GetDelta_Time(iPoint) != 0.0) {
+      const su2double Vol = geometry->node[iPoint]->GetVolume() + geometry->node[iPoint]->GetPeriodicVolume();
+      const su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        v(iPoint,iVar) = SU2_TYPE::GetValue((LinSysRes(iPoint,iVar) - NewtonKrylovRes(iPoint,iVar)) / eps +
+                                            Delta * u(iPoint,iVar));
+    }
+    else {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        v(iPoint,iVar) = u(iPoint,iVar);
+    }
+  }
+
+}
+
+void CEulerSolver::NewtonKrylov_Residual(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                         const std::function<void()>* ComputeResidual) {
+
+  /*--- Neither the preprocessing nor the residual routines may modify the Jacobian,
+   *    which is in use as the preconditioner (see AssembleJacobian). ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  JacobianFreeResidual = true;
+  SU2_OMP_BARRIER
+
+  Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+  /*--- Without the residual computation the deferred halo exchange needs to be done here. ---*/
+
+  if (ComputeResidual) (*ComputeResidual)();
+  else {
+    /*--- The MUSCL data may have been left for the task graph. ---*/
+    if (TaskMUSCL) {
+      MUSCL_Preprocessing(geometry, config);
+      SU2_OMP_MASTER
+      TaskMUSCL = false;
+      SU2_OMP_BARRIER
+    }
+    CompleteDeferredComms(geometry, config, false);
+  }
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  JacobianFreeResidual = false;
+  SU2_OMP_BARRIER
+
+}
+
 void CEulerSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, CConfig *config) {
 
   /* Loop over the solution update given by relaxing the linear
@@ -4796,13 +5537,65 @@ void CEulerSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, CCon
 
 }
 
+void CEulerSolver::InitiateDeferredComms(CGeometry *geometry, CConfig *config) {
+
+  SU2_OMP_MASTER
+  if (DeferredComm) InitiateComms(geometry, config, DeferredCommType);
+}
+
+void CEulerSolver::CompleteDeferredComms(CGeometry *geometry, CConfig *config, bool started) {
+
+  /*--- Barrier so that all threads have seen the state before it is reset. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  if (DeferredComm) {
+    if (!started) InitiateComms(geometry, config, DeferredCommType);
+    CompleteComms(geometry, config, DeferredCommType);
+    DeferredComm = false;
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ComputeFunc>
+void CEulerSolver::OverlappedHaloComms(CGeometry *geometry, CConfig *config, MPI_QUANTITIES commType,
+                                       bool defer, const ComputeFunc& compute) {
+
+  /*--- A deferred exchange of the same quantity would be overwritten by the new one. ---*/
+  SU2_OMP_MASTER
+  if (DeferredComm && (DeferredCommType == commType)) DeferredComm = false;
+
+  /*--- The deferred exchange does not involve the data being computed. ---*/
+  InitiateDeferredComms(geometry, config);
+
+  compute();
+
+  CompleteDeferredComms(geometry, config, true);
+
+  SU2_OMP_MASTER
+  {
+    if (defer) {
+      DeferredComm = true;
+      DeferredCommType = commType;
+    }
+    else {
+      InitiateComms(geometry, config, commType);
+      CompleteComms(geometry, config, commType);
+    }
+  }
+  SU2_OMP_BARRIER
+}
+
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool reconstruction) {
 
   const auto& primitives = nodes->GetPrimitive();
   auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
 
-  computeGradientsGreenGauss(this, PRIMITIVE_GRADIENT, PERIODIC_PRIM_GG, *geometry,
-                             *config, primitives, 0, nPrimVarGrad, gradient);
+  /*--- Only the exchange of reconstruction gradients can be deferred (to the residual computation). ---*/
+
+  OverlappedHaloComms(geometry, config, PRIMITIVE_GRADIENT, reconstruction && OverlapComms, [&]() {
+    computeGradientsGreenGauss(this, PRIMITIVE_GRADIENT, PERIODIC_PRIM_GG, *geometry,
+                               *config, primitives, 0, nPrimVarGrad, gradient, false);
+  });
 }
 
 void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool reconstruction) {
@@ -4820,8 +5613,10 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
   auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   PERIODIC_QUANTITIES kindPeriodicComm = weighted? PERIODIC_PRIM_LS : PERIODIC_PRIM_ULS;
 
-  computeGradientsLeastSquares(this, PRIMITIVE_GRADIENT, kindPeriodicComm, *geometry, *config,
-                               weighted, primitives, 0, nPrimVarGrad, gradient, rmatrix);
+  OverlappedHaloComms(geometry, config, PRIMITIVE_GRADIENT, reconstruction && OverlapComms, [&]() {
+    computeGradientsLeastSquares(this, PRIMITIVE_GRADIENT, kindPeriodicComm, *geometry, *config,
+                                 weighted, primitives, 0, nPrimVarGrad, gradient, rmatrix, false);
+  });
 }
 
 void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
@@ -4833,8 +5628,13 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
-  computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
-            *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+  /*--- The limiters of owned points only need their own gradients, i.e. they can be
+   *    computed while the (deferred) exchange of reconstruction gradients takes place. ---*/
+
+  OverlappedHaloComms(geometry, config, PRIMITIVE_LIMITER, OverlapComms, [&]() {
+    computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
+              *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, false);
+  });
 }
 
 void CEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
@@ -6753,7 +7553,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
   unsigned short iDim, iVar;
   unsigned long iVertex, iPoint;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+  bool implicit = AssembleJacobian(config),
        viscous  = config->GetViscous();
 
   /*--- Allocation of variables necessary for convective fluxes. ---*/
@@ -7037,7 +7837,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   su2double Gas_Constant     = config->GetGas_ConstantND();
 
-  bool implicit       = config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT;
+  bool implicit       = AssembleJacobian(config);
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -7292,7 +8092,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   su2double *gridVel;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = AssembleJacobian(config);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   bool gravity = (config->GetGravityForce());
@@ -7798,7 +8598,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   su2double AverageEnthalpy, AverageEntropy;
   unsigned short  iZone  = config->GetiZone();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
   bool viscous = config->GetViscous();
@@ -8455,7 +9255,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   su2double Pressure_e;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   unsigned short  iZone     = config->GetiZone();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = AssembleJacobian(config);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
@@ -9195,7 +9995,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
   su2double *V_inlet, *V_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = AssembleJacobian(config);
   su2double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   su2double Gas_Constant       = config->GetGas_ConstantND();
   unsigned short Kind_Inlet = config->GetKind_Inlet();
@@ -9492,7 +10292,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   Area, UnitNormal[3];
   su2double *V_outlet, *V_domain;
 
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = AssembleJacobian(config);
   su2double Gas_Constant     = config->GetGas_ConstantND();
   string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
   bool gravity = (config->GetGravityForce());
@@ -9665,7 +10465,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   su2double Density, Pressure, Temperature, Energy, *Vel, Velocity2;
   su2double Gas_Constant = config->GetGas_ConstantND();
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double *Normal = new su2double[nDim];
@@ -9807,7 +10607,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   unsigned long iVertex, iPoint;
   su2double *V_outlet, *V_domain;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   su2double *Normal = new su2double[nDim];
@@ -9929,7 +10729,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
   su2double *V_inflow, *V_domain;
 
   su2double DampingFactor = config->GetDamp_Engine_Inflow();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
   unsigned short Kind_Engine_Inflow = config->GetKind_Engine_Inflow();
   su2double Gas_Constant = config->GetGas_ConstantND();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -10151,7 +10951,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
   su2double *V_exhaust, *V_domain, Target_Exhaust_Pressure, Exhaust_Pressure_old, Exhaust_Pressure_inc;
 
   su2double Gas_Constant = config->GetGas_ConstantND();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double DampingFactor = config->GetDamp_Engine_Exhaust();
@@ -10403,7 +11203,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
   unsigned long iVertex, jVertex, iPoint, Point_Normal = 0;
   unsigned short iDim, iVar, jVar, iMarker, nDonorVertex;
 
-  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit      = AssembleJacobian(config);
   bool viscous       = config->GetViscous();
 
   su2double Normal[MAXNDIM] = {0.0};
@@ -10570,7 +11370,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -10632,7 +11432,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = AssembleJacobian(config);
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -10721,7 +11521,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   Mach_out, Pressure_in, Density_in, SoundSpeed_in, Velocity2_in,
   Mach_in, PressureAdj, TemperatureAdj;
 
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = AssembleJacobian(config);
   su2double Gas_Constant  = config->GetGas_ConstantND();
   bool tkeNeeded          = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   bool ratio              = (config->GetActDisk_Jump() == RATIO);
@@ -11145,7 +11945,7 @@ void CEulerSolver::BC_Custom(CGeometry      *geometry,
     unsigned short iVar;
     unsigned long iVertex, iPoint, total_index;
 
-    bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    bool implicit = AssembleJacobian(config);
 
     /*--- Get the physical time. ---*/
 
@@ -11215,7 +12015,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
   const su2double *Normal = nullptr, *GridVel_i = nullptr, *GridVel_j = nullptr;
   su2double Residual_GCL;
 
-  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = AssembleJacobian(config);
   const bool first_order = (config->GetTime_Marching() == DT_STEPPING_1ST);
   const bool second_order = (config->GetTime_Marching() == DT_STEPPING_2ND);
 
@@ -11618,6 +12418,8 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
       solver[iMesh][FLOW_SOL]->GetNodes()->SetSolution(iPoint,Solution);
     }
 
+    if (config->GetMG_ParallelAgglomeration())
+      solver[iMesh][FLOW_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
     solver[iMesh][FLOW_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
     solver[iMesh][FLOW_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
 
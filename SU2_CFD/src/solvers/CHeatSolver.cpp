@@ -436,6 +436,8 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
       }
       solver[iMesh][HEAT_SOL]->GetNodes()->SetSolution(iPoint,Solution);
     }
+    if (config->GetMG_ParallelAgglomeration())
+      solver[iMesh][HEAT_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
     solver[iMesh][HEAT_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
     solver[iMesh][HEAT_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
     solver[iMesh][HEAT_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_HEAT_SYS, false);
@@ -1704,6 +1706,8 @@ void CHeatSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_co
         }
         solver_container[iMesh][HEAT_SOL]->GetNodes()->SetSolution(iPoint,Solution);
       }
+      if (config->GetMG_ParallelAgglomeration())
+        solver_container[iMesh][HEAT_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
       solver_container[iMesh][HEAT_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION);
       solver_container[iMesh][HEAT_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION);
     }
@@ -45,6 +45,9 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 
 CSolver::CSolver(bool mesh_deform_mode) : System(mesh_deform_mode) {
@@ -2318,6 +2321,39 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
 }
 
+void CSolver::AddHaloValues(CGeometry *geometry, unsigned short commType) {
+
+  switch (commType) {
+    case SOLUTION:
+      geometry->ExchangeHaloValues<su2double>(nVar, true,
+        [this](unsigned long iPoint, unsigned short iVar) { return base_nodes->GetSolution(iPoint, iVar); },
+        [this](unsigned long iPoint, unsigned short iVar, su2double val) {
+          base_nodes->SetSolution(iPoint, iVar, base_nodes->GetSolution(iPoint, iVar) + val); });
+      break;
+    case SOLUTION_OLD:
+      geometry->ExchangeHaloValues<su2double>(nVar, true,
+        [this](unsigned long iPoint, unsigned short iVar) { return base_nodes->GetSolution_Old(iPoint, iVar); },
+        [this](unsigned long iPoint, unsigned short iVar, su2double val) {
+          base_nodes->SetSolution_Old(iPoint, iVar, base_nodes->GetSolution_Old(iPoint, iVar) + val); });
+      break;
+    case EDDY_VISCOSITY:
+      geometry->ExchangeHaloValues<su2double>(1, true,
+        [this](unsigned long iPoint, unsigned short) { return base_nodes->GetmuT(iPoint); },
+        [this](unsigned long iPoint, unsigned short, su2double val) {
+          base_nodes->SetmuT(iPoint, base_nodes->GetmuT(iPoint) + val); });
+      break;
+    case RES_TRUNC_ERROR:
+      geometry->ExchangeHaloValues<su2double>(nVar, true,
+        [this](unsigned long iPoint, unsigned short iVar) { return base_nodes->GetResTruncError(iPoint)[iVar]; },
+        [this](unsigned long iPoint, unsigned short iVar, su2double val) { base_nodes->GetResTruncError(iPoint)[iVar] += val; });
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized quantity for the reverse communication.", CURRENT_FUNCTION);
+      break;
+  }
+
+}
+
 void CSolver::ResetCFLAdapt() {
   NonLinRes_Series.clear();
   NonLinRes_Value = 0;
@@ -3634,7 +3670,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2CompressedRestart::MAGIC_NUMBER)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3673,7 +3709,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2CompressedRestart::MAGIC_NUMBER)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3748,6 +3784,217 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
 
 }
 
+namespace {
+
+/*!
+ * \brief Send the restart data, read by each rank as a contiguous range of global points, to the ranks that own
+ *        the points (a single exchange of requests and a single exchange of data).
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] nFields - Number of fields per point.
+ * \param[in] readerStart - First global point read by each rank, and the total number of points (size+1 entries).
+ * \param[in,out] data - Data read by this rank, nPoint x nFields, it is released.
+ * \return Data of the points of this rank in the order expected by the LoadRestart routines (by global index).
+ */
+passivedouble* RedistributeRestartData(CGeometry *geometry, unsigned long nFields,
+                                       const vector<unsigned long>& readerStart, vector<passivedouble>& data) {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  /*--- The global indices of the local points, sorted, are requested from the ranks that read them. ---*/
+
+  vector<unsigned long> globalIndex(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    globalIndex[iPoint] = geometry->node[iPoint]->GetGlobalIndex();
+  sort(globalIndex.begin(), globalIndex.end());
+
+  vector<int> nRequest(size, 0), nRequestRecv(size, 0);
+  int iRank = 0;
+
+  for (auto iPoint_Global : globalIndex) {
+    while (readerStart[iRank+1] <= iPoint_Global) iRank++;
+    nRequest[iRank]++;
+  }
+
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequestRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  vector<int> requestDispl(size+1, 0), requestRecvDispl(size+1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    requestDispl[iRank+1] = requestDispl[iRank] + nRequest[iRank];
+    requestRecvDispl[iRank+1] = requestRecvDispl[iRank] + nRequestRecv[iRank];
+  }
+
+  vector<unsigned long> requested(requestRecvDispl[size]);
+
+  SU2_MPI::Alltoallv(globalIndex.data(), nRequest.data(), requestDispl.data(), MPI_UNSIGNED_LONG,
+                     requested.data(), nRequestRecv.data(), requestRecvDispl.data(), MPI_UNSIGNED_LONG,
+                     MPI_COMM_WORLD);
+
+  /*--- Reply with the data of the requested points. ---*/
+
+  vector<passivedouble> reply(requested.size()*nFields);
+
+  for (unsigned long iReq = 0; iReq < requested.size(); iReq++) {
+    const unsigned long iPoint = requested[iReq] - readerStart[rank];
+    for (unsigned long iVar = 0; iVar < nFields; iVar++)
+      reply[iReq*nFields+iVar] = data[iPoint*nFields+iVar];
+  }
+  vector<passivedouble>().swap(data);
+
+  for (iRank = 0; iRank <= size; iRank++) {
+    if (iRank < size) {
+      nRequest[iRank] *= nFields;
+      nRequestRecv[iRank] *= nFields;
+    }
+    requestDispl[iRank] *= nFields;
+    requestRecvDispl[iRank] *= nFields;
+  }
+
+  auto restartData = new passivedouble[nFields*nPointDomain];
+
+  /*--- Passive data, hence the base wrapper (no AD types). ---*/
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Alltoallv(reply.data(), nRequestRecv.data(), requestRecvDispl.data(), MPI_DOUBLE,
+                             restartData, nRequest.data(), requestDispl.data(), MPI_DOUBLE,
+                             MPI_COMM_WORLD);
+#else
+  copy(reply.begin(), reply.end(), restartData);
+#endif
+
+  return restartData;
+}
+
+}
+
+namespace {
+
+/*!
+ * \brief Number of fields per point moved by CSolver::GetMigrationData, the time levels that are allocated
+ *        (see CVariable) and the local CFL number.
+ */
+unsigned long GetnMigrationFields(const CConfig *config, unsigned long nVar, bool localCFL) {
+  unsigned long nFields = nVar;
+  if (config->GetTime_Marching() != NO) nFields += 2*nVar;
+  else if (config->GetTime_Domain()) nFields += nVar;
+  return nFields + localCFL;
+}
+
+}
+
+vector<passivedouble> CSolver::GetMigrationData(CGeometry *geometry, const CConfig *config, bool localCFL) const {
+
+  const unsigned long nFields = GetnMigrationFields(config, nVar, localCFL);
+  const bool time_n = (config->GetTime_Marching() != NO) || config->GetTime_Domain();
+  const bool time_n1 = (config->GetTime_Marching() != NO);
+
+  CLinearPartitioner pointPartitioner(geometry->GetGlobal_nPointDomain(),0);
+
+  /*--- Pack the owned points by destination rank of the linear partition. ---*/
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDispl(size+1, 0), recvDispl(size+1, 0);
+  vector<int> destination(geometry->GetnPointDomain());
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    destination[iPoint] = pointPartitioner.GetRankContainingIndex(geometry->node[iPoint]->GetGlobalIndex());
+    nSend[destination[iPoint]]++;
+  }
+
+  CBaseMPIWrapper::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> indexSend(sendDispl[size]), indexRecv(recvDispl[size]);
+  vector<passivedouble> dataSend(sendDispl[size]*nFields), dataRecv(recvDispl[size]*nFields);
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const int iSend = counter[destination[iPoint]]++;
+    indexSend[iSend] = geometry->node[iPoint]->GetGlobalIndex();
+
+    passivedouble* values = &dataSend[iSend*nFields];
+    for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+      *(values++) = SU2_TYPE::GetValue(base_nodes->GetSolution(iPoint,iVar));
+      if (time_n) *(values++) = SU2_TYPE::GetValue(base_nodes->GetSolution_time_n(iPoint,iVar));
+      if (time_n1) *(values++) = SU2_TYPE::GetValue(base_nodes->GetSolution_time_n1(iPoint,iVar));
+    }
+    if (localCFL) *values = SU2_TYPE::GetValue(base_nodes->GetLocalCFL(iPoint));
+  }
+
+  CBaseMPIWrapper::Alltoallv(indexSend.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                             indexRecv.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                             MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank <= size; iRank++) {
+    if (iRank < size) {
+      nSend[iRank] *= nFields;
+      nRecv[iRank] *= nFields;
+    }
+    sendDispl[iRank] *= nFields;
+    recvDispl[iRank] *= nFields;
+  }
+
+  CBaseMPIWrapper::Alltoallv(dataSend.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                             dataRecv.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE,
+                             MPI_COMM_WORLD);
+
+  /*--- Order by global index. ---*/
+
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  vector<passivedouble> data(pointPartitioner.GetSizeOnRank(rank)*nFields);
+
+  for (unsigned long iRecv = 0; iRecv < indexRecv.size(); iRecv++) {
+    const unsigned long iPoint = indexRecv[iRecv] - firstIndex;
+    copy(&dataRecv[iRecv*nFields], &dataRecv[(iRecv+1)*nFields], &data[iPoint*nFields]);
+  }
+
+  return data;
+}
+
+void CSolver::SetMigrationData(CGeometry *geometry, CConfig *config, bool localCFL, vector<passivedouble>& data) {
+
+  const unsigned long nFields = GetnMigrationFields(config, nVar, localCFL);
+  const bool time_n = (config->GetTime_Marching() != NO) || config->GetTime_Domain();
+  const bool time_n1 = (config->GetTime_Marching() != NO);
+
+  CLinearPartitioner pointPartitioner(geometry->GetGlobal_nPointDomain(),0);
+
+  vector<unsigned long> readerStart(size+1, geometry->GetGlobal_nPointDomain());
+  for (int iRank = 0; iRank < size; iRank++)
+    readerStart[iRank] = pointPartitioner.GetFirstIndexOnRank(iRank);
+
+  /*--- The data arrives in order of global index, as for the restart files. ---*/
+
+  const passivedouble* migrationData = RedistributeRestartData(geometry, nFields, readerStart, data);
+
+  vector<pair<unsigned long, unsigned long> > globalToLocal(geometry->GetnPointDomain());
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+    globalToLocal[iPoint] = make_pair(geometry->node[iPoint]->GetGlobalIndex(), iPoint);
+  sort(globalToLocal.begin(), globalToLocal.end());
+
+  for (unsigned long iSorted = 0; iSorted < globalToLocal.size(); iSorted++) {
+    const unsigned long iPoint = globalToLocal[iSorted].second;
+    const passivedouble* values = &migrationData[iSorted*nFields];
+
+    for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+      base_nodes->SetSolution(iPoint, iVar, *(values++));
+      if (time_n) base_nodes->Set_Solution_time_n(iPoint, iVar, *(values++));
+      if (time_n1) base_nodes->Set_Solution_time_n1(iPoint, iVar, *(values++));
+    }
+    if (localCFL) base_nodes->SetLocalCFL(iPoint, *values);
+  }
+
+  delete [] migrationData;
+
+  /*--- MPI solution (the time levels are only needed on the owned points). ---*/
+
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
+
+}
+
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
 
   char str_buf[CGNS_STRING_SIZE], fname[100];
@@ -3779,6 +4026,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
     SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
   }
 
+  /*--- Compressed files are read by a specialized routine. ---*/
+
+  if (Restart_Vars[0] == SU2CompressedRestart::MAGIC_NUMBER) {
+    fclose(fhw);
+    Read_SU2_Restart_Compressed(geometry, config, val_filename);
+    return;
+  }
+
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
@@ -3828,9 +4083,8 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   MPI_File fhw;
   SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
   MPI_Offset disp;
-  unsigned long iPoint_Global, index, iChar;
+  unsigned long index, iChar;
   string field_buf;
 
   int ierr;
@@ -3856,6 +4110,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
+  /*--- Compressed files are read by a specialized routine. ---*/
+
+  if (Restart_Vars[0] == SU2CompressedRestart::MAGIC_NUMBER) {
+    MPI_File_close(&fhw);
+    Read_SU2_Restart_Compressed(geometry, config, val_filename);
+    return;
+  }
+
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
@@ -3906,57 +4168,279 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   delete [] mpi_str_buf;
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
+  /*--- Each rank reads a contiguous range of points of the file (a linear partition) with a single
+   collective call, and then sends the points to the ranks that own them. We need to skip the header,
+   i.e. the ints describing the sizes and the string names of the variables. ---*/
 
-  etype = MPI_DOUBLE;
+  const unsigned long nPoint_Global = geometry->GetGlobal_nPointDomain();
 
-  /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-   along with the string names of the variables. ---*/
+  vector<unsigned long> readerStart(size+1);
+  for (int iRank = 0; iRank <= size; iRank++) readerStart[iRank] = (nPoint_Global*iRank)/size;
 
-  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  vector<passivedouble> data((readerStart[rank+1]-readerStart[rank])*nFields);
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char) +
+         readerStart[rank]*nFields*sizeof(passivedouble);
 
-  int *blocklen = new int[geometry->GetnPointDomain()];
-  int *displace = new int[geometry->GetnPointDomain()];
-  int counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-      blocklen[counter] = nFields;
-      displace[counter] = iPoint_Global*nFields;
-      counter++;
+  MPI_File_read_at_all(fhw, disp, data.data(), data.size(), MPI_DOUBLE, &status);
+
+  int count = 0, valid = 0, allValid = 0;
+  MPI_Get_count(&status, MPI_DOUBLE, &count);
+  valid = ((unsigned long)count == data.size());
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  /*--- All ranks close the file after reading. ---*/
+
+  MPI_File_close(&fhw);
+
+  if (!allValid) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  Restart_Data = RedistributeRestartData(geometry, nFields, readerStart, data);
+
+#endif
+
+}
+
+namespace {
+
+/*!
+ * \brief Compressed restart file (see SU2CompressedRestart), all ranks open it, and the master reads,
+ *        checks, and broadcasts the metadata. Errors are fatal.
+ */
+class CCompressedRestartFile {
+public:
+  int header[5] = {0, 0, 0, 0, 0};   /*!< \brief Header of the file. */
+  vector<char> names;                /*!< \brief Names of the fields, CGNS_STRING_SIZE characters each. */
+  vector<passivedouble> errorBound;  /*!< \brief Error bounds of the fields. */
+  string keyframeName;               /*!< \brief Name of the keyframe of a delta file. */
+  vector<unsigned long> index;       /*!< \brief Block index. */
+
+  CCompressedRestartFile(const string& val_filename, int rank) : filename(val_filename) {
+
+    using namespace SU2CompressedRestart;
+    static_assert(sizeof(unsigned long) == sizeof(uint64_t), "The block index is communicated as unsigned long.");
+
+#ifdef HAVE_MPI
+    if (MPI_File_open(MPI_COMM_WORLD, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw))
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+#else
+    fhw = fopen(filename.c_str(), "rb");
+    if (!fhw)
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + filename, CURRENT_FUNCTION);
+#endif
+
+    int valid = 1;
+    if (rank == MASTER_NODE) valid = ReadBytes(0, sizeof(header), header, false);
+    SU2_MPI::Bcast(header, 5, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+    if ((header[0] != MAGIC_NUMBER) || ((header[4] != KEYFRAME) && (header[4] != DELTA)))
+      SU2_MPI::Error(string("File ") + filename + string(" is not a compressed SU2 restart file."), CURRENT_FUNCTION);
+
+    const unsigned long nFields = header[1], nPoint_Global = header[2], nBlock = header[3];
+
+    names.resize(nFields*CGNS_STRING_SIZE);
+    errorBound.resize(nFields);
+    index.resize(nBlock*RECORD_SIZE);
+    vector<char> keyframe_buf(KEYFRAME_NAME_SIZE, '\0');
+
+    if (rank == MASTER_NODE) {
+      unsigned long offset = sizeof(header);
+      valid = valid && ReadBytes(offset, names.size(), names.data(), false);
+      offset += names.size();
+      valid = valid && ReadBytes(offset, nFields*sizeof(passivedouble), errorBound.data(), false);
+      offset += nFields*sizeof(passivedouble);
+      if (header[4] == DELTA) {
+        valid = valid && ReadBytes(offset, KEYFRAME_NAME_SIZE, keyframe_buf.data(), false);
+        offset += KEYFRAME_NAME_SIZE;
+      }
+      valid = valid && ReadBytes(offset, index.size()*sizeof(unsigned long), index.data(), false);
+
+      /*--- The blocks must be contiguous, in order, and cover all points. ---*/
+
+      unsigned long nextPoint = 0, nextOffset = offset + index.size()*sizeof(unsigned long);
+      for (unsigned long iBlock = 0; valid && (iBlock < nBlock); iBlock++) {
+        const unsigned long* record = &index[iBlock*RECORD_SIZE];
+        valid = (record[FIRST_POINT] == nextPoint) && (record[OFFSET] == nextOffset);
+        nextPoint += record[NPOINT];
+        nextOffset += record[SIZE];
+      }
+      valid = valid && (nextPoint == nPoint_Global);
+    }
+    SU2_MPI::Bcast(&valid, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+    if (!valid)
+      SU2_MPI::Error(string("The restart file ") + filename + string(" is corrupted."), CURRENT_FUNCTION);
+
+    SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Bcast(errorBound.data(), nFields, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(keyframe_buf.data(), KEYFRAME_NAME_SIZE, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(index.data(), index.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+    keyframeName = string(keyframe_buf.data(), strnlen(keyframe_buf.data(), KEYFRAME_NAME_SIZE));
+  }
+
+  ~CCompressedRestartFile() {
+#ifdef HAVE_MPI
+    MPI_File_close(&fhw);
+#else
+    fclose(fhw);
+#endif
+  }
+
+  /*!
+   * \brief Read and decode a range of blocks (collective).
+   * \param[in] firstBlock - First block.
+   * \param[in] endBlock - One past the last block.
+   * \param[in] reference - Data of the range of blocks in the keyframe, for delta files.
+   * \return Data of the range of blocks, nPoint x nField.
+   */
+  vector<passivedouble> ReadBlocks(unsigned long firstBlock, unsigned long endBlock,
+                                   const passivedouble* reference) {
+
+    using namespace SU2CompressedRestart;
+
+    const unsigned long nFields = header[1];
+    unsigned long firstPoint = 0, nPointRead = 0, offset = 0, sizeInBytes = 0;
+
+    if (endBlock > firstBlock) {
+      const unsigned long* first = &index[firstBlock*RECORD_SIZE];
+      const unsigned long* last = &index[(endBlock-1)*RECORD_SIZE];
+      firstPoint = first[FIRST_POINT];
+      nPointRead = last[FIRST_POINT] + last[NPOINT] - firstPoint;
+      offset = first[OFFSET];
+      sizeInBytes = last[OFFSET] + last[SIZE] - offset;
+    }
+
+    vector<unsigned char> buffer(sizeInBytes);
+    int valid = ReadBytes(offset, sizeInBytes, buffer.data(), true);
+
+    /*--- Verify and decode the blocks. ---*/
+
+    vector<passivedouble> data(nPointRead*nFields);
+
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1) reduction(&&:valid))
+    for (unsigned long iBlock = firstBlock; iBlock < endBlock; iBlock++) {
+      const unsigned long* record = &index[iBlock*RECORD_SIZE];
+      const unsigned char* block = &buffer[record[OFFSET]-offset];
+      const unsigned long pos = (record[FIRST_POINT]-firstPoint)*nFields;
+
+      valid = valid && (CompressionToolbox::Checksum(block, record[SIZE]) == record[CHECKSUM]) &&
+              CompressionToolbox::DecodeBlock(block, record[SIZE], record[NPOINT], nFields, errorBound.data(),
+                                              &data[pos], reference? &reference[pos] : nullptr);
     }
+
+    int allValid = 0;
+    SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    if (!allValid)
+      SU2_MPI::Error(string("The restart file ") + filename + string(" is corrupted."), CURRENT_FUNCTION);
+
+    return data;
   }
-  MPI_Type_indexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
 
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
+private:
+  string filename;
 
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+#ifdef HAVE_MPI
+  MPI_File fhw;
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+  bool ReadBytes(unsigned long offset, unsigned long sizeInBytes, void* buf, bool collective) {
+    MPI_Status status;
+    int count = 0;
+    if (collective) MPI_File_read_at_all(fhw, offset, buf, int(sizeInBytes), MPI_BYTE, &status);
+    else MPI_File_read_at(fhw, offset, buf, int(sizeInBytes), MPI_BYTE, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    return (unsigned long)count == sizeInBytes;
+  }
+#else
+  FILE* fhw;
 
-  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+  bool ReadBytes(unsigned long offset, unsigned long sizeInBytes, void* buf, bool) {
+    return (fseek(fhw, offset, SEEK_SET) == 0) && (fread(buf, 1, sizeInBytes, fhw) == sizeInBytes);
+  }
+#endif
+};
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+}
 
-  MPI_File_read_all(fhw, Restart_Data, nFields*geometry->GetnPointDomain(), MPI_DOUBLE, &status);
+void CSolver::Read_SU2_Restart_Compressed(CGeometry *geometry, CConfig *config, const string& val_filename) {
 
-  /*--- All ranks close the file after writing. ---*/
+  using namespace SU2CompressedRestart;
 
-  MPI_File_close(&fhw);
+  CCompressedRestartFile file(val_filename, rank);
+
+  const unsigned long nFields = file.header[1], nPoint_Global = file.header[2], nBlock = file.header[3];
 
-  /*--- Free the derived datatype and release temp memory. ---*/
+  if (nPoint_Global != geometry->GetGlobal_nPointDomain())
+    SU2_MPI::Error(string("The number of points in the restart file ") + val_filename +
+                   string(" does not match the mesh."), CURRENT_FUNCTION);
 
-  MPI_Type_free(&filetype);
+  /*--- Same conventions as the uncompressed files for the names of the fields. ---*/
 
-  delete [] blocklen;
-  delete [] displace;
+  Restart_Vars[0] = file.header[0];
+  Restart_Vars[1] = nFields;
+  Restart_Vars[2] = nPoint_Global;
+  Restart_Vars[3] = 0;
+  Restart_Vars[4] = 0;
 
+  fields.push_back("Point_ID");
+  for (unsigned long iVar = 0; iVar < nFields; iVar++) {
+    const char* name = &file.names[iVar*CGNS_STRING_SIZE];
+    string field(name, strnlen(name, CGNS_STRING_SIZE));
+#ifdef HAVE_MPI
+    fields.push_back("\"" + field + "\"");
+#else
+    fields.push_back(field);
 #endif
+  }
+
+  /*--- Each rank reads a contiguous range of blocks. ---*/
+
+  auto FirstBlockOfRank = [&](int iRank) { return (nBlock*iRank)/size; };
+
+  const unsigned long firstBlock = FirstBlockOfRank(rank), endBlock = FirstBlockOfRank(rank+1);
+
+  vector<passivedouble> data;
+
+  if (file.header[4] == DELTA) {
+
+    /*--- The keyframe (in the same directory) must have the same fields, error bounds, and blocks,
+     and its blocks must be those that were used to encode the delta. ---*/
+
+    const string keyframeName = val_filename.substr(0, val_filename.find_last_of('/')+1) + file.keyframeName;
+
+    CCompressedRestartFile keyframe(keyframeName, rank);
+
+    bool compatible = (keyframe.header[4] == KEYFRAME) &&
+                      equal(file.header+1, file.header+4, keyframe.header+1) &&
+                      (keyframe.names == file.names) && (keyframe.errorBound == file.errorBound);
+
+    for (unsigned long iBlock = 0; compatible && (iBlock < nBlock); iBlock++) {
+      const unsigned long* record = &file.index[iBlock*RECORD_SIZE];
+      const unsigned long* recordKey = &keyframe.index[iBlock*RECORD_SIZE];
+      compatible = (record[FIRST_POINT] == recordKey[FIRST_POINT]) && (record[NPOINT] == recordKey[NPOINT]) &&
+                   (record[REFERENCE] == recordKey[CHECKSUM]);
+    }
+
+    if (!compatible)
+      SU2_MPI::Error(string("The keyframe ") + keyframeName + string(" of the restart file ") + val_filename +
+                     string(" has been modified."), CURRENT_FUNCTION);
+
+    const auto reference = keyframe.ReadBlocks(firstBlock, endBlock, nullptr);
+    data = file.ReadBlocks(firstBlock, endBlock, reference.data());
+  }
+  else {
+    data = file.ReadBlocks(firstBlock, endBlock, nullptr);
+  }
+
+  /*--- Send the points to the ranks that own them. ---*/
+
+  vector<unsigned long> readerStart(size+1, nPoint_Global);
+  for (int iRank = 0; iRank < size; iRank++)
+    if (FirstBlockOfRank(iRank) < nBlock) readerStart[iRank] = file.index[FirstBlockOfRank(iRank)*RECORD_SIZE+FIRST_POINT];
+
+  Restart_Data = RedistributeRestartData(geometry, nFields, readerStart, data);
 
 }
 
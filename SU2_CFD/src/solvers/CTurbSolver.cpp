@@ -125,10 +125,10 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
 
     /*--- Points in edge and normal vectors ---*/
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    auto iPoint = geometry->GetEdgeNode(iEdge,0);
+    auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction ---*/
 
@@ -145,14 +145,14 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     /*--- Grid Movement ---*/
 
     if (dynamic_grid)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
-                           geometry->node[jPoint]->GetGridVel());
+      numerics->SetGridVel(geometry->GetPointGridVel(iPoint),
+                           geometry->GetPointGridVel(jPoint));
 
     if (muscl || musclFlow) {
       const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
 
-      const auto Coord_i = geometry->node[iPoint]->GetCoord();
-      const auto Coord_j = geometry->node[jPoint]->GetCoord();
+      const auto Coord_i = geometry->GetPointCoord(iPoint);
+      const auto Coord_j = geometry->GetPointCoord(jPoint);
 
       su2double Vector_ij[MAXNDIM] = {0.0};
       for (iDim = 0; iDim < nDim; iDim++) {
@@ -250,14 +250,14 @@ void CTurbSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSo
 
   /*--- Points in edge ---*/
 
-  auto iPoint = geometry->edge[iEdge]->GetNode(0);
-  auto jPoint = geometry->edge[iEdge]->GetNode(1);
+  auto iPoint = geometry->GetEdgeNode(iEdge,0);
+  auto jPoint = geometry->GetEdgeNode(iEdge,1);
 
   /*--- Points coordinates, and normal vector ---*/
 
-  numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                     geometry->node[jPoint]->GetCoord());
-  numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+  numerics->SetCoord(geometry->GetPointCoord(iPoint),
+                     geometry->GetPointCoord(jPoint));
+  numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
 
   /*--- Conservative variables w/o reconstruction ---*/
 
@@ -969,6 +969,8 @@ void CTurbSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
       }
       solver[iMesh][TURB_SOL]->GetNodes()->SetSolution(iPoint,Solution);
     }
+    if (config->GetMG_ParallelAgglomeration())
+      solver[iMesh][TURB_SOL]->AddHaloValues(geometry[iMesh], SOLUTION);
     solver[iMesh][TURB_SOL]->InitiateComms(geometry[iMesh], config, SOLUTION_EDDY);
     solver[iMesh][TURB_SOL]->CompleteComms(geometry[iMesh], config, SOLUTION_EDDY);
     solver[iMesh][FLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
@@ -341,7 +341,8 @@ int main(int argc, char *argv[]) {
     
     output[iZone]->Load_Data(geometry_container[iZone], config_container[iZone], NULL);
     
-    output[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone], MESH, config->GetMesh_Out_FileName());
+    const unsigned short meshFormat = (config->GetMesh_Out_FileFormat() == SU2_BINARY)? MESH_BINARY : MESH;
+    output[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone], meshFormat, config->GetMesh_Out_FileName());
     
     /*--- Set the file names for the visualization files ---*/
     
@@ -362,9 +363,11 @@ int main(int argc, char *argv[]) {
   if ((config_container[ZONE_0]->GetDesign_Variable(0) != NO_DEFORMATION) &&
       (config_container[ZONE_0]->GetDesign_Variable(0) != SCALE_GRID)     &&
       (config_container[ZONE_0]->GetDesign_Variable(0) != TRANSLATE_GRID) &&
-      (config_container[ZONE_0]->GetDesign_Variable(0) != ROTATE_GRID)) {
+      (config_container[ZONE_0]->GetDesign_Variable(0) != ROTATE_GRID) &&
+      (config_container[ZONE_0]->GetMesh_Out_FileFormat() != SU2_BINARY)) {
   
-    /*--- Write the the free-form deformation boxes after deformation. ---*/
+    /*--- Write the the free-form deformation boxes after deformation
+     (the binary mesh format does not store FFD boxes). ---*/
     
     if (rank == MASTER_NODE) cout << "Adding any FFD information to the SU2 file." << endl;
     
@@ -64,6 +64,160 @@ def main():
     naca0012.tol       = 0.00001
     test_list.append(naca0012)
 
+    # NACA0012 with the vectorized Roe fluxes
+    naca0012_vec_roe           = TestCase('naca0012_vec_roe')
+    naca0012_vec_roe.cfg_dir   = "euler/naca0012"
+    naca0012_vec_roe.cfg_file  = "inv_NACA0012_vec_Roe.cfg"
+    naca0012_vec_roe.test_iter = 20
+    naca0012_vec_roe.test_vals = [-4.055696, -3.564675, 0.336752, 0.021541] #last 4 columns
+    naca0012_vec_roe.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_vec_roe.timeout   = 1600
+    naca0012_vec_roe.tol       = 0.00001
+    test_list.append(naca0012_vec_roe)
+
+    # NACA0012 with the vectorized AUSM fluxes
+    naca0012_vec_ausm           = TestCase('naca0012_vec_ausm')
+    naca0012_vec_ausm.cfg_dir   = "euler/naca0012"
+    naca0012_vec_ausm.cfg_file  = "inv_NACA0012_vec_AUSM.cfg"
+    naca0012_vec_ausm.test_iter = 20
+    naca0012_vec_ausm.test_vals = [-4.098582, -3.593960, 0.337815, 0.020037] #last 4 columns
+    naca0012_vec_ausm.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_vec_ausm.timeout   = 1600
+    naca0012_vec_ausm.tol       = 0.00001
+    test_list.append(naca0012_vec_ausm)
+
+    # NACA0012 with the vectorized HLLC fluxes
+    naca0012_vec_hllc           = TestCase('naca0012_vec_hllc')
+    naca0012_vec_hllc.cfg_dir   = "euler/naca0012"
+    naca0012_vec_hllc.cfg_file  = "inv_NACA0012_vec_HLLC.cfg"
+    naca0012_vec_hllc.test_iter = 20
+    naca0012_vec_hllc.test_vals = [-4.037243, -3.528811, 0.335462, 0.022018] #last 4 columns
+    naca0012_vec_hllc.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_vec_hllc.timeout   = 1600
+    naca0012_vec_hllc.tol       = 0.00001
+    test_list.append(naca0012_vec_hllc)
+
+    # NACA0012 with the vectorized JST fluxes
+    naca0012_vec_jst           = TestCase('naca0012_vec_jst')
+    naca0012_vec_jst.cfg_dir   = "euler/naca0012"
+    naca0012_vec_jst.cfg_file  = "inv_NACA0012_vec_JST.cfg"
+    naca0012_vec_jst.test_iter = 20
+    naca0012_vec_jst.test_vals = [-3.798551, -3.240861, 0.334978, 0.022815] #last 4 columns
+    naca0012_vec_jst.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_vec_jst.timeout   = 1600
+    naca0012_vec_jst.tol       = 0.00001
+    test_list.append(naca0012_vec_jst)
+
+    # NACA0012 with the algebraic multigrid preconditioner
+    naca0012_amg           = TestCase('naca0012_amg')
+    naca0012_amg.cfg_dir   = "euler/naca0012"
+    naca0012_amg.cfg_file  = "inv_NACA0012_AMG.cfg"
+    naca0012_amg.test_iter = 20
+    naca0012_amg.test_vals = [-4.055696, -3.564675, 5, -6.923332] #last 4 columns
+    naca0012_amg.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_amg.timeout   = 1600
+    naca0012_amg.tol       = 0.00001
+    test_list.append(naca0012_amg)
+
+    # NACA0012 with the single-reduction (classical Gram-Schmidt) FGMRES
+    naca0012_cgs_fgmres           = TestCase('naca0012_cgs_fgmres')
+    naca0012_cgs_fgmres.cfg_dir   = "euler/naca0012"
+    naca0012_cgs_fgmres.cfg_file  = "inv_NACA0012_CGS_FGMRES.cfg"
+    naca0012_cgs_fgmres.test_iter = 20
+    naca0012_cgs_fgmres.test_vals = [-4.055695, -3.564675, 5, -4.988994] #last 4 columns
+    naca0012_cgs_fgmres.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_cgs_fgmres.timeout   = 1600
+    naca0012_cgs_fgmres.tol       = 0.00001
+    test_list.append(naca0012_cgs_fgmres)
+
+    # NACA0012 writing a compressed restart file
+    naca0012_compressed           = TestCase('naca0012_compressed')
+    naca0012_compressed.cfg_dir   = "euler/naca0012"
+    naca0012_compressed.cfg_file  = "inv_NACA0012_compressed.cfg"
+    naca0012_compressed.test_iter = 20
+    naca0012_compressed.test_vals = [-4.055696, -3.564675, 0.336752, 0.021541] #last 4 columns
+    naca0012_compressed.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_compressed.timeout   = 1600
+    naca0012_compressed.tol       = 0.00001
+    test_list.append(naca0012_compressed)
+
+    # NACA0012 restarted from the compressed file of the previous test
+    naca0012_compressed_rst           = TestCase('naca0012_compressed_restart')
+    naca0012_compressed_rst.cfg_dir   = "euler/naca0012"
+    naca0012_compressed_rst.cfg_file  = "inv_NACA0012_compressed_restart.cfg"
+    naca0012_compressed_rst.test_iter = 20
+    naca0012_compressed_rst.test_vals = [-4.927806, -4.423018, 0.336047, 0.021038] #last 4 columns
+    naca0012_compressed_rst.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_compressed_rst.timeout   = 1600
+    naca0012_compressed_rst.tol       = 0.00001
+    test_list.append(naca0012_compressed_rst)
+
+    # NACA0012 writing a compressed restart file with lossy fields
+    naca0012_lossy           = TestCase('naca0012_lossy')
+    naca0012_lossy.cfg_dir   = "euler/naca0012"
+    naca0012_lossy.cfg_file  = "inv_NACA0012_lossy.cfg"
+    naca0012_lossy.test_iter = 20
+    naca0012_lossy.test_vals = [-4.055696, -3.564675, 0.336752, 0.021541] #last 4 columns
+    naca0012_lossy.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_lossy.timeout   = 1600
+    naca0012_lossy.tol       = 0.00001
+    test_list.append(naca0012_lossy)
+
+    # NACA0012 restarted from the file with lossy fields of the previous test
+    naca0012_lossy_rst           = TestCase('naca0012_lossy_restart')
+    naca0012_lossy_rst.cfg_dir   = "euler/naca0012"
+    naca0012_lossy_rst.cfg_file  = "inv_NACA0012_lossy_restart.cfg"
+    naca0012_lossy_rst.test_iter = 20
+    naca0012_lossy_rst.test_vals = [-4.927806, -4.423018, 0.336047, 0.021038] #last 4 columns
+    naca0012_lossy_rst.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_lossy_rst.timeout   = 1600
+    naca0012_lossy_rst.tol       = 0.00001
+    test_list.append(naca0012_lossy_rst)
+
+    # NACA0012 with point probes
+    naca0012_probes           = TestCase('naca0012_probes')
+    naca0012_probes.cfg_dir   = "euler/naca0012"
+    naca0012_probes.cfg_file  = "inv_NACA0012_probes.cfg"
+    naca0012_probes.test_iter = 20
+    naca0012_probes.test_vals = [-4.055696, -3.564675, 1.0129, 1.0253] #last 4 columns
+    naca0012_probes.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_probes.timeout   = 1600
+    naca0012_probes.tol       = 0.00001
+    test_list.append(naca0012_probes)
+
+    # NACA0012 with a line probe
+    naca0012_line_probes           = TestCase('naca0012_line_probes')
+    naca0012_line_probes.cfg_dir   = "euler/naca0012"
+    naca0012_line_probes.cfg_file  = "inv_NACA0012_line_probes.cfg"
+    naca0012_line_probes.test_iter = 20
+    naca0012_line_probes.test_vals = [-4.055696, -3.564675, 0.68907, 0.59329] #last 4 columns
+    naca0012_line_probes.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_line_probes.timeout   = 1600
+    naca0012_line_probes.tol       = 0.00001
+    test_list.append(naca0012_line_probes)
+
+    # NACA0012 with the HDF5 volume output
+    naca0012_hdf5           = TestCase('naca0012_hdf5')
+    naca0012_hdf5.cfg_dir   = "euler/naca0012"
+    naca0012_hdf5.cfg_file  = "inv_NACA0012_hdf5.cfg"
+    naca0012_hdf5.test_iter = 20
+    naca0012_hdf5.test_vals = [-4.055696, -3.564675, 0.336752, 0.021541] #last 4 columns
+    naca0012_hdf5.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_hdf5.timeout   = 1600
+    naca0012_hdf5.tol       = 0.00001
+    test_list.append(naca0012_hdf5)
+
+    # NACA0012 with the HDF5 surface output
+    naca0012_surface_hdf5           = TestCase('naca0012_surface_hdf5')
+    naca0012_surface_hdf5.cfg_dir   = "euler/naca0012"
+    naca0012_surface_hdf5.cfg_file  = "inv_NACA0012_surface_hdf5.cfg"
+    naca0012_surface_hdf5.test_iter = 20
+    naca0012_surface_hdf5.test_vals = [-4.055696, -3.564675, 0.336752, 0.021541] #last 4 columns
+    naca0012_surface_hdf5.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_surface_hdf5.timeout   = 1600
+    naca0012_surface_hdf5.tol       = 0.00001
+    test_list.append(naca0012_surface_hdf5)
+
     # Supersonic wedge 
     wedge           = TestCase('wedge')
     wedge.cfg_dir   = "euler/wedge"
@@ -1305,6 +1459,18 @@ def main():
     
     pass_list = [ test.run_test() for test in test_list ]
 
+    # HDF5 output of the NACA0012, the XDMF descriptor only depends on the global mesh and fields
+    naca0012_hdf5_xdmf                = TestCase('naca0012_hdf5_xdmf')
+    naca0012_hdf5_xdmf.cfg_dir        = "euler/naca0012"
+    naca0012_hdf5_xdmf.cfg_file       = "inv_NACA0012_hdf5.cfg"
+    naca0012_hdf5_xdmf.test_iter      = 1
+    naca0012_hdf5_xdmf.su2_exec       = "mpirun -n 2 SU2_CFD"
+    naca0012_hdf5_xdmf.timeout        = 1600
+    naca0012_hdf5_xdmf.reference_file = "flow.xmf.ref"
+    naca0012_hdf5_xdmf.test_file      = "flow.xmf"
+    pass_list.append(naca0012_hdf5_xdmf.run_filediff())
+    test_list.append(naca0012_hdf5_xdmf)
+
     ######################################
     ### RUN SU2_SOL TESTS              ###
     ######################################
@@ -1351,6 +1517,44 @@ def main():
     pass_list.append(naca0012_def_file.run_def())
     test_list.append(naca0012_def_file)
 
+    # Inviscid NACA0012 (triangles) with the pipelined conjugate gradient
+    naca0012_def_pipelined_cg           = TestCase('naca0012_def_pipelined_cg')
+    naca0012_def_pipelined_cg.cfg_dir   = "deformation/naca0012"
+    naca0012_def_pipelined_cg.cfg_file  = "def_NACA0012_pipelined_cg.cfg"
+    naca0012_def_pipelined_cg.test_iter = 10
+    naca0012_def_pipelined_cg.test_vals = [0.00979309] #residual
+    naca0012_def_pipelined_cg.su2_exec  = "mpirun -n 2 SU2_DEF"
+    naca0012_def_pipelined_cg.timeout   = 1600
+    naca0012_def_pipelined_cg.tol       = 1e-8
+    
+    pass_list.append(naca0012_def_pipelined_cg.run_def())
+    test_list.append(naca0012_def_pipelined_cg)
+
+    # Inviscid NACA0012 (triangles), deformed mesh written in the binary format
+    naca0012_def_binary           = TestCase('naca0012_def_binary')
+    naca0012_def_binary.cfg_dir   = "deformation/naca0012"
+    naca0012_def_binary.cfg_file  = "def_NACA0012_binary.cfg"
+    naca0012_def_binary.test_iter = 10
+    naca0012_def_binary.test_vals = [0.00354532] #residual
+    naca0012_def_binary.su2_exec  = "mpirun -n 2 SU2_DEF"
+    naca0012_def_binary.timeout   = 1600
+    naca0012_def_binary.tol       = 1e-8
+    
+    pass_list.append(naca0012_def_binary.run_def())
+    test_list.append(naca0012_def_binary)
+
+    # Inviscid NACA0012 read from the binary mesh written by the previous test
+    naca0012_binary_mesh           = TestCase('naca0012_binary_mesh')
+    naca0012_binary_mesh.cfg_dir   = "deformation/naca0012"
+    naca0012_binary_mesh.cfg_file  = "inv_NACA0012_binary_mesh.cfg"
+    naca0012_binary_mesh.test_iter = 20
+    naca0012_binary_mesh.test_vals = [-3.764876, -3.289490, -0.599296, 0.145187] #last 4 columns
+    naca0012_binary_mesh.su2_exec  = "mpirun -n 2 SU2_CFD"
+    naca0012_binary_mesh.timeout   = 1600
+    naca0012_binary_mesh.tol       = 0.00001
+    pass_list.append(naca0012_binary_mesh.run_test())
+    test_list.append(naca0012_binary_mesh)
+
     # RAE2822 (mixed tris + quads)
     rae2822_def            = TestCase('rae2822_def')
     rae2822_def.cfg_dir   = "deformation/rae2822"